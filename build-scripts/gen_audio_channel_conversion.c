@@ -397,6 +397,18 @@ static void write_converter(const int fromchans, const int tochans)
     }
 
     printf("\n}\n\n");
+
+    /* the same conversion as a matrix, for the SIMD converters. */
+    printf("static const float SDL_Convert%sTo%s_Matrix[%d * %d] = {   // [to][from]\n", remove_dots(fromstr), remove_dots(tostr), tochans, fromchans);
+    for (j = 0; j < tochans; j++) {
+        fptr = cvtmatrix + (fromchans * j);
+        printf("   ");
+        for (i = 0; i < fromchans; i++) {
+            printf(" %.9ff,", fptr[i]);
+        }
+        printf("  // %s\n", channel_names[tochans-1][j]);
+    }
+    printf("};\n\n");
 }
 
 int main(void)
@@ -438,7 +450,7 @@ int main(void)
         }
     }
 
-    printf("static const SDL_AudioChannelConverter channel_converters[%d][%d] = {   /* [from][to] */\n", NUM_CHANNELS, NUM_CHANNELS);
+    printf("static const SDL_AudioChannelConverter channel_converters[%d][%d] = {   // [from][to]\n", NUM_CHANNELS, NUM_CHANNELS);
     for (ini = 1; ini <= NUM_CHANNELS; ini++) {
         const char *comma = "";
         printf("    {");
@@ -457,5 +469,24 @@ int main(void)
 
     printf("};\n\n");
 
+    printf("static const float *const channel_conversion_matrices[%d][%d] = {   // [from][to]\n", NUM_CHANNELS, NUM_CHANNELS);
+    for (ini = 1; ini <= NUM_CHANNELS; ini++) {
+        const char *comma = "";
+        printf("    {");
+        for (outi = 1; outi <= NUM_CHANNELS; outi++) {
+            const char *fromstr = layout_names[ini-1];
+            const char *tostr = layout_names[outi-1];
+            if (ini == outi) {
+                printf("%s NULL", comma);
+            } else {
+                printf("%s SDL_Convert%sTo%s_Matrix", comma, remove_dots(fromstr), remove_dots(tostr));
+            }
+            comma = ",";
+        }
+        printf(" }%s\n", (ini == NUM_CHANNELS) ? "" : ",");
+    }
+
+    printf("};\n\n");
+
     return 0;
 }
@@ -42,7 +42,8 @@
  *
  * SDL also provides a simple .WAV loader in SDL_LoadWAV (and SDL_LoadWAV_IO
  * if you aren't reading from a file) as a basic means to load sound data into
- * your program.
+ * your program. Long files can be decoded a block at a time instead with
+ * SDL_CreateWAVDecoder.
  *
  * ## Logical audio devices
  *
@@ -450,6 +451,26 @@ typedef struct SDL_AudioSpec
  */
 typedef struct SDL_AudioStream SDL_AudioStream;
 
+/**
+ * The quality of the resampler used by an audio stream.
+ *
+ * Higher quality settings use longer filters, which cost more CPU time per
+ * sample frame and need a few more frames of input before output is
+ * available. Lower quality settings let more aliasing and high frequency
+ * loss through.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetAudioStreamResamplerQuality
+ */
+typedef enum SDL_AudioResamplerQuality
+{
+    SDL_AUDIO_RESAMPLER_QUALITY_INVALID = -1, /**< An invalid quality, returned on failure */
+    SDL_AUDIO_RESAMPLER_QUALITY_FAST,   /**< Linear interpolation, cheap enough for many voice streams */
+    SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM, /**< A short windowed-sinc filter, the default */
+    SDL_AUDIO_RESAMPLER_QUALITY_HIGH    /**< A long windowed-sinc filter, for music and offline processing */
+} SDL_AudioResamplerQuality;
+
 
 /* Function prototypes */
 
@@ -1218,6 +1239,49 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetAudioStreamGain(SDL_AudioStream *stream
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain);
 
+/**
+ * Get the quality of the resampler used by an audio stream.
+ *
+ * Audio streams default to SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM.
+ *
+ * \param stream the SDL_AudioStream to query.
+ * \returns the resampler quality of the stream, or
+ *          SDL_AUDIO_RESAMPLER_QUALITY_INVALID on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetAudioStreamResamplerQuality
+ */
+extern SDL_DECLSPEC SDL_AudioResamplerQuality SDLCALL SDL_GetAudioStreamResamplerQuality(SDL_AudioStream *stream);
+
+/**
+ * Change the quality of the resampler used by an audio stream.
+ *
+ * The resampler is used when the input and output sample rates differ, or
+ * the frequency ratio isn't 1.0. Audio streams default to
+ * SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM.
+ *
+ * This is applied during SDL_GetAudioStreamData, and takes effect the next
+ * time data is read from the stream.
+ *
+ * \param stream the stream on which the resampler quality is being changed.
+ * \param quality the SDL_AudioResamplerQuality to use.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioStreamResamplerQuality
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamResamplerQuality(SDL_AudioStream *stream, SDL_AudioResamplerQuality quality);
+
 /**
  * Get the current input channel map of an audio stream.
  *
@@ -1414,6 +1478,79 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamOutputChannelMap(SDL_AudioStr
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len);
 
+/**
+ * A callback that fires when an audio stream is done with data added by
+ * SDL_PutAudioStreamDataNoCopy().
+ *
+ * Once this callback fires, the stream will not touch `buf` again, so the app
+ * can free or reuse it.
+ *
+ * This callback fires however the stream finishes with the data: the data
+ * being read out, SDL_ClearAudioStream(), or SDL_DestroyAudioStream(). It may
+ * be called from any thread that reads from the stream, such as an audio
+ * device thread, while the stream's lock is held.
+ *
+ * \param userdata an opaque pointer provided by the app for its personal use.
+ * \param buf the pointer provided to SDL_PutAudioStreamDataNoCopy().
+ * \param buflen the size of buffer, in bytes, provided to
+ *               SDL_PutAudioStreamDataNoCopy().
+ *
+ * \threadsafety This callback may run from any thread, so if you need to
+ *               protect shared data, you should use SDL_LockAudioStream to
+ *               serialize access; this lock will be held before your callback
+ *               is called, so your callback does not need to manage the lock
+ *               explicitly.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_PutAudioStreamDataNoCopy
+ */
+typedef void (SDLCALL *SDL_AudioStreamDataCompleteCallback)(void *userdata, const void *buf, int buflen);
+
+/**
+ * Add data to the stream without copying it.
+ *
+ * Unlike SDL_PutAudioStreamData(), this function does not copy the data. The
+ * stream keeps the pointer and reads from the app's buffer directly when data
+ * is requested, which saves a copy for large, already-decoded buffers.
+ *
+ * The buffer must stay valid, and must not be modified, until the stream is
+ * done with it. `callback` is called at that point; see
+ * SDL_AudioStreamDataCompleteCallback for details. If this function fails,
+ * the callback is not called and the app still owns the buffer.
+ *
+ * This data must match the format/channels/samplerate specified in the latest
+ * call to SDL_SetAudioStreamFormat, or the format specified when creating the
+ * stream if it hasn't been changed.
+ *
+ * Each call still needs a small allocation to track the buffer, so this is
+ * best suited to large buffers. For a few sample frames at a time,
+ * SDL_PutAudioStreamData() is likely to be faster.
+ *
+ * \param stream the stream the audio data is being added to.
+ * \param buf a pointer to the audio data to add.
+ * \param len the number of bytes to add to the stream.
+ * \param callback the function to call when the stream is done with `buf`,
+ *                 may be NULL.
+ * \param userdata an opaque pointer provided to the callback for its own
+ *                 personal use.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but if the
+ *               stream has a callback set, the caller might need to manage
+ *               extra locking.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ClearAudioStream
+ * \sa SDL_FlushAudioStream
+ * \sa SDL_GetAudioStreamData
+ * \sa SDL_GetAudioStreamQueued
+ * \sa SDL_PutAudioStreamData
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *stream, const void *buf, int len, SDL_AudioStreamDataCompleteCallback callback, void *userdata);
+
 /**
  * Add data to the stream with each channel in a separate array.
  *
@@ -1877,6 +2014,48 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetAudioStreamPutCallback(SDL_AudioStream *
  */
 extern SDL_DECLSPEC void SDLCALL SDL_DestroyAudioStream(SDL_AudioStream *stream);
 
+/**
+ * Statistics about the pool of memory shared by audio streams.
+ *
+ * Audio streams queue their data in fixed-size chunks. Each stream keeps a
+ * few free chunks for itself, and the rest go to a pool shared by every
+ * stream. The size of the pool is set with SDL_HINT_AUDIO_CHUNK_POOL_SIZE.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioChunkPoolStats
+ */
+typedef struct SDL_AudioChunkPoolStats
+{
+    int chunk_size;             /**< the size of each chunk, in bytes */
+    int max_free_chunks;        /**< the most free chunks the pool will hold, 0 if the pool is disabled */
+    int free_chunks;            /**< the number of free chunks in the pool right now */
+    Uint32 reused_chunks;       /**< the number of chunks that streams got from the pool */
+    Uint32 allocated_chunks;    /**< the number of chunks that were allocated because the pool was empty */
+    Uint32 released_chunks;     /**< the number of chunks that were freed because the pool was full */
+} SDL_AudioChunkPoolStats;
+
+/**
+ * Get statistics about the pool of memory shared by audio streams.
+ *
+ * The counters start when the pool is created, which happens when the first
+ * audio stream is created, or from the last time they were reset.
+ *
+ * If `allocated_chunks` keeps going up while streams play, the pool is too
+ * small for the amount of audio being queued, and
+ * SDL_HINT_AUDIO_CHUNK_POOL_SIZE can be set to make it bigger.
+ *
+ * \param stats a pointer filled in with the pool statistics.
+ * \param reset true to clear the counters after reading them.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetAudioChunkPoolStats(SDL_AudioChunkPoolStats *stats, bool reset);
+
 
 /**
  * Convenience function for straightforward audio init for the common case.
@@ -2227,6 +2406,177 @@ extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len);
 
+/**
+ * A decoder that reads a WAVE file incrementally.
+ *
+ * Unlike SDL_LoadWAV_IO(), which decodes the entire file into one buffer, a
+ * decoder only holds about one block of audio data in memory at a time. This
+ * makes it suitable for streaming long recordings into an SDL_AudioStream.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateWAVDecoder
+ */
+typedef struct SDL_WAVDecoder SDL_WAVDecoder;
+
+/**
+ * Create a decoder that reads audio data from a WAVE file incrementally.
+ *
+ * This reads and validates the headers of the WAVE file, but none of the
+ * audio data. The data is read and decoded as it is requested with
+ * SDL_ReadWAVDecoder() or SDL_PutWAVDecoderData().
+ *
+ * The same formats are supported as with SDL_LoadWAV_IO(), and the decoded
+ * data is identical to what that function returns. The hints
+ * `SDL_HINT_WAVE_RIFF_CHUNK_SIZE`, `SDL_HINT_WAVE_TRUNCATION`,
+ * `SDL_HINT_WAVE_FACT_CHUNK`, and `SDL_HINT_WAVE_CHUNK_LIMIT` are respected.
+ *
+ * It is required that the data source supports seeking. The decoder owns the
+ * read position of `src` until it is destroyed.
+ *
+ * \param src the data source for the WAVE data.
+ * \param closeio if true, calls SDL_CloseIO() on `src` when the decoder is
+ *                destroyed, or before returning if this function fails.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the format
+ *             of the decoded data on successful return.
+ * \returns a new decoder on success or NULL on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_DestroyWAVDecoder
+ * \sa SDL_PutWAVDecoderData
+ * \sa SDL_ReadWAVDecoder
+ * \sa SDL_SeekWAVDecoder
+ */
+extern SDL_DECLSPEC SDL_WAVDecoder * SDLCALL SDL_CreateWAVDecoder(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec);
+
+/**
+ * Decode audio data from a WAVE decoder into a buffer.
+ *
+ * The data is in the format reported by SDL_CreateWAVDecoder(). Only whole
+ * sample frames are returned, so `len` should be at least the size of one
+ * sample frame.
+ *
+ * \param decoder the decoder to read from.
+ * \param buf a buffer to fill with decoded audio data.
+ * \param len the maximum number of bytes to fill.
+ * \returns the number of bytes read, 0 at the end of the data, or -1 on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety Do not use the same decoder from multiple threads at the
+ *               same time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateWAVDecoder
+ * \sa SDL_PutWAVDecoderData
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_ReadWAVDecoder(SDL_WAVDecoder *decoder, void *buf, int len);
+
+/**
+ * Decode audio data from a WAVE decoder into an audio stream.
+ *
+ * The data is decoded one block at a time and each block is put into
+ * `stream`, so the decoder never needs more memory than a single block, no
+ * matter how many frames are requested. The input format of `stream` should
+ * match the spec reported by SDL_CreateWAVDecoder().
+ *
+ * \param decoder the decoder to read from.
+ * \param stream the audio stream to put the decoded data into.
+ * \param frames the maximum number of sample frames to put into the stream.
+ * \returns the number of sample frames put into the stream, 0 at the end of
+ *          the data, or -1 on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety Do not use the same decoder from multiple threads at the
+ *               same time. It is safe to use `stream` from other threads.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateWAVDecoder
+ * \sa SDL_ReadWAVDecoder
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_PutWAVDecoderData(SDL_WAVDecoder *decoder, SDL_AudioStream *stream, int frames);
+
+/**
+ * Seek to a sample frame in a WAVE decoder.
+ *
+ * Compressed formats are decoded in blocks, so seeking decodes the block
+ * containing `frame` and skips the frames before it. Seeking past the end of
+ * the data positions the decoder at the end.
+ *
+ * \param decoder the decoder to seek.
+ * \param frame the sample frame to seek to, counted from the start of the
+ *              data.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety Do not use the same decoder from multiple threads at the
+ *               same time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetWAVDecoderLength
+ * \sa SDL_TellWAVDecoder
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SeekWAVDecoder(SDL_WAVDecoder *decoder, Sint64 frame);
+
+/**
+ * Get the current position of a WAVE decoder.
+ *
+ * \param decoder the decoder to query.
+ * \returns the index of the next sample frame that will be decoded, or -1 on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety Do not use the same decoder from multiple threads at the
+ *               same time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SeekWAVDecoder
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_TellWAVDecoder(SDL_WAVDecoder *decoder);
+
+/**
+ * Get the length of the audio data in a WAVE decoder.
+ *
+ * If the file is truncated, this is the number of sample frames that can
+ * actually be decoded, as far as that could be determined when the decoder
+ * was created.
+ *
+ * \param decoder the decoder to query.
+ * \returns the number of sample frames in the file, or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety Do not use the same decoder from multiple threads at the
+ *               same time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_TellWAVDecoder
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetWAVDecoderLength(SDL_WAVDecoder *decoder);
+
+/**
+ * Destroy a WAVE decoder.
+ *
+ * If the decoder was created with `closeio` set to true, this also closes its
+ * data source.
+ *
+ * \param decoder the decoder to destroy, may be NULL.
+ *
+ * \threadsafety Do not use the same decoder from multiple threads at the
+ *               same time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateWAVDecoder
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyWAVDecoder(SDL_WAVDecoder *decoder);
+
 /**
  * Mix audio data in a specified format.
  *
@@ -1129,6 +1129,37 @@ typedef enum SDL_EventAction
 extern SDL_DECLSPEC int SDLCALL SDL_PeepEvents(SDL_Event *events, int numevents, SDL_EventAction action, Uint32 minType, Uint32 maxType);
 /* @} */
 
+/**
+ * Retrieve and remove events of any of a set of types from the event queue.
+ *
+ * Up to `numevents` events whose type is one of `types` are removed from the
+ * front of the event queue and returned to the caller, in the order they
+ * were queued. Events of other types are left in the queue. This is useful
+ * for draining a group of related events that aren't in a single range of
+ * types, like all keyboard and text input events, in one call without
+ * disturbing the rest of the queue.
+ *
+ * You may have to call SDL_PumpEvents() before calling this function.
+ * Otherwise, the events may not be ready to be retrieved when you call
+ * SDL_GetEventsByType().
+ *
+ * \param events destination buffer for the retrieved events.
+ * \param numevents the maximum number of events to retrieve.
+ * \param types an array of event types to be retrieved; see SDL_EventType
+ *              for details.
+ * \param numtypes the number of elements in `types`.
+ * \returns the number of events actually stored or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_PeepEvents
+ * \sa SDL_PumpEvents
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetEventsByType(SDL_Event *events, int numevents, const Uint32 *types, int numtypes);
+
 /**
  * Check for the existence of a certain event type in the event queue.
  *
@@ -37,6 +37,7 @@
 #ifndef SDL_hints_h_
 #define SDL_hints_h_
 
+#include <SDL3/SDL_atomic.h>
 #include <SDL3/SDL_error.h>
 #include <SDL3/SDL_stdinc.h>
 
@@ -286,6 +287,26 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_CATEGORY "SDL_AUDIO_CATEGORY"
 
+/**
+ * A variable controlling how much memory SDL keeps for reuse by audio
+ * streams.
+ *
+ * Audio streams queue their data in chunks. When a stream is done with a
+ * chunk it goes to a pool shared by all audio streams, so streaming doesn't
+ * need to allocate memory once the pool has enough chunks in it.
+ *
+ * The variable can be set to the size in bytes of the free chunks that SDL
+ * will keep. Chunks that don't fit in the pool are freed. This defaults to
+ * 1048576 (1 megabyte). "0" disables the pool.
+ *
+ * This hint should be set before any audio streams are created.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetAudioChunkPoolStats
+ */
+#define SDL_HINT_AUDIO_CHUNK_POOL_SIZE "SDL_AUDIO_CHUNK_POOL_SIZE"
+
 /**
  * A variable controlling the default audio channel count.
  *
@@ -522,6 +543,32 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_INCLUDE_MONITORS "SDL_AUDIO_INCLUDE_MONITORS"
 
+/**
+ * A variable controlling how many threads convert the audio streams bound to
+ * playback devices.
+ *
+ * By default each playback device thread pulls data from its bound streams
+ * one after another, so with many streams (especially ones that need
+ * resampling) a device can miss its deadline on slow CPUs. With mix threads,
+ * the streams for each device period are converted in parallel and the
+ * device thread adds up the results.
+ *
+ * Streams with a get callback are always converted on the device thread, so
+ * those callbacks still run there. A stream's data is always added to the
+ * mix in the same order, so the output is the same either way.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Streams are converted on the device thread. (default)
+ * - "N": Streams are converted on a pool of N threads shared by all playback
+ *   devices.
+ *
+ * This hint should be set before the audio subsystem is initialized.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_AUDIO_MIX_THREADS "SDL_AUDIO_MIX_THREADS"
+
 /**
  * A variable controlling whether SDL updates joystick state when getting
  * input events.
@@ -3180,6 +3227,29 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling how many threads are used to convert pixels.
+ *
+ * When this is greater than one, SDL_ConvertPixelsAndColorspace() and
+ * SDL_ConvertSurfaceAndColorspace() split large images into horizontal bands
+ * which are converted in parallel. The result is identical to converting on
+ * a single thread. Conversions to or from YUV formats are not split.
+ *
+ * The threads are started by the first conversion that uses them, and kept
+ * until SDL_Quit() is called.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Use one thread per logical CPU core.
+ * - "1": Convert on the calling thread only. (default)
+ * - "N": Use up to N threads, including the calling thread.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_SURFACE_CONVERSION_THREADS "SDL_SURFACE_CONVERSION_THREADS"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as
  * realtime.
@@ -3232,6 +3302,28 @@ extern "C" {
  */
 #define SDL_HINT_THREAD_PRIORITY_POLICY "SDL_THREAD_PRIORITY_POLICY"
 
+/**
+ * A variable controlling how many threads run timer callbacks.
+ *
+ * By default every timer callback runs on a single timer thread, so one slow
+ * callback delays every other timer. With dispatch threads, the timer thread
+ * still decides when timers are due, but hands their callbacks to a pool of
+ * threads. A timer's callback never runs concurrently with itself, but
+ * callbacks for different timers may run at the same time, so they must not
+ * rely on being serialized with each other.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Timer callbacks run on the timer thread. (default)
+ * - "N": Timer callbacks run on a pool of N dispatch threads.
+ *
+ * This hint should be set before SDL_AddTimer() or SDL_AddTimerNS() is first
+ * called, or before the timer subsystem is reinitialized after SDL_Quit().
+ *
+ * \since This hint is available since SDL 3.4.0.
+ */
+#define SDL_HINT_TIMER_DISPATCH_THREADS "SDL_TIMER_DISPATCH_THREADS"
+
 /**
  * A variable that controls the timer resolution, in milliseconds.
  *
@@ -4495,6 +4587,68 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetHint(const char *name);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetHintBoolean(const char *name, bool default_value);
 
+/**
+ * Get the current hint generation.
+ *
+ * The generation changes each time the value of any hint might have changed,
+ * including when an environment variable is changed in the environment
+ * returned by SDL_GetEnvironment(). If the generation is the same as when a
+ * hint was last read, the hint still has the same value.
+ *
+ * This lets code that checks hints often, like once per event or per frame,
+ * keep the values it parsed and check whether they're still valid with a
+ * single atomic load. The generation is never 0, so 0 can be used to mean
+ * that nothing has been read yet. The lowest bit is always 0, so it can be
+ * stored with a boolean value in the same atomic variable.
+ *
+ * \returns the current hint generation.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetCachedHintBoolean
+ */
+extern SDL_DECLSPEC Uint32 SDLCALL SDL_GetHintGeneration(void);
+
+/**
+ * A cached boolean value of a hint.
+ *
+ * Initialize this to zero, and use it with SDL_GetCachedHintBoolean(),
+ * always with the same hint name and default value.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetCachedHintBoolean
+ */
+typedef struct SDL_HintCache
+{
+    SDL_AtomicU32 state;    /**< the hint generation the value was read at, with the value in the lowest bit */
+} SDL_HintCache;
+
+/**
+ * Get the boolean value of a hint variable, using a cached value if the hint
+ * hasn't changed.
+ *
+ * This returns the same value as SDL_GetHintBoolean(), but only looks up the
+ * hint when the hint generation has changed since it was last cached.
+ *
+ * \param name the name of the hint to get the boolean value from.
+ * \param default_value the value to return if the hint does not exist.
+ * \param cache the cached value of the hint, initialized to zero.
+ * \returns the boolean value of a hint or the provided default value if the
+ *          hint does not exist.
+ *
+ * \threadsafety It is safe to call this function from any thread, and to
+ *               share `cache` between threads.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetHintBoolean
+ * \sa SDL_GetHintGeneration
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetCachedHintBoolean(const char *name, bool default_value, SDL_HintCache *cache);
+
 /**
  * A callback used to send notifications of hint value changes.
  *
@@ -65,12 +65,17 @@
  *
  * Each log call is atomic, so you won't see log messages cut off one another
  * when logging from multiple threads.
+ *
+ * Messages can be written from a separate thread with SDL_SetLogAsync(), so
+ * threads that log don't wait for the output to be written, or captured
+ * without being formatted with SDL_SetLogDeferred().
  */
 
 #ifndef SDL_log_h_
 #define SDL_log_h_
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_thread.h>
 
 #include <SDL3/SDL_begin_code.h>
 /* Set up for C function definitions, even when using C++ */
@@ -528,6 +533,224 @@ extern SDL_DECLSPEC void SDLCALL SDL_GetLogOutputFunction(SDL_LogOutputFunction
  */
 extern SDL_DECLSPEC void SDLCALL SDL_SetLogOutputFunction(SDL_LogOutputFunction callback, void *userdata);
 
+/**
+ * What happens to log messages when the asynchronous log queue is full.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetLogAsync
+ */
+typedef enum SDL_LogOverflowPolicy
+{
+    SDL_LOG_OVERFLOW_DROP,  /**< The message is thrown away and counted in SDL_LogAsyncStats::dropped. */
+    SDL_LOG_OVERFLOW_BLOCK  /**< The logging thread waits until the writer thread makes room. */
+} SDL_LogOverflowPolicy;
+
+/**
+ * Send log messages to the output function from a separate thread.
+ *
+ * Normally the log output function is called by the thread that logs the
+ * message, and threads that log at the same time wait for each other while
+ * the output is written. In asynchronous mode, messages are formatted by the
+ * logging thread and put in a queue, and a writer thread calls the output
+ * function, so logging doesn't wait on slow console or file output.
+ *
+ * The output function is still never called by more than one thread at once,
+ * and messages logged by one thread are written in the order they were
+ * logged. Messages that are queued when the output function is changed are
+ * written with the new one.
+ *
+ * Disabling asynchronous mode writes out any messages that are still queued
+ * before returning. SDL_Quit() does this too.
+ *
+ * \param enabled true to write log messages from a separate thread, false to
+ *                write them from the thread that logs them.
+ * \param policy what to do with messages when the queue is full. This can be
+ *               changed while asynchronous mode is enabled.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetLogAsyncStats
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetLogAsync(bool enabled, SDL_LogOverflowPolicy policy);
+
+/**
+ * Statistics about asynchronous logging.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetLogAsyncStats
+ */
+typedef struct SDL_LogAsyncStats
+{
+    int capacity;       /**< the number of messages the queue holds, 0 if asynchronous logging is disabled */
+    int queued;         /**< the number of messages waiting to be written right now */
+    Uint32 written;     /**< the number of messages the writer thread passed to the output function */
+    Uint32 dropped;     /**< the number of messages thrown away because the queue, or a thread's buffer of deferred log records, was full */
+    Uint32 blocked;     /**< the number of times a thread waited because the queue was full */
+} SDL_LogAsyncStats;
+
+/**
+ * Get statistics about asynchronous logging.
+ *
+ * The counters start at zero when the program starts, or from the last time
+ * they were reset, and keep their values when asynchronous mode is disabled.
+ *
+ * If `dropped` or `blocked` keep going up, messages are logged faster than
+ * the output function can write them.
+ *
+ * \param stats a pointer filled in with the statistics.
+ * \param reset true to clear the counters after reading them.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetLogAsync
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetLogAsyncStats(SDL_LogAsyncStats *stats, bool reset);
+
+/**
+ * A log message that was captured without being formatted.
+ *
+ * The arguments are stored one after another, in the order the format string
+ * uses them, and each one starts on an 8-byte boundary from the start of
+ * `args`:
+ *
+ * - `*` widths and precisions, `%c`, and signed integer conversions: a
+ *   Sint64, after converting the argument to the type given by the length
+ *   modifier, so `%hhd` of 300 is stored as 44.
+ * - unsigned integer conversions: a Uint64, converted the same way.
+ * - floating point conversions: a double.
+ * - `%p`: a Uint64 holding the pointer.
+ * - `%s`: a Uint32 length in bytes, followed by the string and a zero
+ *   terminator. A NULL string has a length of 0xFFFFFFFF and nothing after
+ *   it.
+ *
+ * Values are in the byte order of the machine that logged the message.
+ *
+ * Messages that use anything else, such as wide strings, `long double`, or
+ * `%n`, or that are too long to capture, are formatted when they are logged
+ * and captured with a format of `"%s"` and the text as the argument. Long
+ * messages are cut short when this happens.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_FormatLogRecord
+ * \sa SDL_ReadLogRecords
+ */
+typedef struct SDL_LogRecord
+{
+    Uint64 timestamp;           /**< the time the message was logged, from SDL_GetTicksNS() */
+    SDL_ThreadID thread;        /**< the thread that logged the message */
+    int category;               /**< the category of the message */
+    SDL_LogPriority priority;   /**< the priority of the message */
+    const char *fmt;            /**< the format string passed to the log function */
+    const void *args;           /**< the arguments to the format string, stored as described above */
+    int args_size;              /**< the size of `args`, in bytes */
+} SDL_LogRecord;
+
+/**
+ * The prototype for a function that is given captured log records.
+ *
+ * \param userdata what was passed as `userdata` to SDL_ReadLogRecords().
+ * \param record the log record, which is only valid until this function
+ *               returns.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadLogRecords
+ */
+typedef void (SDLCALL *SDL_LogRecordFunction)(void *userdata, const SDL_LogRecord *record);
+
+/**
+ * Capture log messages as records instead of formatting them.
+ *
+ * Formatting a message usually costs more than anything else SDL does to log
+ * it. In deferred mode, messages that pass the priority check are captured
+ * as an SDL_LogRecord in a buffer that belongs to the logging thread, and
+ * nothing else is done with them until SDL_ReadLogRecords() is called. The
+ * records can be formatted then, or saved as they are and formatted by
+ * another program later.
+ *
+ * Only a pointer to the format string is kept, so format strings must stay
+ * valid until the record is read. String literals are always fine, but a
+ * message that uses a format string built at runtime should be logged with a
+ * format of `"%s"` instead.
+ *
+ * If a thread's buffer fills up, its messages are dropped and counted in
+ * SDL_LogAsyncStats::dropped until the records are read.
+ *
+ * Disabling deferred mode formats any records that haven't been read and
+ * sends them to the log output function. SDL_Quit() does this too.
+ *
+ * \param enabled true to capture log messages as records, false to format
+ *                them as they're logged.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadLogRecords
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetLogDeferred(bool enabled);
+
+/**
+ * Read the log records that have been captured in deferred mode.
+ *
+ * Each thread's records are passed to `callback` in the order they were
+ * logged, one thread at a time. Records from different threads aren't sorted,
+ * use their timestamps to put them in order if needed.
+ *
+ * The callback should not take long, since threads can't capture records in
+ * the space that is being read. Log messages from inside the callback are
+ * captured too, and are read by the next call to this function.
+ *
+ * \param callback the function to call for each record, or NULL to format
+ *                 the records and send them to the log output function.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns the number of records that were read.
+ *
+ * \threadsafety It is safe to call this function from any thread, and calls
+ *               from different threads take turns.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_FormatLogRecord
+ * \sa SDL_SetLogDeferred
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_ReadLogRecords(SDL_LogRecordFunction callback, void *userdata);
+
+/**
+ * Format a captured log record into text.
+ *
+ * This produces the same text that SDL_snprintf() would have produced from
+ * the format string and arguments when the message was logged.
+ *
+ * \param record the log record to format.
+ * \param text the buffer to write the message into, may be NULL if `maxlen`
+ *             is 0.
+ * \param maxlen the size of `text`, in bytes.
+ * \returns the length of the message, not counting the null terminator,
+ *          which may be more than `maxlen` if it didn't fit, or -1 if the
+ *          record is damaged; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ReadLogRecords
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_FormatLogRecord(const SDL_LogRecord *record, char *text, size_t maxlen);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
@@ -65,6 +65,21 @@ extern "C" {
  */
 typedef Uint32 SDL_PropertiesID;
 
+/**
+ * A property name that has been looked up in advance.
+ *
+ * Getting and setting properties by key is faster than by name, because the
+ * name doesn't have to be hashed and compared each time. This is useful for
+ * properties that are queried often, like every frame.
+ *
+ * The value 0 is an invalid key.
+ *
+ * \since This datatype is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ */
+typedef Uint32 SDL_PropertyKey;
+
 /**
  * SDL property type
  *
@@ -137,6 +152,10 @@ extern SDL_DECLSPEC bool SDLCALL SDL_CopyProperties(SDL_PropertiesID src, SDL_Pr
  * or want to guarantee that properties being queried aren't freed in another
  * thread.
  *
+ * Queries share the lock, so threads getting properties at the same time
+ * don't wait on each other, but they do wait while the properties are locked
+ * with this function or are being set.
+ *
  * \param props the properties to lock.
  * \returns true on success or false on failure; call SDL_GetError() for more
  *          information.
@@ -479,6 +498,324 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetBooleanProperty(SDL_PropertiesID props,
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_ClearProperty(SDL_PropertiesID props, const char *name);
 
+/**
+ * Get the key for a property name.
+ *
+ * The key can be used to get and set the property with that name in any
+ * group of properties. Calling this again with the same name returns the
+ * same key.
+ *
+ * The name is stored until SDL_Quit() is called, so this should be used for
+ * a fixed set of names, not names that are generated as the program runs.
+ * Keys are no longer valid after SDL_Quit() is called.
+ *
+ * \param name the name of the property.
+ * \returns a key for the name or 0 on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKeyName
+ */
+extern SDL_DECLSPEC SDL_PropertyKey SDLCALL SDL_GetPropertyKey(const char *name);
+
+/**
+ * Get the name of a property key.
+ *
+ * \param key the key to query.
+ * \returns the name of the property, or NULL if the key isn't valid; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC const char * SDLCALL SDL_GetPropertyKeyName(SDL_PropertyKey key);
+
+/**
+ * Set a pointer property with a cleanup function, using a property key.
+ *
+ * This works like SDL_SetPointerPropertyWithCleanup(), using a key instead
+ * of a name.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify.
+ * \param value the new value of the property, or NULL to delete the property.
+ * \param cleanup the function to call when this property is deleted, or NULL if
+ *                no cleanup is necessary.
+ * \param userdata a pointer that is passed to the cleanup function.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetPointerPropertyWithCleanup
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetPointerPropertyWithCleanupByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata);
+
+/**
+ * Set a pointer property in a group of properties, using a property key.
+ *
+ * This works like SDL_SetPointerProperty(), using a key instead of a name.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify.
+ * \param value the new value of the property, or NULL to delete the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetPointerProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetPointerPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *value);
+
+/**
+ * Set a string property in a group of properties, using a property key.
+ *
+ * This works like SDL_SetStringProperty(), using a key instead of a name.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify.
+ * \param value the new value of the property, or NULL to delete the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetStringProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, const char *value);
+
+/**
+ * Set a number property in a group of properties, using a property key.
+ *
+ * This works like SDL_SetNumberProperty(), using a key instead of a name.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetNumberProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, Sint64 value);
+
+/**
+ * Set a float property in a group of properties, using a property key.
+ *
+ * This works like SDL_SetFloatProperty(), using a key instead of a name.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetFloatProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, float value);
+
+/**
+ * Set a boolean property in a group of properties, using a property key.
+ *
+ * This works like SDL_SetBooleanProperty(), using a key instead of a name.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify.
+ * \param value the new value of the property.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_SetBooleanProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, bool value);
+
+/**
+ * Return whether a property exists, using a property key.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query.
+ * \returns true if the property exists, or false if it doesn't.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_HasProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_HasPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key);
+
+/**
+ * Get the type of a property in a group of properties, using a property key.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query.
+ * \returns the type of the property, or SDL_PROPERTY_TYPE_INVALID if it is
+ *          not set.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPropertyType
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC SDL_PropertyType SDLCALL SDL_GetPropertyTypeByKey(SDL_PropertiesID props, SDL_PropertyKey key);
+
+/**
+ * Get a pointer property from a group of properties, using a property key.
+ *
+ * This works like SDL_GetPointerProperty(), using a key instead of a name.
+ *
+ * The returned value is valid as long as it would be for
+ * SDL_GetPointerProperty().
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a pointer property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetPointerProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_GetPointerPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *default_value);
+
+/**
+ * Get a string property from a group of properties, using a property key.
+ *
+ * This works like SDL_GetStringProperty(), using a key instead of a name.
+ *
+ * The returned value is valid as long as it would be for
+ * SDL_GetStringProperty().
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a string property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetStringProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC const char * SDLCALL SDL_GetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, const char *default_value);
+
+/**
+ * Get a number property from a group of properties, using a property key.
+ *
+ * This works like SDL_GetNumberProperty(), using a key instead of a name.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a number property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetNumberProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, Sint64 default_value);
+
+/**
+ * Get a float property from a group of properties, using a property key.
+ *
+ * This works like SDL_GetFloatProperty(), using a key instead of a name.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a float property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetFloatProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC float SDLCALL SDL_GetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, float default_value);
+
+/**
+ * Get a boolean property from a group of properties, using a property key.
+ *
+ * This works like SDL_GetBooleanProperty(), using a key instead of a name.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query.
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a boolean property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetBooleanProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, bool default_value);
+
+/**
+ * Clear a property from a group of properties, using a property key.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to clear.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_ClearProperty
+ * \sa SDL_GetPropertyKey
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ClearPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key);
+
 /**
  * A callback used to enumerate all the properties in a group of properties.
  *
@@ -1558,6 +1558,44 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SetMemoryFunctions(SDL_malloc_func malloc_f
                                                             SDL_realloc_func realloc_func,
                                                             SDL_free_func free_func);
 
+/**
+ * Get a set of SDL memory functions that cache small allocations per thread.
+ *
+ * These functions are built on the original SDL memory functions. Freed
+ * blocks of up to 1024 bytes are kept on a list belonging to the thread that
+ * freed them, grouped by size, and are handed out again by later allocations
+ * on that thread. Blocks move between threads in batches through a shared
+ * pool, so threads that allocate and free a lot rarely contend on the
+ * allocator's lock. Memory can be freed on a different thread than the one
+ * that allocated it.
+ *
+ * These are the original memory functions if SDL was built with
+ * `SDL_MALLOC_THREAD_CACHE`. Otherwise, pass them to SDL_SetMemoryFunctions()
+ * before any allocations are made to use them. On platforms without
+ * compiler support for thread-local variables, these are the original memory
+ * functions without a cache.
+ *
+ * Blocks cached by a thread created with SDL_CreateThread() are released when
+ * the thread exits. Other threads keep their cached blocks until the program
+ * exits.
+ *
+ * \param malloc_func filled with malloc function.
+ * \param calloc_func filled with calloc function.
+ * \param realloc_func filled with realloc function.
+ * \param free_func filled with free function.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetOriginalMemoryFunctions
+ * \sa SDL_SetMemoryFunctions
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GetThreadCacheMemoryFunctions(SDL_malloc_func *malloc_func,
+                                                               SDL_calloc_func *calloc_func,
+                                                               SDL_realloc_func *realloc_func,
+                                                               SDL_free_func *free_func);
+
 /**
  * Allocate memory aligned to a specific alignment.
  *
@@ -1612,6 +1650,197 @@ extern SDL_DECLSPEC void SDLCALL SDL_aligned_free(void *mem);
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
 
+/**
+ * The parts of SDL that memory statistics are kept for.
+ *
+ * Memory that SDL allocates is counted under the subsystem that allocated
+ * it, and memory allocated with SDL_malloc(), SDL_calloc() and SDL_realloc()
+ * by the application is counted under SDL_MEMORY_TAG_OTHER.
+ *
+ * Counting each subsystem separately is a build option, and if SDL wasn't
+ * built with it, all memory is counted under SDL_MEMORY_TAG_OTHER.
+ *
+ * \since This enum is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+typedef enum SDL_MemoryTag
+{
+    SDL_MEMORY_TAG_ALL,         /**< All memory allocated with SDL_malloc() and friends */
+    SDL_MEMORY_TAG_OTHER,       /**< Memory allocated by the application, or by no subsystem in particular */
+    SDL_MEMORY_TAG_AUDIO,       /**< Memory allocated by the audio subsystem */
+    SDL_MEMORY_TAG_VIDEO,       /**< Memory allocated by the video subsystem */
+    SDL_MEMORY_TAG_RENDER,      /**< Memory allocated by the 2D rendering API */
+    SDL_MEMORY_TAG_EVENTS,      /**< Memory allocated by the event subsystem */
+    SDL_MEMORY_TAG_GPU,         /**< Memory allocated by the GPU API */
+    SDL_MEMORY_TAG_JOYSTICK,    /**< Memory allocated by the joystick, gamepad and haptic subsystems */
+    SDL_MEMORY_TAG_COUNT        /**< The number of memory tags, not a valid tag */
+} SDL_MemoryTag;
+
+/**
+ * Memory statistics for one SDL_MemoryTag.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+typedef struct SDL_MemoryStats
+{
+    Uint64 live_bytes;          /**< The number of bytes allocated and not yet freed */
+    Uint64 live_allocations;    /**< The number of allocations not yet freed */
+    Uint64 peak_bytes;          /**< The highest live_bytes has been since statistics were enabled or reset */
+    Uint64 total_allocations;   /**< The number of allocations and reallocations since statistics were enabled or reset */
+} SDL_MemoryStats;
+
+/**
+ * Start keeping statistics on memory allocated with SDL_malloc() and friends.
+ *
+ * Statistics need a small header on every allocation, so they can only be
+ * enabled before anything has been allocated: this should be the first SDL
+ * function the application calls. Once enabled, they can't be disabled.
+ *
+ * Statistics are kept in front of the memory functions set with
+ * SDL_SetMemoryFunctions(), so those functions will see slightly larger
+ * allocations than SDL asked for.
+ *
+ * \returns true on success or false if memory has already been allocated;
+ *          call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but it
+ *               fails once any thread has allocated memory, so it should be
+ *               called before any other SDL function.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMemoryStats
+ * \sa SDL_ResetMemoryStats
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_EnableMemoryStats(void);
+
+/**
+ * Get the memory statistics for a part of SDL.
+ *
+ * Comparing live bytes over time shows memory growth in long running
+ * programs, and live allocations left after SDL_Quit() are leaks.
+ *
+ * \param tag the part of SDL to get statistics for, or SDL_MEMORY_TAG_ALL
+ *            for all memory allocated with SDL_malloc() and friends.
+ * \param stats filled in with the statistics.
+ * \returns true on success or false if statistics aren't enabled; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_EnableMemoryStats
+ * \sa SDL_ResetMemoryStats
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetMemoryStats(SDL_MemoryTag tag, SDL_MemoryStats *stats);
+
+/**
+ * Reset the memory statistics that cover a period of time.
+ *
+ * The peak bytes are set to the live bytes, and the total allocations are
+ * set to zero, for every tag. The live counts aren't changed.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ResetMemoryStats(void);
+
+/**
+ * An arena that hands out memory by advancing a pointer.
+ *
+ * All the memory allocated from an arena is released at once, by resetting or
+ * destroying the arena, which makes it a good fit for memory that's only
+ * needed for a short, well defined time, like one frame.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateMemoryArena
+ * \sa SDL_AllocateArenaMemory
+ * \sa SDL_ResetMemoryArena
+ * \sa SDL_DestroyMemoryArena
+ */
+typedef struct SDL_MemoryArena SDL_MemoryArena;
+
+/**
+ * Create a memory arena.
+ *
+ * The arena gets memory from SDL_malloc() in blocks of `block_size` bytes,
+ * or bigger if a single allocation needs it. Allocations from a block cost
+ * little more than advancing a pointer.
+ *
+ * \param block_size the size of the blocks the arena allocates, or 0 for a
+ *                   default size of 4096 bytes.
+ * \returns a new memory arena or NULL on failure; call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AllocateArenaMemory
+ * \sa SDL_DestroyMemoryArena
+ */
+extern SDL_DECLSPEC SDL_MemoryArena * SDLCALL SDL_CreateMemoryArena(size_t block_size);
+
+/**
+ * Allocate memory from a memory arena.
+ *
+ * The memory is aligned like memory from SDL_malloc(), and stays valid until
+ * the arena is reset or destroyed. It must not be passed to SDL_free().
+ *
+ * \param arena the memory arena to allocate from.
+ * \param size the size to allocate.
+ * \returns a pointer to the allocated memory, or NULL if allocation failed;
+ *          call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but an
+ *               arena should only be used by one thread at a time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateMemoryArena
+ * \sa SDL_ResetMemoryArena
+ */
+extern SDL_DECLSPEC SDL_MALLOC void * SDLCALL SDL_AllocateArenaMemory(SDL_MemoryArena *arena, size_t size);
+
+/**
+ * Release all the memory allocated from a memory arena.
+ *
+ * The arena keeps the blocks it allocated, so allocations after a reset
+ * reuse them instead of allocating more memory.
+ *
+ * \param arena the memory arena to reset.
+ *
+ * \threadsafety It is safe to call this function from any thread, but an
+ *               arena should only be used by one thread at a time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AllocateArenaMemory
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ResetMemoryArena(SDL_MemoryArena *arena);
+
+/**
+ * Destroy a memory arena and all the memory allocated from it.
+ *
+ * \param arena the memory arena to destroy, may be NULL.
+ *
+ * \threadsafety It is safe to call this function from any thread, but an
+ *               arena should only be used by one thread at a time.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_CreateMemoryArena
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyMemoryArena(SDL_MemoryArena *arena);
+
 /**
  * A thread-safe set of environment variables
  *
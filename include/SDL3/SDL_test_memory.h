@@ -50,6 +50,17 @@ void SDLCALL SDLTest_TrackAllocations(void);
  */
 void SDLCALL SDLTest_RandFillAllocations(void);
 
+/**
+ * Get the number of allocations made since tracking started
+ *
+ * This counts every successful call to SDL_malloc(), SDL_calloc() and
+ * SDL_realloc(), so the difference between two calls is the number of times
+ * the code in between went to the heap.
+ *
+ * \returns the number of allocations, or -1 if SDLTest_TrackAllocations() hasn't been called
+ */
+int SDLCALL SDLTest_GetAllocationCount(void);
+
 /**
  * Print a log of any outstanding allocations
  *
@@ -443,6 +443,55 @@ extern SDL_DECLSPEC SDL_TimerID SDLCALL SDL_AddTimerNS(Uint64 interval, SDL_NSTi
 extern SDL_DECLSPEC bool SDLCALL SDL_RemoveTimer(SDL_TimerID id);
 
 
+/**
+ * The number of buckets in an SDL_TimerLatencyHistogram.
+ *
+ * \since This macro is available since SDL 3.4.0.
+ */
+#define SDL_TIMER_LATENCY_BUCKETS 16
+
+/**
+ * A histogram of how late timer callbacks ran.
+ *
+ * The latency of a callback is the time between when it was scheduled to run
+ * and when it actually started running.
+ *
+ * `buckets[0]` counts callbacks that ran less than 1 microsecond late.
+ * `buckets[N]` counts callbacks that ran at least 2^(N-1) and less than 2^N
+ * microseconds late. The last bucket also counts every callback that ran
+ * later than that.
+ *
+ * \since This struct is available since SDL 3.4.0.
+ *
+ * \sa SDL_GetTimerLatencyHistogram
+ */
+typedef struct SDL_TimerLatencyHistogram
+{
+    Uint64 count;       /**< the number of callbacks that have run */
+    Uint64 total_ns;    /**< the sum of all latencies, in nanoseconds */
+    Uint64 max_ns;      /**< the largest latency, in nanoseconds */
+    Uint64 buckets[SDL_TIMER_LATENCY_BUCKETS];  /**< the number of callbacks in each latency range */
+} SDL_TimerLatencyHistogram;
+
+/**
+ * Get a histogram of how late timer callbacks have run.
+ *
+ * Statistics are collected for every timer callback from the time the timer
+ * subsystem is initialized, or from the last time they were reset.
+ *
+ * \param histogram a pointer filled in with the timer latency statistics.
+ * \param reset true to clear the statistics after reading them.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_AddTimerNS
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetTimerLatencyHistogram(SDL_TimerLatencyHistogram *histogram, bool reset);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
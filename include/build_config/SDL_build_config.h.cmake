@@ -237,6 +237,9 @@
 #define SDL_DEFAULT_ASSERT_LEVEL @SDL_DEFAULT_ASSERT_LEVEL@
 #endif
 
+/* Use SDL_GetThreadCacheMemoryFunctions() for SDL_malloc() by default */
+#cmakedefine SDL_MALLOC_THREAD_CACHE 1
+
 /* Allow disabling of major subsystems */
 #cmakedefine SDL_AUDIO_DISABLED 1
 #cmakedefine SDL_VIDEO_DISABLED 1
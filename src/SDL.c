@@ -40,6 +40,7 @@
 #include "SDL_hints_c.h"
 #include "SDL_log_c.h"
 #include "SDL_properties_c.h"
+#include "audio/SDL_audioqueue.h"
 #include "audio/SDL_sysaudio.h"
 #include "camera/SDL_camera_c.h"
 #include "cpuinfo/SDL_cpuinfo_c.h"
@@ -50,6 +51,7 @@
 #include "render/SDL_sysrender.h"
 #include "sensor/SDL_sensor_c.h"
 #include "stdlib/SDL_getenv_c.h"
+#include "stdlib/SDL_sysstdlib.h"
 #include "thread/SDL_thread_c.h"
 #include "tray/SDL_tray_utils.h"
 #include "video/SDL_pixels_c.h"
@@ -279,6 +281,7 @@ void SDL_InitMainThread(void)
     SDL_InitEnvironment();
     SDL_InitTicks();
     SDL_InitFilesystem();
+    SDL_ChooseMemoryFunctionsSIMD();
 
     if (!done_info) {
         const char *value;
@@ -665,12 +668,15 @@ void SDL_Quit(void)
 
     SDL_QuitTimers();
     SDL_QuitAsyncIO();
+    SDL_QuitSurfaceConversionThreads();
 
     SDL_SetObjectsInvalid();
     SDL_AssertionsQuit();
 
     SDL_QuitPixelFormatDetails();
 
+    SDL_QuitAudioChunkPool();
+
     SDL_QuitCPUInfo();
 
     /* Now that every subsystem has been quit, we reset the subsystem refcount
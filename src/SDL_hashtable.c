@@ -20,36 +20,145 @@
 */
 #include "SDL_internal.h"
 
-typedef struct SDL_HashItem
-{
-    // TODO: Splitting off values into a separate array might be more cache-friendly
-    const void *key;
-    const void *value;
-    Uint32 hash;
-    Uint32 probe_len : 31;
-    Uint32 live : 1;
-} SDL_HashItem;
-
-// Must be a power of 2 >= sizeof(SDL_HashItem)
-#define MAX_HASHITEM_SIZEOF 32u
-SDL_COMPILE_TIME_ASSERT(sizeof_SDL_HashItem, sizeof(SDL_HashItem) <= MAX_HASHITEM_SIZEOF);
+/* This is a "Swiss table": each bucket has a control byte, kept in an array
+ * separate from the keys and values. A control byte is either EMPTY, DELETED,
+ * or, for a live item, the top 7 bits of its hash. Lookups compare a whole
+ * group of control bytes against the hash at once, so the keys (and the
+ * keymatch callback) are only touched for buckets that very likely match.
+ *
+ * The control bytes of the first group are mirrored after the end of the
+ * array, so a group can be loaded starting at any bucket without wrapping.
+ */
+#define CTRL_EMPTY   0x80
+#define CTRL_DELETED 0xFE
+#define GROUP_SIZE   16
+
+#define CTRL_IS_FULL(c) (((c) & 0x80) == 0)
 
 // Anything larger than this will cause integer overflows
-#define MAX_HASHTABLE_SIZE (0x80000000u / (MAX_HASHITEM_SIZEOF))
+#define MAX_HASHTABLE_SIZE (0x80000000u / 32u)
 
 struct SDL_HashTable
 {
     SDL_RWLock *lock;  // NULL if not created threadsafe
-    SDL_HashItem *table;
+    Uint8 *ctrl;       // hash_mask + 1 + GROUP_SIZE control bytes
+    const void **keys;
+    const void **values;
     SDL_HashCallback hash;
     SDL_HashKeyMatchCallback keymatch;
     SDL_HashDestroyCallback destroy;
     void *userdata;
     Uint32 hash_mask;
-    Uint32 max_probe_len;
     Uint32 num_occupied_slots;
+    Uint32 growth_left;  // EMPTY buckets that can still be filled before resizing
 };
 
+/* A group mask has a bit (or, with NEON, a nibble) set for each bucket in a
+ * group that matched.
+ */
+#if defined(SDL_SSE2_INTRINSICS) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+
+typedef Uint32 GroupMask;
+#define GROUP_MASK_SHIFT 0
+
+static SDL_INLINE GroupMask match_byte(const Uint8 *ctrl, Uint8 value)
+{
+    const __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+    return (GroupMask)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)value)));
+}
+
+static SDL_INLINE GroupMask match_empty_or_deleted(const Uint8 *ctrl)
+{
+    // EMPTY and DELETED are the only control bytes with the top bit set.
+    return (GroupMask)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+}
+
+#elif defined(SDL_NEON_INTRINSICS)
+
+typedef Uint64 GroupMask;
+#define GROUP_MASK_SHIFT 2
+
+static SDL_INLINE GroupMask neon_group_mask(uint8x16_t matches)
+{
+    // Narrow each byte of the comparison to a nibble, keeping one bit per bucket.
+    const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull;
+}
+
+static SDL_INLINE GroupMask match_byte(const Uint8 *ctrl, Uint8 value)
+{
+    return neon_group_mask(vceqq_u8(vld1q_u8(ctrl), vdupq_n_u8(value)));
+}
+
+static SDL_INLINE GroupMask match_empty_or_deleted(const Uint8 *ctrl)
+{
+    return neon_group_mask(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(ctrl)), vdupq_n_s8(0)));
+}
+
+#else
+
+typedef Uint32 GroupMask;
+#define GROUP_MASK_SHIFT 0
+
+static SDL_INLINE GroupMask match_byte(const Uint8 *ctrl, Uint8 value)
+{
+    GroupMask mask = 0;
+    for (int i = 0; i < GROUP_SIZE; ++i) {
+        mask |= (GroupMask)(ctrl[i] == value) << i;
+    }
+    return mask;
+}
+
+static SDL_INLINE GroupMask match_empty_or_deleted(const Uint8 *ctrl)
+{
+    GroupMask mask = 0;
+    for (int i = 0; i < GROUP_SIZE; ++i) {
+        mask |= (GroupMask)(ctrl[i] >> 7) << i;
+    }
+    return mask;
+}
+
+#endif
+
+static SDL_INLINE GroupMask match_empty(const Uint8 *ctrl)
+{
+    return match_byte(ctrl, CTRL_EMPTY);
+}
+
+// Index of the first matching bucket in a non-zero group mask
+static SDL_INLINE Uint32 group_first(GroupMask mask)
+{
+#if GROUP_MASK_SHIFT
+    const Uint32 low = (Uint32)mask;
+    if (!low) {
+        const Uint32 high = (Uint32)(mask >> 32);
+        return (32 + (Uint32)SDL_MostSignificantBitIndex32(high & (~high + 1))) >> GROUP_MASK_SHIFT;
+    }
+    return (Uint32)SDL_MostSignificantBitIndex32(low & (~low + 1)) >> GROUP_MASK_SHIFT;
+#else
+    return (Uint32)SDL_MostSignificantBitIndex32(mask & (~mask + 1));
+#endif
+}
+
+// Index of the last matching bucket in a non-zero group mask
+static SDL_INLINE Uint32 group_last(GroupMask mask)
+{
+#if GROUP_MASK_SHIFT
+    const Uint32 high = (Uint32)(mask >> 32);
+    if (high) {
+        return (32 + (Uint32)SDL_MostSignificantBitIndex32(high)) >> GROUP_MASK_SHIFT;
+    }
+    return (Uint32)SDL_MostSignificantBitIndex32((Uint32)mask) >> GROUP_MASK_SHIFT;
+#else
+    return (Uint32)SDL_MostSignificantBitIndex32(mask);
+#endif
+}
+
+// The maximum number of live and deleted buckets, 7/8 of the table.
+static SDL_INLINE Uint32 capacity_to_growth(Uint32 capacity)
+{
+    return (capacity < 8) ? (capacity - 1) : (capacity - capacity / 8);
+}
 
 static Uint32 CalculateHashBucketsFromEstimate(int estimated_capacity)
 {
@@ -57,13 +166,30 @@ static Uint32 CalculateHashBucketsFromEstimate(int estimated_capacity)
         return 4;  // start small, grow as necessary.
     }
 
-    const Uint32 estimated32 = (Uint32) estimated_capacity;
-    Uint32 buckets = ((Uint32) 1) << SDL_MostSignificantBitIndex32(estimated32);
-    if (!SDL_HasExactlyOneBitSet32(estimated32)) {
-        buckets <<= 1;  // need next power of two up to fit overflow capacity bits.
+    Uint32 buckets = 4;
+    while (buckets < MAX_HASHTABLE_SIZE && capacity_to_growth(buckets) < (Uint32)estimated_capacity) {
+        buckets <<= 1;
     }
 
-    return SDL_min(buckets, MAX_HASHTABLE_SIZE);
+    return buckets;
+}
+
+// Allocates control bytes, keys and values in one block.
+static bool allocate_buckets(SDL_HashTable *ht, Uint32 num_buckets)
+{
+    const size_t ctrl_size = ((size_t)num_buckets + GROUP_SIZE + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+    Uint8 *block = (Uint8 *)SDL_malloc(ctrl_size + (size_t)num_buckets * 2 * sizeof(void *));
+    if (!block) {
+        return false;
+    }
+
+    SDL_memset(block, CTRL_EMPTY, (size_t)num_buckets + GROUP_SIZE);
+    ht->ctrl = block;
+    ht->keys = (const void **)(block + ctrl_size);
+    ht->values = ht->keys + num_buckets;
+    ht->hash_mask = num_buckets - 1;
+    ht->growth_left = capacity_to_growth(num_buckets);
+    return true;
 }
 
 SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_HashCallback hash,
@@ -84,13 +210,11 @@ SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_
         }
     }
 
-    table->table = (SDL_HashItem *)SDL_calloc(num_buckets, sizeof(SDL_HashItem));
-    if (!table->table) {
+    if (!allocate_buckets(table, num_buckets)) {
         SDL_DestroyHashTable(table);
         return NULL;
     }
 
-    table->hash_mask = num_buckets - 1;
     table->userdata = userdata;
     table->hash = hash;
     table->keymatch = keymatch;
@@ -98,177 +222,130 @@ SDL_HashTable *SDL_CreateHashTable(int estimated_capacity, bool threadsafe, SDL_
     return table;
 }
 
-static SDL_INLINE Uint32 calc_hash(const SDL_HashTable *table, const void *key)
+static SDL_INLINE Uint32 mix_hash(Uint32 hash)
 {
     const Uint32 BitMixer = 0x9E3779B1u;
-    return table->hash(table->userdata, key) * BitMixer;
+    return hash * BitMixer;
 }
 
-static SDL_INLINE Uint32 get_probe_length(Uint32 zero_idx, Uint32 actual_idx, Uint32 num_buckets)
+static SDL_INLINE Uint32 calc_hash(const SDL_HashTable *table, const void *key)
 {
-    // returns the probe sequence length from zero_idx to actual_idx
-    if (actual_idx < zero_idx) {
-        return num_buckets - zero_idx + actual_idx;
-    }
-
-    return actual_idx - zero_idx;
+    return mix_hash(table->hash(table->userdata, key));
 }
 
-static SDL_HashItem *find_item(const SDL_HashTable *ht, const void *key, Uint32 hash, Uint32 *i, Uint32 *probe_len)
+// The low bits of the hash pick the first bucket, the top 7 bits go in the control byte.
+static SDL_INLINE Uint8 hash_ctrl(Uint32 hash)
 {
-    Uint32 hash_mask = ht->hash_mask;
-    Uint32 max_probe_len = ht->max_probe_len;
-
-    SDL_HashItem *table = ht->table;
-
-    while (true) {
-        SDL_HashItem *item = table + *i;
-        Uint32 item_hash = item->hash;
-
-        if (!item->live) {
-            return NULL;
-        }
-
-        if (item_hash == hash && ht->keymatch(ht->userdata, item->key, key)) {
-            return item;
-        }
-
-        Uint32 item_probe_len = item->probe_len;
-        SDL_assert(item_probe_len == get_probe_length(item_hash & hash_mask, (Uint32)(item - table), hash_mask + 1));
+    return (Uint8)(hash >> 25);
+}
 
-        if (*probe_len > item_probe_len) {
-            return NULL;
-        }
+static void set_ctrl(SDL_HashTable *ht, Uint32 idx, Uint8 ctrl)
+{
+    const Uint32 num_buckets = ht->hash_mask + 1;
 
-        if (++*probe_len > max_probe_len) {
-            return NULL;
-        }
+    ht->ctrl[idx] = ctrl;
 
-        *i = (*i + 1) & hash_mask;
+    // Update the mirrored copies. Small tables are mirrored more than once.
+    for (Uint32 mirror = idx + num_buckets; mirror < num_buckets + GROUP_SIZE; mirror += num_buckets) {
+        ht->ctrl[mirror] = ctrl;
     }
 }
 
-static SDL_HashItem *find_first_item(const SDL_HashTable *ht, const void *key, Uint32 hash)
+/* Groups are probed quadratically. Every table has an EMPTY bucket, and with
+ * a power of two number of buckets this visits every group, so it always ends.
+ */
+static Uint32 find_item(const SDL_HashTable *ht, const void *key, Uint32 hash)
 {
-    Uint32 i = hash & ht->hash_mask;
-    Uint32 probe_len = 0;
-    return find_item(ht, key, hash, &i, &probe_len);
-}
-
-static SDL_HashItem *insert_item(SDL_HashItem *item_to_insert, SDL_HashItem *table, Uint32 hash_mask, Uint32 *max_probe_len_ptr)
-{
-    const Uint32 num_buckets = hash_mask + 1;
-    Uint32 idx = item_to_insert->hash & hash_mask;
-    SDL_HashItem *target = NULL;
-    SDL_HashItem temp_item;
+    const Uint32 hash_mask = ht->hash_mask;
+    const Uint8 ctrl = hash_ctrl(hash);
+    Uint32 pos = hash & hash_mask;
+    Uint32 stride = 0;
 
     while (true) {
-        SDL_HashItem *candidate = table + idx;
-
-        if (!candidate->live) {
-            // Found an empty slot. Put it here and we're done.
-            *candidate = *item_to_insert;
+        const Uint8 *group = ht->ctrl + pos;
 
-            if (target == NULL) {
-                target = candidate;
+        for (GroupMask mask = match_byte(group, ctrl); mask; mask &= mask - 1) {
+            const Uint32 idx = (pos + group_first(mask)) & hash_mask;
+            if (ht->keymatch(ht->userdata, ht->keys[idx], key)) {
+                return idx;
             }
-
-            const Uint32 probe_len = get_probe_length(candidate->hash & hash_mask, idx, num_buckets);
-            candidate->probe_len = probe_len;
-
-            if (*max_probe_len_ptr < probe_len) {
-                *max_probe_len_ptr = probe_len;
-            }
-
-            break;
         }
 
-        const Uint32 candidate_probe_len = candidate->probe_len;
-        SDL_assert(candidate_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
-        const Uint32 new_probe_len = get_probe_length(item_to_insert->hash & hash_mask, idx, num_buckets);
-
-        if (candidate_probe_len < new_probe_len) {
-            // Robin Hood hashing: the item at idx has a better probe length than our item would at this position.
-            // Evict it and put our item in its place, then continue looking for a new spot for the displaced item.
-            // This algorithm significantly reduces clustering in the table, making lookups take very few probes.
-
-            temp_item = *candidate;
-            *candidate = *item_to_insert;
-
-            if (target == NULL) {
-                target = candidate;
-            }
+        if (match_empty(group)) {
+            return SDL_MAX_UINT32;
+        }
 
-            *item_to_insert = temp_item;
+        stride += GROUP_SIZE;
+        pos = (pos + stride) & hash_mask;
+    }
+}
 
-            SDL_assert(new_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
-            candidate->probe_len = new_probe_len;
+// Finds the first EMPTY or DELETED bucket on the probe sequence for hash.
+static Uint32 find_free_bucket(const SDL_HashTable *ht, Uint32 hash)
+{
+    const Uint32 hash_mask = ht->hash_mask;
+    Uint32 pos = hash & hash_mask;
+    Uint32 stride = 0;
 
-            if (*max_probe_len_ptr < new_probe_len) {
-                *max_probe_len_ptr = new_probe_len;
-            }
+    while (true) {
+        const GroupMask mask = match_empty_or_deleted(ht->ctrl + pos);
+        if (mask) {
+            return (pos + group_first(mask)) & hash_mask;
         }
 
-        idx = (idx + 1) & hash_mask;
+        stride += GROUP_SIZE;
+        pos = (pos + stride) & hash_mask;
     }
-
-    return target;
 }
 
-static void delete_item(SDL_HashTable *ht, SDL_HashItem *item)
+static void delete_item(SDL_HashTable *ht, Uint32 idx)
 {
     const Uint32 hash_mask = ht->hash_mask;
-    SDL_HashItem *table = ht->table;
 
     if (ht->destroy) {
-        ht->destroy(ht->userdata, item->key, item->value);
+        ht->destroy(ht->userdata, ht->keys[idx], ht->values[idx]);
     }
 
     SDL_assert(ht->num_occupied_slots > 0);
     ht->num_occupied_slots--;
 
-    Uint32 idx = (Uint32)(item - ht->table);
-
-    while (true) {
-        idx = (idx + 1) & hash_mask;
-        SDL_HashItem *next_item = table + idx;
-
-        if (next_item->probe_len < 1) {
-            SDL_zerop(item);
-            return;
-        }
-
-        *item = *next_item;
-        item->probe_len -= 1;
-        SDL_assert(item->probe_len < ht->max_probe_len);
-        item = next_item;
+    /* If every group that contains this bucket also has an EMPTY bucket, no
+     * probe ever went past this one while looking for an item, and it can be
+     * EMPTY again. Otherwise it has to stay DELETED so probes keep going.
+     */
+    const GroupMask empty_after = match_empty(ht->ctrl + idx);
+    const GroupMask empty_before = match_empty(ht->ctrl + ((idx - GROUP_SIZE) & hash_mask));
+    if (empty_after && empty_before &&
+        (GROUP_SIZE - 1 - group_last(empty_before)) + group_first(empty_after) < GROUP_SIZE) {
+        set_ctrl(ht, idx, CTRL_EMPTY);
+        ht->growth_left++;
+    } else {
+        set_ctrl(ht, idx, CTRL_DELETED);
     }
 }
 
 static bool resize(SDL_HashTable *ht, Uint32 new_size)
 {
-    const Uint32 new_hash_mask = new_size - 1;
-    SDL_HashItem *new_table = SDL_calloc(new_size, sizeof(*new_table));
+    SDL_HashTable old = *ht;
+    const Uint32 old_size = old.hash_mask + 1;
 
-    if (!new_table) {
+    if (!allocate_buckets(ht, new_size)) {
+        *ht = old;
         return false;
     }
 
-    SDL_HashItem *old_table = ht->table;
-    const Uint32 old_size = ht->hash_mask + 1;
-
-    ht->max_probe_len = 0;
-    ht->hash_mask = new_hash_mask;
-    ht->table = new_table;
-
     for (Uint32 i = 0; i < old_size; ++i) {
-        SDL_HashItem *item = old_table + i;
-        if (item->live) {
-            insert_item(item, new_table, new_hash_mask, &ht->max_probe_len);
+        if (CTRL_IS_FULL(old.ctrl[i])) {
+            const Uint32 hash = calc_hash(ht, old.keys[i]);
+            const Uint32 idx = find_free_bucket(ht, hash);
+            set_ctrl(ht, idx, hash_ctrl(hash));
+            ht->keys[idx] = old.keys[i];
+            ht->values[idx] = old.values[i];
         }
     }
+    ht->growth_left -= ht->num_occupied_slots;
 
-    SDL_free(old_table);
+    SDL_free(old.ctrl);
     return true;
 }
 
@@ -276,18 +353,20 @@ static bool maybe_resize(SDL_HashTable *ht)
 {
     const Uint32 capacity = ht->hash_mask + 1;
 
-    if (capacity >= MAX_HASHTABLE_SIZE) {
-        return false;
+    if (ht->growth_left > 0) {
+        return true;
     }
 
-    const Uint32 max_load_factor = 217; // range: 0-255; 217 is roughly 85%
-    const Uint32 resize_threshold = (Uint32)((max_load_factor * (Uint64)capacity) >> 8);
+    // If deleted buckets are taking up the space, clean them up instead of growing.
+    if (ht->num_occupied_slots <= capacity_to_growth(capacity) / 2) {
+        return resize(ht, capacity);
+    }
 
-    if (ht->num_occupied_slots > resize_threshold) {
-        return resize(ht, capacity * 2);
+    if (capacity >= MAX_HASHTABLE_SIZE) {
+        return SDL_SetError("hash table is full");
     }
 
-    return true;
+    return resize(ht, capacity * 2);
 }
 
 bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *value, bool replace)
@@ -301,33 +380,38 @@ bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *
     SDL_LockRWLockForWriting(table->lock);
 
     const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *item = find_first_item(table, key, hash);
-    bool do_insert = true;
+    Uint32 idx = find_item(table, key, hash);
 
-    if (item) {
+    if (idx != SDL_MAX_UINT32) {
         if (replace) {
-            delete_item(table, item);
+            // Reuse the bucket, nothing else about the table changes.
+            if (table->destroy) {
+                table->destroy(table->userdata, table->keys[idx], table->values[idx]);
+            }
+            table->keys[idx] = key;
+            table->values[idx] = value;
+            result = true;
         } else {
             SDL_SetError("key already exists and replace is disabled");
-            do_insert = false;
         }
-    }
-
-    if (do_insert) {
-        SDL_HashItem new_item;
-        new_item.key = key;
-        new_item.value = value;
-        new_item.hash = hash;
-        new_item.live = true;
-        new_item.probe_len = 0;
-
-        table->num_occupied_slots++;
+    } else {
+        idx = find_free_bucket(table, hash);
+        if (table->ctrl[idx] == CTRL_EMPTY && table->growth_left == 0) {
+            if (maybe_resize(table)) {
+                idx = find_free_bucket(table, hash);
+            } else {
+                idx = SDL_MAX_UINT32;
+            }
+        }
 
-        if (!maybe_resize(table)) {
-            table->num_occupied_slots--;
-        } else {
-            // This never returns NULL
-            insert_item(&new_item, table->table, table->hash_mask, &table->max_probe_len);
+        if (idx != SDL_MAX_UINT32) {
+            if (table->ctrl[idx] == CTRL_EMPTY) {
+                table->growth_left--;
+            }
+            set_ctrl(table, idx, hash_ctrl(hash));
+            table->keys[idx] = key;
+            table->values[idx] = value;
+            table->num_occupied_slots++;
             result = true;
         }
     }
@@ -336,6 +420,19 @@ bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *
     return result;
 }
 
+static bool find_value(const SDL_HashTable *table, const void *key, Uint32 hash, const void **value)
+{
+    bool result = false;
+    const Uint32 idx = find_item(table, key, hash);
+    if (idx != SDL_MAX_UINT32) {
+        if (value) {
+            *value = table->values[idx];
+        }
+        result = true;
+    }
+    return result;
+}
+
 bool SDL_FindInHashTable(const SDL_HashTable *table, const void *key, const void **value)
 {
     if (!table) {
@@ -346,17 +443,23 @@ bool SDL_FindInHashTable(const SDL_HashTable *table, const void *key, const void
     }
 
     SDL_LockRWLockForReading(table->lock);
+    const bool result = find_value(table, key, calc_hash(table, key), value);
+    SDL_UnlockRWLock(table->lock);
 
-    bool result = false;
-    const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *i = find_first_item(table, key, hash);
-    if (i) {
+    return result;
+}
+
+bool SDL_FindInHashTableWithHash(const SDL_HashTable *table, const void *key, Uint32 hash, const void **value)
+{
+    if (!table) {
         if (value) {
-            *value = i->value;
+            *value = NULL;
         }
-        result = true;
+        return SDL_InvalidParamError("table");
     }
 
+    SDL_LockRWLockForReading(table->lock);
+    const bool result = find_value(table, key, mix_hash(hash), value);
     SDL_UnlockRWLock(table->lock);
 
     return result;
@@ -372,9 +475,9 @@ bool SDL_RemoveFromHashTable(SDL_HashTable *table, const void *key)
 
     bool result = false;
     const Uint32 hash = calc_hash(table, key);
-    SDL_HashItem *item = find_first_item(table, key, hash);
-    if (item) {
-        delete_item(table, item);
+    const Uint32 idx = find_item(table, key, hash);
+    if (idx != SDL_MAX_UINT32) {
+        delete_item(table, idx);
         result = true;
     }
 
@@ -391,15 +494,14 @@ bool SDL_IterateHashTable(const SDL_HashTable *table, SDL_HashTableIterateCallba
     }
 
     SDL_LockRWLockForReading(table->lock);
-    SDL_HashItem *end = table->table + (table->hash_mask + 1);
+    const Uint32 num_buckets = table->hash_mask + 1;
     Uint32 num_iterated = 0;
 
-    for (SDL_HashItem *item = table->table; item < end; item++) {
-        if (item->live) {
-            if (!callback(userdata, table, item->key, item->value)) {
+    for (Uint32 i = 0; i < num_buckets && num_iterated < table->num_occupied_slots; i++) {
+        if (CTRL_IS_FULL(table->ctrl[i])) {
+            ++num_iterated;
+            if (!callback(userdata, table, table->keys[i], table->values[i])) {
                 break;  // callback requested iteration stop.
-            } else if (++num_iterated >= table->num_occupied_slots) {
-                break;  // we can drop out early because we've seen all the live items.
             }
         }
     }
@@ -424,13 +526,13 @@ bool SDL_HashTableEmpty(SDL_HashTable *table)
 static void destroy_all(SDL_HashTable *table)
 {
     SDL_HashDestroyCallback destroy = table->destroy;
-    if (destroy) {
+    if (destroy && table->ctrl) {
         void *userdata = table->userdata;
-        SDL_HashItem *end = table->table + (table->hash_mask + 1);
-        for (SDL_HashItem *i = table->table; i < end; ++i) {
-            if (i->live) {
-                i->live = false;
-                destroy(userdata, i->key, i->value);
+        const Uint32 num_buckets = table->hash_mask + 1;
+        for (Uint32 i = 0; i < num_buckets; ++i) {
+            if (CTRL_IS_FULL(table->ctrl[i])) {
+                table->ctrl[i] = CTRL_DELETED;
+                destroy(userdata, table->keys[i], table->values[i]);
             }
         }
     }
@@ -442,8 +544,9 @@ void SDL_ClearHashTable(SDL_HashTable *table)
         SDL_LockRWLockForWriting(table->lock);
         {
             destroy_all(table);
-            SDL_memset(table->table, 0, sizeof(*table->table) * (table->hash_mask + 1));
+            SDL_memset(table->ctrl, CTRL_EMPTY, (size_t)table->hash_mask + 1 + GROUP_SIZE);
             table->num_occupied_slots = 0;
+            table->growth_left = capacity_to_growth(table->hash_mask + 1);
         }
         SDL_UnlockRWLock(table->lock);
     }
@@ -456,7 +559,7 @@ void SDL_DestroyHashTable(SDL_HashTable *table)
         if (table->lock) {
             SDL_DestroyRWLock(table->lock);
         }
-        SDL_free(table->table);
+        SDL_free(table->ctrl);
         SDL_free(table);
     }
 }
@@ -60,8 +60,9 @@
  * iterate through all the items in the table (SDL_IterateHashTable).
  *
  * The underlying hash table implementation is always subject to change, but
- * at the time of writing, it uses open addressing and Robin Hood hashing.
- * The technical details are explained [here](https://github.com/libsdl-org/SDL/pull/10897).
+ * at the time of writing, it uses open addressing with a separate array of
+ * control bytes that are probed a group at a time, in the style of Abseil's
+ * "Swiss tables". Keys and values are stored in their own arrays.
  *
  * Hashtables keep an SDL_RWLock internally, so multiple threads can perform
  * hash lookups in parallel, while changes to the table will safely serialize
@@ -360,6 +361,27 @@ extern bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const
  */
 extern bool SDL_FindInHashTable(const SDL_HashTable *table, const void *key, const void **value);
 
+/**
+ * Look up an item in a hash table, using a hash calculated in advance.
+ *
+ * This works like SDL_FindInHashTable(), but doesn't call the table's
+ * SDL_HashCallback. This is useful when the same key is looked up often, and
+ * hashing it is expensive, like a long string.
+ *
+ * \param table the hash table to search.
+ * \param key the key to search for in the table.
+ * \param hash the value the table's SDL_HashCallback returns for `key`.
+ * \param value the found value will be stored here. Can be NULL.
+ * \returns true if key exists in the table, false otherwise.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.4.0.
+ *
+ * \sa SDL_FindInHashTable
+ */
+extern bool SDL_FindInHashTableWithHash(const SDL_HashTable *table, const void *key, Uint32 hash, const void **value);
+
 /**
  * Remove an item from a hash table.
  *
@@ -21,6 +21,7 @@
 #include "SDL_internal.h"
 
 #include "SDL_hints_c.h"
+#include "SDL_properties_c.h"
 
 #ifdef SDL_PLATFORM_ANDROID
 #include "core/android/SDL_android.h"
@@ -33,6 +34,9 @@ typedef struct SDL_HintWatch
     struct SDL_HintWatch *next;
 } SDL_HintWatch;
 
+/* Hints are stored by property key, so every hint that has been set or
+ * watched has a key, and a hint without a key has never been set.
+ */
 typedef struct SDL_Hint
 {
     char *value;
@@ -41,12 +45,26 @@ typedef struct SDL_Hint
 } SDL_Hint;
 
 static SDL_AtomicU32 SDL_hint_props;
+static SDL_AtomicInt SDL_hint_generation;
 
 
 void SDL_InitHints(void)
 {
 }
 
+void SDL_ChangedHints(void)
+{
+    // The generation goes up by 2 and skips 0, see SDL_GetHintGeneration()
+    if (SDL_AddAtomicInt(&SDL_hint_generation, 2) == -4) {
+        SDL_AddAtomicInt(&SDL_hint_generation, 2);
+    }
+}
+
+Uint32 SDL_GetHintGeneration(void)
+{
+    return (Uint32)SDL_GetAtomicInt(&SDL_hint_generation) + 2;
+}
+
 void SDL_QuitHints(void)
 {
     SDL_PropertiesID props;
@@ -57,6 +75,7 @@ void SDL_QuitHints(void)
     if (props) {
         SDL_DestroyProperties(props);
     }
+    SDL_ChangedHints();
 }
 
 static SDL_PropertiesID GetHintProperties(bool create)
@@ -118,11 +137,16 @@ bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPriori
         return false;
     }
 
+    const SDL_PropertyKey key = SDL_GetPropertyKey(name);
+    if (!key) {
+        return false;
+    }
+
     bool result = false;
 
     SDL_LockProperties(hints);
 
-    SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerProperty(hints, name, NULL);
+    SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerPropertyByKey(hints, key, NULL);
     if (hint) {
         if (priority >= hint->priority) {
             if (hint->value != value && (!value || !hint->value || SDL_strcmp(hint->value, value) != 0)) {
@@ -147,9 +171,12 @@ bool SDL_SetHintWithPriority(const char *name, const char *value, SDL_HintPriori
             hint->value = value ? SDL_strdup(value) : NULL;
             hint->priority = priority;
             hint->callbacks = NULL;
-            result = SDL_SetPointerPropertyWithCleanup(hints, name, hint, CleanupHintProperty, NULL);
+            result = SDL_SetPointerPropertyWithCleanupByKey(hints, key, hint, CleanupHintProperty, NULL);
         }
     }
+    if (result) {
+        SDL_ChangedHints();
+    }
 
 #ifdef SDL_PLATFORM_ANDROID
     if (SDL_strcmp(name, SDL_HINT_ANDROID_ALLOW_RECREATE_ACTIVITY) == 0) {
@@ -176,11 +203,12 @@ bool SDL_ResetHint(const char *name)
         return false;
     }
 
+    const SDL_PropertyKey key = SDL_FindPropertyKey(name);
     bool result = false;
 
     SDL_LockProperties(hints);
 
-    SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerProperty(hints, name, NULL);
+    SDL_Hint *hint = key ? (SDL_Hint *)SDL_GetPointerPropertyByKey(hints, key, NULL) : NULL;
     if (hint) {
         if ((!env && hint->value) || (env && !hint->value) || (env && SDL_strcmp(env, hint->value) != 0)) {
             for (SDL_HintWatch *entry = hint->callbacks; entry;) {
@@ -194,6 +222,7 @@ bool SDL_ResetHint(const char *name)
         hint->value = NULL;
         hint->priority = SDL_HINT_DEFAULT;
         result = true;
+        SDL_ChangedHints();
     }
 
 #ifdef SDL_PLATFORM_ANDROID
@@ -232,6 +261,7 @@ static void SDLCALL ResetHintsCallback(void *userdata, SDL_PropertiesID hints, c
     SDL_free(hint->value);
     hint->value = NULL;
     hint->priority = SDL_HINT_DEFAULT;
+    SDL_ChangedHints();
 
 #ifdef SDL_PLATFORM_ANDROID
     if (SDL_strcmp(name, SDL_HINT_ANDROID_ALLOW_RECREATE_ACTIVITY) == 0) {
@@ -263,11 +293,13 @@ const char *SDL_GetHint(const char *name)
 
     const char *result = GetHintEnvironmentVariable(name);
 
+    // Most hints are never set, and those don't need the lock
     const SDL_PropertiesID hints = GetHintProperties(false);
-    if (hints) {
+    const SDL_PropertyKey key = hints ? SDL_FindPropertyKey(name) : 0;
+    if (key) {
         SDL_LockProperties(hints);
 
-        SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerProperty(hints, name, NULL);
+        SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerPropertyByKey(hints, key, NULL);
         if (hint) {
             if (!result || hint->priority == SDL_HINT_OVERRIDE) {
                 result = SDL_GetPersistentString(hint->value);
@@ -314,6 +346,47 @@ bool SDL_GetHintBoolean(const char *name, bool default_value)
     return SDL_GetStringBoolean(hint, default_value);
 }
 
+bool SDL_GetCachedHintBoolean(const char *name, bool default_value, SDL_HintCache *cache)
+{
+    if (!cache) {
+        return SDL_GetHintBoolean(name, default_value);
+    }
+
+    // The generation is read before the hint, so if the hint changes in between,
+    // the cache is just refreshed again on the next call.
+    const Uint32 generation = SDL_GetHintGeneration();
+    const Uint32 state = SDL_GetAtomicU32(&cache->state);
+    if ((state & ~1u) == generation) {
+        return (state & 1) != 0;
+    }
+
+    const bool value = SDL_GetHintBoolean(name, default_value);
+    SDL_SetAtomicU32(&cache->state, generation | (value ? 1 : 0));
+    return value;
+}
+
+static void RemoveHintCallback(SDL_PropertiesID hints, SDL_PropertyKey key, SDL_HintCallback callback, void *userdata)
+{
+    SDL_LockProperties(hints);
+    SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerPropertyByKey(hints, key, NULL);
+    if (hint) {
+        SDL_HintWatch *prev = NULL;
+        for (SDL_HintWatch *entry = hint->callbacks; entry; entry = entry->next) {
+            if ((callback == entry->callback) && (userdata == entry->userdata)) {
+                if (prev) {
+                    prev->next = entry->next;
+                } else {
+                    hint->callbacks = entry->next;
+                }
+                SDL_free(entry);
+                break;
+            }
+            prev = entry;
+        }
+    }
+    SDL_UnlockProperties(hints);
+}
+
 bool SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
 {
     if (!name || !*name) {
@@ -327,6 +400,11 @@ bool SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *user
         return false;
     }
 
+    const SDL_PropertyKey key = SDL_GetPropertyKey(name);
+    if (!key) {
+        return false;
+    }
+
     SDL_HintWatch *entry = (SDL_HintWatch *)SDL_malloc(sizeof(*entry));
     if (!entry) {
         return false;
@@ -338,9 +416,9 @@ bool SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *user
 
     SDL_LockProperties(hints);
 
-    SDL_RemoveHintCallback(name, callback, userdata);
+    RemoveHintCallback(hints, key, callback, userdata);
 
-    SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerProperty(hints, name, NULL);
+    SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerPropertyByKey(hints, key, NULL);
     if (hint) {
         result = true;
     } else {  // Need to add a hint entry for this watcher
@@ -353,7 +431,7 @@ bool SDL_AddHintCallback(const char *name, SDL_HintCallback callback, void *user
             hint->value = NULL;
             hint->priority = SDL_HINT_DEFAULT;
             hint->callbacks = NULL;
-            result = SDL_SetPointerPropertyWithCleanup(hints, name, hint, CleanupHintProperty, NULL);
+            result = SDL_SetPointerPropertyWithCleanupByKey(hints, key, hint, CleanupHintProperty, NULL);
         }
     }
 
@@ -377,27 +455,10 @@ void SDL_RemoveHintCallback(const char *name, SDL_HintCallback callback, void *u
     }
 
     const SDL_PropertiesID hints = GetHintProperties(false);
-    if (!hints) {
+    const SDL_PropertyKey key = SDL_FindPropertyKey(name);
+    if (!hints || !key) {
         return;
     }
 
-    SDL_LockProperties(hints);
-    SDL_Hint *hint = (SDL_Hint *)SDL_GetPointerProperty(hints, name, NULL);
-    if (hint) {
-        SDL_HintWatch *prev = NULL;
-        for (SDL_HintWatch *entry = hint->callbacks; entry; entry = entry->next) {
-            if ((callback == entry->callback) && (userdata == entry->userdata)) {
-                if (prev) {
-                    prev->next = entry->next;
-                } else {
-                    hint->callbacks = entry->next;
-                }
-                SDL_free(entry);
-                break;
-            }
-            prev = entry;
-        }
-    }
-    SDL_UnlockProperties(hints);
+    RemoveHintCallback(hints, key, callback, userdata);
 }
-
@@ -26,6 +26,7 @@
 #define SDL_hints_c_h_
 
 extern void SDL_InitHints(void);
+extern void SDL_ChangedHints(void);
 extern bool SDL_GetStringBoolean(const char *value, bool default_value);
 extern int SDL_GetStringInteger(const char *value, int default_value);
 extern void SDL_QuitHints(void);
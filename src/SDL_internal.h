@@ -275,6 +275,24 @@ extern bool SDLCALL SDL_WaitSemaphoreTimeoutNS(SDL_Semaphore *sem, Sint64 timeou
 extern bool SDLCALL SDL_WaitConditionTimeoutNS(SDL_Condition *cond, SDL_Mutex *mutex, Sint64 timeoutNS);
 extern bool SDLCALL SDL_WaitEventTimeoutNS(SDL_Event *event, Sint64 timeoutNS);
 
+/* Allocations counted under a memory tag by SDL_GetMemoryStats().
+   When SDL is built with SDL_MEMORY_TAGS, the build defines SDL_MEMORY_TAG
+   for the sources of each subsystem, so everything they allocate is counted
+   under that subsystem's tag.
+*/
+extern SDL_MALLOC void *SDL_TaggedMalloc(size_t size, SDL_MemoryTag tag);
+extern SDL_MALLOC void *SDL_TaggedCalloc(size_t nmemb, size_t size, SDL_MemoryTag tag);
+extern void *SDL_TaggedRealloc(void *mem, size_t size, SDL_MemoryTag tag);
+
+#ifdef SDL_MEMORY_TAG
+#undef SDL_malloc
+#undef SDL_calloc
+#undef SDL_realloc
+#define SDL_malloc(size)        SDL_TaggedMalloc(size, SDL_MEMORY_TAG)
+#define SDL_calloc(nmemb, size) SDL_TaggedCalloc(nmemb, size, SDL_MEMORY_TAG)
+#define SDL_realloc(mem, size)  SDL_TaggedRealloc(mem, size, SDL_MEMORY_TAG)
+#endif
+
 // Ends C function definitions when using C++
 #ifdef __cplusplus
 }
@@ -38,11 +38,11 @@
 
 #include "stdlib/SDL_vacopy.h"
 
-// The size of the stack buffer to use for rendering log messages.
-#define SDL_MAX_LOG_MESSAGE_STACK 256
-
 #define DEFAULT_CATEGORY -1
 
+// The number of messages the asynchronous log queue holds, must be a power of two
+#define SDL_LOG_QUEUE_SIZE 512
+
 typedef struct SDL_LogLevel
 {
     int category;
@@ -50,12 +50,65 @@ typedef struct SDL_LogLevel
     struct SDL_LogLevel *next;
 } SDL_LogLevel;
 
+// The number of custom category priorities that SDL_GetLogPriority() can look up without locking
+#define SDL_MAX_PUBLISHED_LOG_LEVELS 32
+
+/* A copy of the log priorities that SDL_GetLogPriority() reads without locking.
+   It's updated in place with SDL_log_lock held, and the sequence is odd while
+   that's happening. Readers retry if the sequence was odd or changed while they
+   were reading, so they never use a half updated table. If there are more
+   custom categories than fit, num_levels is -1 and readers take the lock to
+   look those up. */
+typedef struct SDL_LogPriorities
+{
+    SDL_AtomicInt sequence;
+    SDL_AtomicInt published;
+    SDL_AtomicInt default_priority;
+    SDL_AtomicInt priorities[SDL_LOG_CATEGORY_CUSTOM];
+    SDL_AtomicInt num_levels;
+    SDL_AtomicInt level_categories[SDL_MAX_PUBLISHED_LOG_LEVELS];
+    SDL_AtomicInt level_priorities[SDL_MAX_PUBLISHED_LOG_LEVELS];
+} SDL_LogPriorities;
+
+/* A message waiting in the asynchronous log queue.
+   Messages that don't fit in the entry are allocated by SDL_LogMessageV(),
+   and the queue takes ownership of them. */
+typedef struct SDL_LogQueueEntry
+{
+    SDL_AtomicU32 sequence;
+    int category;
+    SDL_LogPriority priority;
+    char *long_message;
+    char message[SDL_MAX_LOG_MESSAGE_STACK];
+} SDL_LogQueueEntry;
+
+/* A bounded queue with many producers and one consumer, the writer thread.
+   An entry is free for the producer that claims position `pos` when its
+   sequence is `pos`, and holds a message for the writer when it is `pos + 1`.
+   The writer sets it to `pos + SDL_LOG_QUEUE_SIZE` when it's done, which
+   frees it for the next time around the ring. */
+typedef struct SDL_LogQueue
+{
+    SDL_AtomicU32 enqueue_pos;
+    SDL_AtomicU32 dequeue_pos;
+    SDL_AtomicInt policy;
+    SDL_AtomicInt waiting;
+    SDL_AtomicInt quit;
+    SDL_Semaphore *ready;
+    SDL_Semaphore *space;
+    SDL_Thread *thread;
+    SDL_ThreadID thread_id;
+    SDL_LogQueueEntry entries[SDL_LOG_QUEUE_SIZE];
+} SDL_LogQueue;
+
 
 // The default log output function
 static void SDLCALL SDL_LogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message);
 
 static void CleanupLogPriorities(void);
+static void CleanupPublishedLogPriorities(void);
 static void CleanupLogPrefixes(void);
+static void DestroyLogQueue(SDL_LogQueue *queue);
 
 static SDL_InitState SDL_log_init;
 static SDL_Mutex *SDL_log_lock;
@@ -63,8 +116,15 @@ static SDL_Mutex *SDL_log_function_lock;
 static SDL_LogLevel *SDL_loglevels SDL_GUARDED_BY(SDL_log_lock);
 static SDL_LogPriority SDL_log_priorities[SDL_LOG_CATEGORY_CUSTOM] SDL_GUARDED_BY(SDL_log_lock);
 static SDL_LogPriority SDL_log_default_priority SDL_GUARDED_BY(SDL_log_lock);
+static SDL_LogPriorities SDL_log_published_priorities;
 static SDL_LogOutputFunction SDL_log_function SDL_GUARDED_BY(SDL_log_function_lock) = SDL_LogOutput;
 static void *SDL_log_userdata SDL_GUARDED_BY(SDL_log_function_lock) = NULL;
+static SDL_Mutex *SDL_log_async_lock;
+static void *SDL_log_queue;
+static SDL_AtomicInt SDL_log_queue_users;
+static SDL_AtomicInt SDL_log_written;
+static SDL_AtomicInt SDL_log_dropped;
+static SDL_AtomicInt SDL_log_blocked;
 
 #ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
 #pragma GCC diagnostic push
@@ -134,6 +194,8 @@ void SDL_InitLog(void)
     // If these fail we'll continue without them.
     SDL_log_lock = SDL_CreateMutex();
     SDL_log_function_lock = SDL_CreateMutex();
+    SDL_log_async_lock = SDL_CreateMutex();
+    SDL_InitLogRecords();
 
     SDL_AddHintCallback(SDL_HINT_LOGGING, SDL_LoggingChanged, NULL);
 
@@ -148,7 +210,12 @@ void SDL_QuitLog(void)
 
     SDL_RemoveHintCallback(SDL_HINT_LOGGING, SDL_LoggingChanged, NULL);
 
+    // Write out anything that's still queued before the locks go away
+    DestroyLogQueue((SDL_LogQueue *)SDL_SetAtomicPointer(&SDL_log_queue, NULL));
+    SDL_QuitLogRecords();
+
     CleanupLogPriorities();
+    CleanupPublishedLogPriorities();
     CleanupLogPrefixes();
 
     if (SDL_log_lock) {
@@ -159,11 +226,15 @@ void SDL_QuitLog(void)
         SDL_DestroyMutex(SDL_log_function_lock);
         SDL_log_function_lock = NULL;
     }
+    if (SDL_log_async_lock) {
+        SDL_DestroyMutex(SDL_log_async_lock);
+        SDL_log_async_lock = NULL;
+    }
 
     SDL_SetInitialized(&SDL_log_init, false);
 }
 
-static void SDL_CheckInitLog(void)
+void SDL_CheckInitLog(void)
 {
     int status = SDL_GetAtomicInt(&SDL_log_init.status);
     if (status == SDL_INIT_STATUS_INITIALIZED ||
@@ -183,6 +254,135 @@ static void CleanupLogPriorities(void)
     }
 }
 
+static void CleanupPublishedLogPriorities(void)
+{
+    SDL_LogPriorities *table = &SDL_log_published_priorities;
+
+    SDL_AddAtomicInt(&table->sequence, 1);
+    SDL_SetAtomicInt(&table->published, 0);
+    SDL_AddAtomicInt(&table->sequence, 1);
+}
+
+// Make the current priorities visible to SDL_GetLogPriority(), this is called with SDL_log_lock held
+static void PublishLogPriorities(void)
+{
+    SDL_LogPriorities *table = &SDL_log_published_priorities;
+    SDL_LogLevel *entry;
+    int num_levels = 0;
+
+    for (entry = SDL_loglevels; entry; entry = entry->next) {
+        ++num_levels;
+    }
+
+    // Readers that see the sequence change while they're reading will try again
+    SDL_AddAtomicInt(&table->sequence, 1);
+
+    SDL_SetAtomicInt(&table->default_priority, SDL_log_default_priority);
+    for (int i = 0; i < SDL_arraysize(SDL_log_priorities); ++i) {
+        SDL_SetAtomicInt(&table->priorities[i], SDL_log_priorities[i]);
+    }
+    if (num_levels > SDL_MAX_PUBLISHED_LOG_LEVELS) {
+        SDL_SetAtomicInt(&table->num_levels, -1);
+    } else {
+        num_levels = 0;
+        for (entry = SDL_loglevels; entry; entry = entry->next) {
+            SDL_SetAtomicInt(&table->level_categories[num_levels], entry->category);
+            SDL_SetAtomicInt(&table->level_priorities[num_levels], entry->priority);
+            ++num_levels;
+        }
+        SDL_SetAtomicInt(&table->num_levels, num_levels);
+    }
+    SDL_SetAtomicInt(&table->published, 1);
+
+    SDL_AddAtomicInt(&table->sequence, 1);
+}
+
+// Look up a priority in the published table, returns false if the caller has to lock and look at the priorities directly
+static bool GetPublishedLogPriority(int category, SDL_LogPriority *priority)
+{
+    SDL_LogPriorities *table = &SDL_log_published_priorities;
+
+    for (;;) {
+        const int sequence = SDL_GetAtomicInt(&table->sequence);
+        int num_levels;
+        bool found = true;
+
+        if (sequence & 1) {
+            // A priority is being changed right now
+            SDL_CPUPauseInstruction();
+            continue;
+        }
+        if (!SDL_GetAtomicInt(&table->published)) {
+            return false;
+        }
+
+        if (category >= 0 && category < SDL_arraysize(table->priorities)) {
+            *priority = (SDL_LogPriority)SDL_GetAtomicInt(&table->priorities[category]);
+        } else {
+            num_levels = SDL_GetAtomicInt(&table->num_levels);
+            if (num_levels < 0) {
+                found = false;
+            } else {
+                int i;
+                for (i = 0; i < num_levels; ++i) {
+                    if (SDL_GetAtomicInt(&table->level_categories[i]) == category) {
+                        *priority = (SDL_LogPriority)SDL_GetAtomicInt(&table->level_priorities[i]);
+                        break;
+                    }
+                }
+                if (i == num_levels) {
+                    *priority = (SDL_LogPriority)SDL_GetAtomicInt(&table->default_priority);
+                }
+            }
+        }
+
+        if (SDL_GetAtomicInt(&table->sequence) == sequence) {
+            return found;
+        }
+    }
+}
+
+static SDL_LogPriority GetLogPriorityLocked(int category)
+{
+    SDL_LogLevel *entry;
+
+    if (category >= 0 && category < SDL_arraysize(SDL_log_priorities)) {
+        return SDL_log_priorities[category];
+    }
+
+    for (entry = SDL_loglevels; entry; entry = entry->next) {
+        if (entry->category == category) {
+            return entry->priority;
+        }
+    }
+    return SDL_log_default_priority;
+}
+
+static void SetLogPriorityLocked(int category, SDL_LogPriority priority)
+{
+    SDL_LogLevel *entry;
+
+    if (category >= 0 && category < SDL_arraysize(SDL_log_priorities)) {
+        SDL_log_priorities[category] = priority;
+        return;
+    }
+
+    for (entry = SDL_loglevels; entry; entry = entry->next) {
+        if (entry->category == category) {
+            entry->priority = priority;
+            return;
+        }
+    }
+
+    entry = (SDL_LogLevel *)SDL_malloc(sizeof(*entry));
+    if (entry) {
+        entry->category = category;
+        entry->priority = priority;
+        entry->next = SDL_loglevels;
+        SDL_loglevels = entry;
+    }
+}
+
 void SDL_SetLogPriorities(SDL_LogPriority priority)
 {
     SDL_CheckInitLog();
@@ -195,72 +395,44 @@ void SDL_SetLogPriorities(SDL_LogPriority priority)
         for (int i = 0; i < SDL_arraysize(SDL_log_priorities); ++i) {
             SDL_log_priorities[i] = priority;
         }
+
+        PublishLogPriorities();
     }
     SDL_UnlockMutex(SDL_log_lock);
 }
 
 void SDL_SetLogPriority(int category, SDL_LogPriority priority)
 {
-    SDL_LogLevel *entry;
-
     SDL_CheckInitLog();
 
     SDL_LockMutex(SDL_log_lock);
     {
-        if (category >= 0 && category < SDL_arraysize(SDL_log_priorities)) {
-            SDL_log_priorities[category] = priority;
-        } else {
-            for (entry = SDL_loglevels; entry; entry = entry->next) {
-                if (entry->category == category) {
-                    entry->priority = priority;
-                    break;
-                }
-            }
+        SetLogPriorityLocked(category, priority);
 
-            if (!entry) {
-                entry = (SDL_LogLevel *)SDL_malloc(sizeof(*entry));
-                if (entry) {
-                    entry->category = category;
-                    entry->priority = priority;
-                    entry->next = SDL_loglevels;
-                    SDL_loglevels = entry;
-                }
-            }
-        }
+        PublishLogPriorities();
     }
     SDL_UnlockMutex(SDL_log_lock);
 }
 
 SDL_LogPriority SDL_GetLogPriority(int category)
 {
-    SDL_LogLevel *entry;
-    SDL_LogPriority priority = SDL_LOG_PRIORITY_INVALID;
-
-    SDL_CheckInitLog();
+    SDL_LogPriority priority;
 
-    // Bypass the lock for known categories
-    // Technically if the priority was set on a different CPU the value might not
-    // be visible on this CPU for a while, but in practice it's fast enough that
-    // this performance improvement is worthwhile.
-    if (category >= 0 && category < SDL_arraysize(SDL_log_priorities)) {
-        return SDL_log_priorities[category];
+    /* This is checked for every message, so look at the published copy without locking.
+       There's only a published copy once logging is initialized. */
+    if (GetPublishedLogPriority(category, &priority)) {
+        return priority;
+    }
+    if (!SDL_GetAtomicInt(&SDL_log_published_priorities.published)) {
+        SDL_CheckInitLog();
+        if (GetPublishedLogPriority(category, &priority)) {
+            return priority;
+        }
     }
 
     SDL_LockMutex(SDL_log_lock);
     {
-        if (category >= 0 && category < SDL_arraysize(SDL_log_priorities)) {
-            priority = SDL_log_priorities[category];
-        } else {
-            for (entry = SDL_loglevels; entry; entry = entry->next) {
-                if (entry->category == category) {
-                    priority = entry->priority;
-                    break;
-                }
-            }
-            if (priority == SDL_LOG_PRIORITY_INVALID) {
-                priority = SDL_log_default_priority;
-            }
-        }
+        priority = GetLogPriorityLocked(category);
     }
     SDL_UnlockMutex(SDL_log_lock);
 
@@ -362,7 +534,7 @@ static void ParseLogPriorities(const char *hint)
                     }
                     SDL_log_default_priority = priority;
                 } else {
-                    SDL_SetLogPriority(category, priority);
+                    SetLogPriorityLocked(category, priority);
                 }
             }
         }
@@ -410,6 +582,8 @@ void SDL_ResetLogPriorities(void)
                 break;
             }
         }
+
+        PublishLogPriorities();
     }
     SDL_UnlockMutex(SDL_log_lock);
 }
@@ -569,6 +743,250 @@ static const char *GetCategoryPrefix(int category)
 }
 #endif // SDL_PLATFORM_ANDROID
 
+static bool IsLogEntryReady(SDL_LogQueueEntry *entry, Uint32 pos)
+{
+    return (Sint32)(SDL_GetAtomicU32(&entry->sequence) - (pos + 1)) >= 0;
+}
+
+// Write every message that's ready, in order
+static void WriteLogEntries(SDL_LogQueue *queue)
+{
+    Uint32 pos = SDL_GetAtomicU32(&queue->dequeue_pos);
+    SDL_LogQueueEntry *entry = &queue->entries[pos & (SDL_LOG_QUEUE_SIZE - 1)];
+
+    if (!IsLogEntryReady(entry, pos)) {
+        return;
+    }
+
+    SDL_LockMutex(SDL_log_function_lock);
+    do {
+        if (SDL_log_function) {
+            SDL_log_function(SDL_log_userdata, entry->category, entry->priority,
+                             entry->long_message ? entry->long_message : entry->message);
+        }
+        if (entry->long_message) {
+            SDL_free(entry->long_message);
+            entry->long_message = NULL;
+        }
+
+        SDL_SetAtomicU32(&entry->sequence, pos + SDL_LOG_QUEUE_SIZE);
+        SDL_SetAtomicU32(&queue->dequeue_pos, ++pos);
+        SDL_AddAtomicInt(&SDL_log_written, 1);
+        if (SDL_GetAtomicInt(&queue->waiting) > 0) {
+            SDL_SignalSemaphore(queue->space);
+        }
+
+        entry = &queue->entries[pos & (SDL_LOG_QUEUE_SIZE - 1)];
+    } while (IsLogEntryReady(entry, pos));
+    SDL_UnlockMutex(SDL_log_function_lock);
+}
+
+static int SDLCALL SDL_LogWriterThread(void *data)
+{
+    SDL_LogQueue *queue = (SDL_LogQueue *)data;
+    bool done = false;
+
+    while (!done) {
+        SDL_WaitSemaphore(queue->ready);
+
+        // Nothing else is queued once quit is set, so one more pass gets everything
+        done = (SDL_GetAtomicInt(&queue->quit) != 0);
+        WriteLogEntries(queue);
+    }
+    return 0;
+}
+
+static SDL_LogQueue *CreateLogQueue(SDL_LogOverflowPolicy policy)
+{
+    SDL_LogQueue *queue = (SDL_LogQueue *)SDL_calloc(1, sizeof(*queue));
+    if (!queue) {
+        return NULL;
+    }
+
+    for (Uint32 i = 0; i < SDL_LOG_QUEUE_SIZE; ++i) {
+        SDL_SetAtomicU32(&queue->entries[i].sequence, i);
+    }
+    SDL_SetAtomicInt(&queue->policy, policy);
+
+    queue->ready = SDL_CreateSemaphore(0);
+    queue->space = SDL_CreateSemaphore(0);
+    if (queue->ready && queue->space) {
+        queue->thread = SDL_CreateThread(SDL_LogWriterThread, "SDLLogWriter", queue);
+    }
+    if (!queue->thread) {
+        SDL_DestroySemaphore(queue->ready);
+        SDL_DestroySemaphore(queue->space);
+        SDL_free(queue);
+        return NULL;
+    }
+    queue->thread_id = SDL_GetThreadID(queue->thread);
+
+    return queue;
+}
+
+// The queue must already be unpublished from SDL_log_queue
+static void DestroyLogQueue(SDL_LogQueue *queue)
+{
+    if (!queue) {
+        return;
+    }
+
+    // Wait for threads that saw the queue before it was unpublished
+    while (SDL_GetAtomicInt(&SDL_log_queue_users) > 0) {
+        SDL_Delay(1);
+    }
+
+    SDL_SetAtomicInt(&queue->quit, 1);
+    SDL_SignalSemaphore(queue->ready);
+    SDL_WaitThread(queue->thread, NULL);
+
+    SDL_DestroySemaphore(queue->ready);
+    SDL_DestroySemaphore(queue->space);
+    SDL_free(queue);
+}
+
+bool SDL_SetLogAsync(bool enabled, SDL_LogOverflowPolicy policy)
+{
+    SDL_LogQueue *queue;
+    bool result = true;
+
+    if (policy != SDL_LOG_OVERFLOW_DROP && policy != SDL_LOG_OVERFLOW_BLOCK) {
+        return SDL_InvalidParamError("policy");
+    }
+
+    SDL_CheckInitLog();
+
+    SDL_LockMutex(SDL_log_async_lock);
+    {
+        queue = (SDL_LogQueue *)SDL_GetAtomicPointer(&SDL_log_queue);
+        if (enabled) {
+            if (queue) {
+                SDL_SetAtomicInt(&queue->policy, policy);
+            } else {
+                queue = CreateLogQueue(policy);
+                if (queue) {
+                    SDL_SetAtomicPointer(&SDL_log_queue, queue);
+                } else {
+                    result = false;
+                }
+            }
+        } else if (queue) {
+            SDL_SetAtomicPointer(&SDL_log_queue, NULL);
+            DestroyLogQueue(queue);
+        }
+    }
+    SDL_UnlockMutex(SDL_log_async_lock);
+
+    return result;
+}
+
+bool SDL_GetLogAsyncStats(SDL_LogAsyncStats *stats, bool reset)
+{
+    SDL_LogQueue *queue;
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_CheckInitLog();
+
+    SDL_zerop(stats);
+
+    SDL_LockMutex(SDL_log_async_lock);
+    {
+        queue = (SDL_LogQueue *)SDL_GetAtomicPointer(&SDL_log_queue);
+        if (queue) {
+            stats->capacity = SDL_LOG_QUEUE_SIZE;
+            stats->queued = (int)(SDL_GetAtomicU32(&queue->enqueue_pos) - SDL_GetAtomicU32(&queue->dequeue_pos));
+        }
+    }
+    SDL_UnlockMutex(SDL_log_async_lock);
+
+    if (reset) {
+        stats->written = (Uint32)SDL_SetAtomicInt(&SDL_log_written, 0);
+        stats->dropped = (Uint32)SDL_SetAtomicInt(&SDL_log_dropped, 0) + SDL_GetDroppedLogRecords(true);
+        stats->blocked = (Uint32)SDL_SetAtomicInt(&SDL_log_blocked, 0);
+    } else {
+        stats->written = (Uint32)SDL_GetAtomicInt(&SDL_log_written);
+        stats->dropped = (Uint32)SDL_GetAtomicInt(&SDL_log_dropped) + SDL_GetDroppedLogRecords(false);
+        stats->blocked = (Uint32)SDL_GetAtomicInt(&SDL_log_blocked);
+    }
+    return true;
+}
+
+static bool TryQueueLogMessage(SDL_LogQueue *queue, int category, SDL_LogPriority priority, char *message, size_t len, bool allocated)
+{
+    SDL_LogQueueEntry *entry;
+    Uint32 pos = SDL_GetAtomicU32(&queue->enqueue_pos);
+
+    for (;;) {
+        entry = &queue->entries[pos & (SDL_LOG_QUEUE_SIZE - 1)];
+
+        const Sint32 diff = (Sint32)(SDL_GetAtomicU32(&entry->sequence) - pos);
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicU32(&queue->enqueue_pos, pos, pos + 1)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The writer hasn't finished with this entry yet, the queue is full
+            return false;
+        }
+        pos = SDL_GetAtomicU32(&queue->enqueue_pos);
+    }
+
+    entry->category = category;
+    entry->priority = priority;
+    if (allocated) {
+        entry->long_message = message;
+    } else {
+        SDL_memcpy(entry->message, message, len + 1);
+    }
+    SDL_SetAtomicU32(&entry->sequence, pos + 1);
+
+    SDL_SignalSemaphore(queue->ready);
+    return true;
+}
+
+/* Hand a formatted message to the writer thread, if asynchronous logging is enabled.
+   This returns true if the message was queued or dropped, and the queue
+   takes ownership of allocated messages in either case. */
+static bool QueueLogMessage(int category, SDL_LogPriority priority, char *message, size_t len, bool allocated)
+{
+    SDL_LogQueue *queue;
+    bool handled = false;
+
+    if (!SDL_GetAtomicPointer(&SDL_log_queue)) {
+        return false;
+    }
+
+    SDL_AddAtomicInt(&SDL_log_queue_users, 1);
+    queue = (SDL_LogQueue *)SDL_GetAtomicPointer(&SDL_log_queue);
+
+    // Messages logged by the output function are written right away
+    if (queue && queue->thread_id != SDL_GetCurrentThreadID()) {
+        handled = true;
+        if (!TryQueueLogMessage(queue, category, priority, message, len, allocated)) {
+            if (SDL_GetAtomicInt(&queue->policy) == SDL_LOG_OVERFLOW_BLOCK) {
+                SDL_AddAtomicInt(&SDL_log_blocked, 1);
+                SDL_AddAtomicInt(&queue->waiting, 1);
+                do {
+                    // The timeout covers a wakeup that was sent before we started waiting
+                    SDL_WaitSemaphoreTimeout(queue->space, 10);
+                } while (!TryQueueLogMessage(queue, category, priority, message, len, allocated));
+                SDL_AddAtomicInt(&queue->waiting, -1);
+            } else {
+                SDL_AddAtomicInt(&SDL_log_dropped, 1);
+                if (allocated) {
+                    SDL_free(message);
+                }
+            }
+        }
+    }
+
+    SDL_AddAtomicInt(&SDL_log_queue_users, -1);
+    return handled;
+}
+
 void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_STRING const char *fmt, va_list ap)
 {
     char *message = NULL;
@@ -587,6 +1005,11 @@ void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_S
         return;
     }
 
+    // Capture it to be formatted later, if deferred mode is enabled
+    if (SDL_CaptureLogRecord(category, priority, fmt, ap)) {
+        return;
+    }
+
     // Render into stack buffer
     va_copy(aq, ap);
     len = SDL_vsnprintf(stack_buf, sizeof(stack_buf), fmt, aq);
@@ -618,6 +1041,10 @@ void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_S
         }
     }
 
+    if (QueueLogMessage(category, priority, message, (size_t)len, (message != stack_buf))) {
+        return;
+    }
+
     SDL_LockMutex(SDL_log_function_lock);
     {
         SDL_log_function(SDL_log_userdata, category, priority, message);
@@ -775,6 +1202,17 @@ static void SDLCALL SDL_LogOutput(void *userdata, int category, SDL_LogPriority
 #endif
 }
 
+void SDL_OutputLogMessage(int category, SDL_LogPriority priority, const char *message)
+{
+    SDL_LockMutex(SDL_log_function_lock);
+    {
+        if (SDL_log_function) {
+            SDL_log_function(SDL_log_userdata, category, priority, message);
+        }
+    }
+    SDL_UnlockMutex(SDL_log_function_lock);
+}
+
 SDL_LogOutputFunction SDL_GetDefaultLogOutputFunction(void)
 {
     return SDL_LogOutput;
@@ -25,7 +25,18 @@
 #ifndef SDL_log_c_h_
 #define SDL_log_c_h_
 
+// The size of the stack buffer to use for rendering log messages.
+#define SDL_MAX_LOG_MESSAGE_STACK 256
+
 extern void SDL_InitLog(void);
 extern void SDL_QuitLog(void);
+extern void SDL_CheckInitLog(void);
+extern void SDL_OutputLogMessage(int category, SDL_LogPriority priority, const char *message);
+
+// Log records, see SDL_logrecord.c
+extern void SDL_InitLogRecords(void);
+extern void SDL_QuitLogRecords(void);
+extern bool SDL_CaptureLogRecord(int category, SDL_LogPriority priority, const char *fmt, va_list ap);
+extern Uint32 SDL_GetDroppedLogRecords(bool reset);
 
 #endif // SDL_log_c_h_
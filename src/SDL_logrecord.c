@@ -0,0 +1,896 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// Log messages captured without formatting, see SDL_SetLogDeferred()
+
+#include "SDL_log_c.h"
+
+#include "stdlib/SDL_vacopy.h"
+
+// The size of each thread's record buffer, must be a power of two
+#define SDL_LOG_RECORD_BUFFER_SIZE (64 * 1024)
+
+// The largest record that is captured, messages that need more are captured as text
+#define SDL_MAX_LOG_RECORD_SIZE 1024
+
+// The size of a record that marks the unused space at the end of a buffer
+#define SDL_LOG_RECORD_WRAP 0xFFFFFFFF
+
+// The length of a NULL string argument
+#define SDL_LOG_RECORD_NULL_STRING 0xFFFFFFFF
+
+#define SDL_LOG_RECORD_ALIGN(x) (((x) + 7) & ~(size_t)7)
+
+typedef struct SDL_LogRecordHeader
+{
+    Uint32 size;
+    Uint32 args_size;
+    int category;
+    SDL_LogPriority priority;
+    Uint64 timestamp;
+    const char *fmt;
+} SDL_LogRecordHeader;
+
+#define SDL_LOG_RECORD_HEADER_SIZE SDL_LOG_RECORD_ALIGN(sizeof(SDL_LogRecordHeader))
+
+/* The records logged by one thread, which is the only one that adds to it.
+   Records are kept whole, if one doesn't fit at the end of the buffer, the
+   rest of the buffer is marked as unused and the record goes at the start.
+   The buffer belongs to both the thread and the list of buffers, and is
+   freed when both are done with it. */
+typedef struct SDL_LogRecordBuffer
+{
+    SDL_AtomicU32 head;
+    SDL_AtomicU32 tail;
+    SDL_AtomicInt refcount;
+    int generation;
+    SDL_ThreadID thread;
+    struct SDL_LogRecordBuffer *next;
+    Uint64 data[SDL_LOG_RECORD_BUFFER_SIZE / sizeof(Uint64)];
+} SDL_LogRecordBuffer;
+
+typedef enum SDL_LogArgLength
+{
+    SDL_LOG_ARG_INT,
+    SDL_LOG_ARG_CHAR,
+    SDL_LOG_ARG_SHORT,
+    SDL_LOG_ARG_LONG,
+    SDL_LOG_ARG_LONGLONG,
+    SDL_LOG_ARG_SIZE_T,
+    SDL_LOG_ARG_PTRDIFF_T,
+    SDL_LOG_ARG_INTMAX_T,
+    SDL_LOG_ARG_LONG_DOUBLE
+} SDL_LogArgLength;
+
+static SDL_TLSID SDL_log_record_tls;
+static SDL_Mutex *SDL_log_record_lock;
+static SDL_LogRecordBuffer *SDL_log_record_buffers SDL_GUARDED_BY(SDL_log_record_lock);
+static SDL_AtomicInt SDL_log_deferred;
+static SDL_AtomicInt SDL_log_record_generation;
+static SDL_AtomicInt SDL_log_records_dropped;
+
+static void SDLCALL ReleaseLogRecordBuffer(void *data)
+{
+    SDL_LogRecordBuffer *buffer = (SDL_LogRecordBuffer *)data;
+
+    if (buffer && SDL_AtomicDecRef(&buffer->refcount)) {
+        SDL_free(buffer);
+    }
+}
+
+static SDL_LogRecordBuffer *GetLogRecordBuffer(void)
+{
+    SDL_LogRecordBuffer *buffer = (SDL_LogRecordBuffer *)SDL_GetTLS(&SDL_log_record_tls);
+    const int generation = SDL_GetAtomicInt(&SDL_log_record_generation);
+
+    if (buffer && buffer->generation == generation) {
+        return buffer;
+    }
+
+    // This buffer is left over from before logging was shut down
+    if (buffer) {
+        SDL_SetTLS(&SDL_log_record_tls, NULL, NULL);
+        ReleaseLogRecordBuffer(buffer);
+    }
+
+    buffer = (SDL_LogRecordBuffer *)SDL_calloc(1, sizeof(*buffer));
+    if (!buffer) {
+        return NULL;
+    }
+    SDL_SetAtomicInt(&buffer->refcount, 2);
+    buffer->generation = generation;
+    buffer->thread = SDL_GetCurrentThreadID();
+
+    if (!SDL_SetTLS(&SDL_log_record_tls, buffer, ReleaseLogRecordBuffer)) {
+        SDL_free(buffer);
+        return NULL;
+    }
+
+    SDL_LockMutex(SDL_log_record_lock);
+    {
+        // If logging was shut down meanwhile, the buffer is only this thread's and gets replaced next time
+        if (SDL_GetAtomicInt(&SDL_log_record_generation) == generation) {
+            buffer->next = SDL_log_record_buffers;
+            SDL_log_record_buffers = buffer;
+        } else {
+            SDL_SetAtomicInt(&buffer->refcount, 1);
+        }
+    }
+    SDL_UnlockMutex(SDL_log_record_lock);
+
+    return buffer;
+}
+
+static bool PutLogRecord(SDL_LogRecordBuffer *buffer, const void *record, Uint32 size)
+{
+    Uint8 *data = (Uint8 *)buffer->data;
+    Uint32 head = SDL_GetAtomicU32(&buffer->head);
+    const Uint32 tail = SDL_GetAtomicU32(&buffer->tail);
+    Uint32 offset = head & (SDL_LOG_RECORD_BUFFER_SIZE - 1);
+    const Uint32 contiguous = SDL_LOG_RECORD_BUFFER_SIZE - offset;
+    const Uint32 needed = (contiguous < size) ? (contiguous + size) : size;
+
+    if (SDL_LOG_RECORD_BUFFER_SIZE - (head - tail) < needed) {
+        return false;
+    }
+
+    if (contiguous < size) {
+        ((SDL_LogRecordHeader *)(data + offset))->size = SDL_LOG_RECORD_WRAP;
+        head += contiguous;
+        offset = 0;
+    }
+    SDL_memcpy(data + offset, record, size);
+
+    // This makes the record visible to SDL_ReadLogRecords()
+    SDL_SetAtomicU32(&buffer->head, head + size);
+    return true;
+}
+
+static bool PutLogArg(Uint8 *args, size_t *size, size_t maxlen, const void *value, size_t length)
+{
+    const size_t offset = SDL_LOG_RECORD_ALIGN(*size);
+
+    if (offset > maxlen || length > maxlen - offset) {
+        return false;
+    }
+    SDL_memcpy(args + offset, value, length);
+    *size = offset + length;
+    return true;
+}
+
+static bool PutLogIntArg(Uint8 *args, size_t *size, size_t maxlen, Sint64 value)
+{
+    return PutLogArg(args, size, maxlen, &value, sizeof(value));
+}
+
+// A precision of zero or more limits how much of the string is read, and it needn't be terminated within that
+static bool PutLogStringArg(Uint8 *args, size_t *size, size_t maxlen, const char *string, int precision)
+{
+    const size_t offset = SDL_LOG_RECORD_ALIGN(*size);
+    Uint32 length;
+
+    if (!string) {
+        length = SDL_LOG_RECORD_NULL_STRING;
+        return PutLogArg(args, size, maxlen, &length, sizeof(length));
+    }
+
+    length = (Uint32)SDL_strnlen(string, (precision >= 0) ? SDL_min((size_t)precision, maxlen) : maxlen);
+    if (offset > maxlen || maxlen - offset < sizeof(length) + length + 1) {
+        return false;
+    }
+    SDL_memcpy(args + offset, &length, sizeof(length));
+    SDL_memcpy(args + offset + sizeof(length), string, length);
+    args[offset + sizeof(length) + length] = '\0';
+    *size = offset + sizeof(length) + length + 1;
+    return true;
+}
+
+static const char *ParseLogArgLength(const char *fmt, SDL_LogArgLength *length)
+{
+    *length = SDL_LOG_ARG_INT;
+
+    switch (*fmt) {
+    case 'h':
+        if (fmt[1] == 'h') {
+            *length = SDL_LOG_ARG_CHAR;
+            return fmt + 2;
+        }
+        *length = SDL_LOG_ARG_SHORT;
+        return fmt + 1;
+    case 'l':
+        if (fmt[1] == 'l') {
+            *length = SDL_LOG_ARG_LONGLONG;
+            return fmt + 2;
+        }
+        *length = SDL_LOG_ARG_LONG;
+        return fmt + 1;
+    case 'I':
+        if (SDL_strncmp(fmt, "I64", 3) == 0) {
+            *length = SDL_LOG_ARG_LONGLONG;
+            return fmt + 3;
+        }
+        break;
+    case 'z':
+        *length = SDL_LOG_ARG_SIZE_T;
+        return fmt + 1;
+    case 't':
+        *length = SDL_LOG_ARG_PTRDIFF_T;
+        return fmt + 1;
+    case 'j':
+        *length = SDL_LOG_ARG_INTMAX_T;
+        return fmt + 1;
+    case 'L':
+        *length = SDL_LOG_ARG_LONG_DOUBLE;
+        return fmt + 1;
+    default:
+        break;
+    }
+    return fmt;
+}
+
+static bool IsLogFlag(char ch)
+{
+    return ch == '-' || ch == '+' || ch == ' ' || ch == '#' || ch == '0';
+}
+
+/* Copy the arguments that fmt uses into args, as described for SDL_LogRecord.
+   This returns false if the format uses something we can't capture, or the
+   arguments don't fit. */
+static bool CaptureLogArgs(Uint8 *args, size_t *args_size, size_t maxlen, const char *fmt, va_list ap)
+{
+    size_t size = 0;
+
+    while (*fmt) {
+        SDL_LogArgLength length;
+        int precision = -1;
+        bool stored;
+
+        if (*fmt++ != '%') {
+            continue;
+        }
+        if (*fmt == '%') {
+            ++fmt;
+            continue;
+        }
+
+        while (IsLogFlag(*fmt)) {
+            ++fmt;
+        }
+        if (*fmt == '*') {
+            ++fmt;
+            if (!PutLogIntArg(args, &size, maxlen, va_arg(ap, int))) {
+                return false;
+            }
+        } else {
+            while (SDL_isdigit((unsigned char)*fmt)) {
+                ++fmt;
+            }
+        }
+        if (*fmt == '.') {
+            ++fmt;
+            if (*fmt == '*') {
+                ++fmt;
+                precision = va_arg(ap, int);
+                if (!PutLogIntArg(args, &size, maxlen, precision)) {
+                    return false;
+                }
+            } else {
+                precision = 0;
+                while (SDL_isdigit((unsigned char)*fmt)) {
+                    if (precision <= (SDL_MAX_SINT32 - 9) / 10) {
+                        precision = precision * 10 + (*fmt - '0');
+                    }
+                    ++fmt;
+                }
+            }
+        }
+        fmt = ParseLogArgLength(fmt, &length);
+
+        switch (*fmt++) {
+        case 'd':
+        case 'i':
+        {
+            Sint64 value;
+            switch (length) {
+            case SDL_LOG_ARG_CHAR:
+                value = (signed char)va_arg(ap, int);
+                break;
+            case SDL_LOG_ARG_SHORT:
+                value = (short)va_arg(ap, int);
+                break;
+            case SDL_LOG_ARG_INT:
+                value = va_arg(ap, int);
+                break;
+            case SDL_LOG_ARG_LONG:
+                value = va_arg(ap, long);
+                break;
+            case SDL_LOG_ARG_LONGLONG:
+                value = va_arg(ap, long long);
+                break;
+            case SDL_LOG_ARG_SIZE_T:
+            case SDL_LOG_ARG_PTRDIFF_T:
+                value = va_arg(ap, ptrdiff_t);
+                break;
+            case SDL_LOG_ARG_INTMAX_T:
+                value = va_arg(ap, intmax_t);
+                break;
+            default:
+                return false;
+            }
+            stored = PutLogIntArg(args, &size, maxlen, value);
+            break;
+        }
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        {
+            Uint64 value;
+            switch (length) {
+            case SDL_LOG_ARG_CHAR:
+                value = (unsigned char)va_arg(ap, unsigned int);
+                break;
+            case SDL_LOG_ARG_SHORT:
+                value = (unsigned short)va_arg(ap, unsigned int);
+                break;
+            case SDL_LOG_ARG_INT:
+                value = va_arg(ap, unsigned int);
+                break;
+            case SDL_LOG_ARG_LONG:
+                value = va_arg(ap, unsigned long);
+                break;
+            case SDL_LOG_ARG_LONGLONG:
+                value = va_arg(ap, unsigned long long);
+                break;
+            case SDL_LOG_ARG_SIZE_T:
+            case SDL_LOG_ARG_PTRDIFF_T:
+                value = va_arg(ap, size_t);
+                break;
+            case SDL_LOG_ARG_INTMAX_T:
+                value = va_arg(ap, uintmax_t);
+                break;
+            default:
+                return false;
+            }
+            stored = PutLogArg(args, &size, maxlen, &value, sizeof(value));
+            break;
+        }
+        case 'c':
+            if (length != SDL_LOG_ARG_INT) {
+                return false;
+            }
+            stored = PutLogIntArg(args, &size, maxlen, va_arg(ap, int));
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double value;
+            if (length == SDL_LOG_ARG_LONG_DOUBLE) {
+                return false;
+            }
+            value = va_arg(ap, double);
+            stored = PutLogArg(args, &size, maxlen, &value, sizeof(value));
+            break;
+        }
+        case 'p':
+        {
+            const Uint64 value = (Uint64)(uintptr_t)va_arg(ap, void *);
+            stored = PutLogArg(args, &size, maxlen, &value, sizeof(value));
+            break;
+        }
+        case 's':
+            if (length != SDL_LOG_ARG_INT) {
+                return false;
+            }
+            stored = PutLogStringArg(args, &size, maxlen, va_arg(ap, const char *), precision);
+            break;
+        default:
+            // Wide strings, %n, and anything we don't know about
+            return false;
+        }
+        if (!stored) {
+            return false;
+        }
+    }
+
+    *args_size = size;
+    return true;
+}
+
+void SDL_InitLogRecords(void)
+{
+    // If this fails we'll continue without it.
+    SDL_log_record_lock = SDL_CreateMutex();
+}
+
+void SDL_QuitLogRecords(void)
+{
+    SDL_LogRecordBuffer *buffer, *buffers;
+
+    // Write out anything that hasn't been read
+    SDL_SetAtomicInt(&SDL_log_deferred, 0);
+    SDL_ReadLogRecords(NULL, NULL);
+
+    // Threads that are still running get a new buffer if deferred mode is enabled again
+    SDL_LockMutex(SDL_log_record_lock);
+    {
+        SDL_AddAtomicInt(&SDL_log_record_generation, 1);
+        buffers = SDL_log_record_buffers;
+        SDL_log_record_buffers = NULL;
+    }
+    SDL_UnlockMutex(SDL_log_record_lock);
+
+    while (buffers) {
+        buffer = buffers;
+        buffers = buffer->next;
+        ReleaseLogRecordBuffer(buffer);
+    }
+
+    if (SDL_log_record_lock) {
+        SDL_DestroyMutex(SDL_log_record_lock);
+        SDL_log_record_lock = NULL;
+    }
+}
+
+Uint32 SDL_GetDroppedLogRecords(bool reset)
+{
+    if (reset) {
+        return (Uint32)SDL_SetAtomicInt(&SDL_log_records_dropped, 0);
+    }
+    return (Uint32)SDL_GetAtomicInt(&SDL_log_records_dropped);
+}
+
+bool SDL_CaptureLogRecord(int category, SDL_LogPriority priority, const char *fmt, va_list ap)
+{
+    Uint64 record[SDL_MAX_LOG_RECORD_SIZE / sizeof(Uint64)];
+    SDL_LogRecordHeader *header = (SDL_LogRecordHeader *)record;
+    Uint8 *args = (Uint8 *)record + SDL_LOG_RECORD_HEADER_SIZE;
+    const size_t maxlen = sizeof(record) - SDL_LOG_RECORD_HEADER_SIZE;
+    SDL_LogRecordBuffer *buffer;
+    size_t args_size = 0;
+    bool captured;
+    va_list aq;
+
+    if (!SDL_GetAtomicInt(&SDL_log_deferred)) {
+        return false;
+    }
+
+    // SDL_vsnprintf() treats a NULL format as empty, so do the same
+    if (!fmt) {
+        fmt = "";
+    }
+
+    buffer = GetLogRecordBuffer();
+    if (!buffer) {
+        return false;
+    }
+
+    header->category = category;
+    header->priority = priority;
+    header->timestamp = SDL_GetTicksNS();
+    header->fmt = fmt;
+
+    va_copy(aq, ap);
+    captured = CaptureLogArgs(args, &args_size, maxlen, fmt, aq);
+    va_end(aq);
+
+    if (!captured) {
+        // Format it now, as much as will fit
+        const size_t textlen = maxlen - sizeof(Uint32) - 1;
+        Uint32 length;
+        int len;
+
+        va_copy(aq, ap);
+        len = SDL_vsnprintf((char *)args + sizeof(Uint32), textlen + 1, fmt, aq);
+        va_end(aq);
+        if (len < 0) {
+            return true;
+        }
+
+        length = (Uint32)SDL_min((size_t)len, textlen);
+        SDL_memcpy(args, &length, sizeof(length));
+        args_size = sizeof(length) + length + 1;
+        header->fmt = "%s";
+    }
+
+    header->args_size = (Uint32)args_size;
+    header->size = (Uint32)SDL_LOG_RECORD_ALIGN(SDL_LOG_RECORD_HEADER_SIZE + args_size);
+    if (!PutLogRecord(buffer, record, header->size)) {
+        SDL_AddAtomicInt(&SDL_log_records_dropped, 1);
+    }
+    return true;
+}
+
+bool SDL_SetLogDeferred(bool enabled)
+{
+    SDL_CheckInitLog();
+
+    SDL_SetAtomicInt(&SDL_log_deferred, enabled ? 1 : 0);
+
+    if (!enabled) {
+        SDL_ReadLogRecords(NULL, NULL);
+    }
+    return true;
+}
+
+// Format a record and send it to the log output function
+static void SDLCALL OutputLogRecord(void *userdata, const SDL_LogRecord *record)
+{
+    char stack_buf[SDL_MAX_LOG_MESSAGE_STACK];
+    char *message = stack_buf;
+    int len;
+
+    len = SDL_FormatLogRecord(record, stack_buf, sizeof(stack_buf));
+    if (len < 0) {
+        return;
+    }
+    if (len >= (int)sizeof(stack_buf)) {
+        message = (char *)SDL_malloc((size_t)len + 1);
+        if (!message) {
+            return;
+        }
+        len = SDL_FormatLogRecord(record, message, (size_t)len + 1);
+    }
+
+    // Chop off final endline, like SDL_LogMessageV()
+    if ((len > 0) && (message[len - 1] == '\n')) {
+        message[--len] = '\0';
+        if ((len > 0) && (message[len - 1] == '\r')) {
+            message[--len] = '\0';
+        }
+    }
+
+    SDL_OutputLogMessage(record->category, record->priority, message);
+
+    if (message != stack_buf) {
+        SDL_free(message);
+    }
+}
+
+static int ReadLogRecordBuffer(SDL_LogRecordBuffer *buffer, SDL_LogRecordFunction callback, void *userdata)
+{
+    const Uint8 *data = (const Uint8 *)buffer->data;
+    const Uint32 head = SDL_GetAtomicU32(&buffer->head);
+    Uint32 tail = SDL_GetAtomicU32(&buffer->tail);
+    int count = 0;
+
+    while (tail != head) {
+        const Uint32 offset = tail & (SDL_LOG_RECORD_BUFFER_SIZE - 1);
+        const SDL_LogRecordHeader *header = (const SDL_LogRecordHeader *)(data + offset);
+        SDL_LogRecord record;
+
+        if (header->size == SDL_LOG_RECORD_WRAP) {
+            tail += SDL_LOG_RECORD_BUFFER_SIZE - offset;
+            continue;
+        }
+
+        record.timestamp = header->timestamp;
+        record.thread = buffer->thread;
+        record.category = header->category;
+        record.priority = header->priority;
+        record.fmt = header->fmt;
+        record.args = data + offset + SDL_LOG_RECORD_HEADER_SIZE;
+        record.args_size = (int)header->args_size;
+        callback(userdata, &record);
+        ++count;
+
+        // This lets the thread reuse the space
+        tail += header->size;
+        SDL_SetAtomicU32(&buffer->tail, tail);
+    }
+    SDL_SetAtomicU32(&buffer->tail, tail);
+
+    return count;
+}
+
+int SDL_ReadLogRecords(SDL_LogRecordFunction callback, void *userdata)
+{
+    SDL_LogRecordBuffer *buffer, *next;
+    SDL_LogRecordBuffer **prev;
+    int count = 0;
+
+    if (!callback) {
+        callback = OutputLogRecord;
+    }
+
+    SDL_LockMutex(SDL_log_record_lock);
+    {
+        prev = &SDL_log_record_buffers;
+        for (buffer = SDL_log_record_buffers; buffer; buffer = next) {
+            next = buffer->next;
+
+            count += ReadLogRecordBuffer(buffer, callback, userdata);
+
+            // Free the buffers of threads that have finished, once they're empty
+            if (SDL_GetAtomicInt(&buffer->refcount) == 1 &&
+                SDL_GetAtomicU32(&buffer->head) == SDL_GetAtomicU32(&buffer->tail)) {
+                *prev = next;
+                ReleaseLogRecordBuffer(buffer);
+            } else {
+                prev = &buffer->next;
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_log_record_lock);
+
+    return count;
+}
+
+static bool GetLogArg(const SDL_LogRecord *record, size_t *offset, void *value, size_t length)
+{
+    const size_t aligned = SDL_LOG_RECORD_ALIGN(*offset);
+
+    if (aligned > (size_t)record->args_size || length > (size_t)record->args_size - aligned) {
+        return false;
+    }
+    SDL_memcpy(value, (const Uint8 *)record->args + aligned, length);
+    *offset = aligned + length;
+    return true;
+}
+
+static bool GetLogStringArg(const SDL_LogRecord *record, size_t *offset, const char **string)
+{
+    Uint32 length;
+
+    if (!GetLogArg(record, offset, &length, sizeof(length))) {
+        return false;
+    }
+    if (length == SDL_LOG_RECORD_NULL_STRING) {
+        *string = NULL;
+        return true;
+    }
+    if (length >= (size_t)record->args_size - *offset) {
+        return false;
+    }
+    *string = (const char *)record->args + *offset;
+    *offset += length + 1;
+    return (*string)[length] == '\0';
+}
+
+static bool AppendLogSpec(char *spec, size_t *speclen, size_t maxlen, const char *text, size_t length)
+{
+    if (length >= maxlen - *speclen) {
+        return false;
+    }
+    SDL_memcpy(spec + *speclen, text, length);
+    *speclen += length;
+    spec[*speclen] = '\0';
+    return true;
+}
+
+#ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#endif
+
+/* Each conversion is rebuilt as a format of its own, with the widths and
+   precisions from the arguments filled in, and integers widened to the
+   64-bit values that were captured. */
+int SDL_FormatLogRecord(const SDL_LogRecord *record, char *text, size_t maxlen)
+{
+    const char *fmt;
+    size_t length = 0;
+    size_t offset = 0;
+
+    if (!record) {
+        return SDL_InvalidParamError("record");
+    }
+    if (!text) {
+        maxlen = 0;
+    }
+
+    fmt = record->fmt ? record->fmt : "";
+    while (*fmt) {
+        char spec[64];
+        size_t speclen = 0;
+        SDL_LogArgLength arglength;
+        const char *start;
+        char *output = (length < maxlen) ? text + length : NULL;
+        const size_t outlen = (length < maxlen) ? maxlen - length : 0;
+        int result = 0;
+
+        if (*fmt != '%') {
+            if (length < maxlen) {
+                text[length] = *fmt;
+            }
+            ++length;
+            ++fmt;
+            continue;
+        }
+        ++fmt;
+        if (*fmt == '%') {
+            if (length < maxlen) {
+                text[length] = '%';
+            }
+            ++length;
+            ++fmt;
+            continue;
+        }
+
+        spec[speclen++] = '%';
+        start = fmt;
+        while (IsLogFlag(*fmt)) {
+            ++fmt;
+        }
+        if (!AppendLogSpec(spec, &speclen, sizeof(spec), start, fmt - start)) {
+            goto damaged;
+        }
+
+        if (*fmt == '*') {
+            Sint64 width;
+            char number[32];
+            ++fmt;
+            if (!GetLogArg(record, &offset, &width, sizeof(width))) {
+                goto damaged;
+            }
+            // A negative width means left justified
+            (void)SDL_snprintf(number, sizeof(number), "%s%" SDL_PRIs64, (width < 0) ? "-" : "", (width < 0) ? -width : width);
+            if (!AppendLogSpec(spec, &speclen, sizeof(spec), number, SDL_strlen(number))) {
+                goto damaged;
+            }
+        } else {
+            start = fmt;
+            while (SDL_isdigit((unsigned char)*fmt)) {
+                ++fmt;
+            }
+            if (!AppendLogSpec(spec, &speclen, sizeof(spec), start, fmt - start)) {
+                goto damaged;
+            }
+        }
+
+        if (*fmt == '.') {
+            ++fmt;
+            if (*fmt == '*') {
+                Sint64 precision;
+                ++fmt;
+                if (!GetLogArg(record, &offset, &precision, sizeof(precision))) {
+                    goto damaged;
+                }
+                // A negative precision is the same as none
+                if (precision >= 0) {
+                    char number[32];
+                    (void)SDL_snprintf(number, sizeof(number), ".%" SDL_PRIs64, precision);
+                    if (!AppendLogSpec(spec, &speclen, sizeof(spec), number, SDL_strlen(number))) {
+                        goto damaged;
+                    }
+                }
+            } else {
+                start = fmt - 1;
+                while (SDL_isdigit((unsigned char)*fmt)) {
+                    ++fmt;
+                }
+                if (!AppendLogSpec(spec, &speclen, sizeof(spec), start, fmt - start)) {
+                    goto damaged;
+                }
+            }
+        }
+        fmt = ParseLogArgLength(fmt, &arglength);
+
+        switch (*fmt) {
+        case 'd':
+        case 'i':
+        {
+            Sint64 value;
+            if (!GetLogArg(record, &offset, &value, sizeof(value)) ||
+                !AppendLogSpec(spec, &speclen, sizeof(spec), "ll", 2) ||
+                !AppendLogSpec(spec, &speclen, sizeof(spec), fmt, 1)) {
+                goto damaged;
+            }
+            result = SDL_snprintf(output, outlen, spec, (long long)value);
+            break;
+        }
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        {
+            Uint64 value;
+            if (!GetLogArg(record, &offset, &value, sizeof(value)) ||
+                !AppendLogSpec(spec, &speclen, sizeof(spec), "ll", 2) ||
+                !AppendLogSpec(spec, &speclen, sizeof(spec), fmt, 1)) {
+                goto damaged;
+            }
+            result = SDL_snprintf(output, outlen, spec, (unsigned long long)value);
+            break;
+        }
+        case 'c':
+        {
+            Sint64 value;
+            if (!GetLogArg(record, &offset, &value, sizeof(value)) ||
+                !AppendLogSpec(spec, &speclen, sizeof(spec), fmt, 1)) {
+                goto damaged;
+            }
+            result = SDL_snprintf(output, outlen, spec, (int)value);
+            break;
+        }
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double value;
+            if (!GetLogArg(record, &offset, &value, sizeof(value)) ||
+                !AppendLogSpec(spec, &speclen, sizeof(spec), fmt, 1)) {
+                goto damaged;
+            }
+            result = SDL_snprintf(output, outlen, spec, value);
+            break;
+        }
+        case 'p':
+        {
+            Uint64 value;
+            if (!GetLogArg(record, &offset, &value, sizeof(value)) ||
+                !AppendLogSpec(spec, &speclen, sizeof(spec), fmt, 1)) {
+                goto damaged;
+            }
+            result = SDL_snprintf(output, outlen, spec, (void *)(uintptr_t)value);
+            break;
+        }
+        case 's':
+        {
+            const char *value;
+            if (!GetLogStringArg(record, &offset, &value) ||
+                !AppendLogSpec(spec, &speclen, sizeof(spec), fmt, 1)) {
+                goto damaged;
+            }
+            result = SDL_snprintf(output, outlen, spec, value);
+            break;
+        }
+        default:
+            // This can't have been captured
+            goto damaged;
+        }
+        if (result < 0) {
+            goto damaged;
+        }
+        length += (size_t)result;
+        ++fmt;
+    }
+
+    if (length < maxlen) {
+        text[length] = '\0';
+    } else if (maxlen > 0) {
+        text[maxlen - 1] = '\0';
+    }
+    return (int)SDL_min(length, SDL_MAX_SINT32);
+
+damaged:
+    if (maxlen > 0) {
+        *text = '\0';
+    }
+    SDL_SetError("Log record doesn't match its format");
+    return -1;
+}
+
+#ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
+#pragma GCC diagnostic pop
+#endif
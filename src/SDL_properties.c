@@ -40,12 +40,28 @@ typedef struct
 
     SDL_CleanupPropertyCallback cleanup;
     void *userdata;
+
+    // The name is owned by a property key, instead of by this property
+    bool interned_name;
 } SDL_Property;
 
+typedef struct
+{
+    char *name;
+    Uint32 hash;  // SDL_HashString() of the name
+    SDL_PropertyKey key;
+} SDL_PropertyKeyInfo;
+
 typedef struct
 {
     SDL_HashTable *props;
-    SDL_Mutex *lock;
+
+    // Queries share the lock, so threads reading the same properties don't
+    // wait on each other. The write lock is recursive, so a thread that holds
+    // it can call back into the properties, e.g. from a cleanup callback.
+    SDL_RWLock *lock;
+    SDL_ThreadID owner;
+    int recursive;
 } SDL_Properties;
 
 static SDL_InitState SDL_properties_init;
@@ -53,6 +69,59 @@ static SDL_HashTable *SDL_properties;
 static SDL_AtomicU32 SDL_last_properties_id;
 static SDL_AtomicU32 SDL_global_properties;
 
+/* Keys are indexes into blocks that never move once they're allocated, so
+ * they can be looked up without a lock. Keys keep counting up after
+ * SDL_QuitProperties(), so keys from before then are no longer valid.
+ */
+#define SDL_PROPERTY_KEY_BLOCK_SIZE 256
+#define SDL_MAX_PROPERTY_KEY_BLOCKS 256
+static SDL_Mutex *SDL_property_keys_lock;
+static SDL_HashTable *SDL_property_keys;  // name -> SDL_PropertyKeyInfo
+static SDL_PropertyKeyInfo *SDL_property_key_blocks[SDL_MAX_PROPERTY_KEY_BLOCKS];
+static SDL_AtomicU32 SDL_num_property_keys;
+static Uint32 SDL_first_property_key = 1;
+
+
+// Returns true if a read lock was taken, or false if this thread already has
+// the properties locked for writing.
+static bool LockPropertiesForReading(SDL_Properties *properties)
+{
+    if (properties->owner == SDL_GetCurrentThreadID()) {
+        return false;
+    }
+    SDL_LockRWLockForReading(properties->lock);
+    return true;
+}
+
+static void UnlockPropertiesForReading(SDL_Properties *properties, bool locked)
+{
+    if (locked) {
+        SDL_UnlockRWLock(properties->lock);
+    }
+}
+
+static void LockPropertiesForWriting(SDL_Properties *properties)
+{
+    const SDL_ThreadID this_thread = SDL_GetCurrentThreadID();
+
+    if (properties->owner == this_thread) {
+        ++properties->recursive;
+    } else {
+        SDL_LockRWLockForWriting(properties->lock);
+        properties->owner = this_thread;
+        properties->recursive = 0;
+    }
+}
+
+static void UnlockPropertiesForWriting(SDL_Properties *properties)
+{
+    if (properties->recursive) {
+        --properties->recursive;
+    } else {
+        properties->owner = 0;
+        SDL_UnlockRWLock(properties->lock);
+    }
+}
 
 static void SDL_FreePropertyWithCleanup(const void *key, const void *value, void *data, bool cleanup)
 {
@@ -72,7 +141,9 @@ static void SDL_FreePropertyWithCleanup(const void *key, const void *value, void
         }
         SDL_free(property->string_storage);
     }
-    SDL_free((void *)key);
+    if (!property || !property->interned_name) {
+        SDL_free((void *)key);
+    }
     SDL_free((void *)value);
 }
 
@@ -85,7 +156,7 @@ static void SDL_FreeProperties(SDL_Properties *properties)
 {
     if (properties) {
         SDL_DestroyHashTable(properties->props);
-        SDL_DestroyMutex(properties->lock);
+        SDL_DestroyRWLock(properties->lock);
         SDL_free(properties);
     }
 }
@@ -97,7 +168,17 @@ bool SDL_InitProperties(void)
     }
 
     SDL_properties = SDL_CreateHashTable(0, true, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
-    const bool initialized = (SDL_properties != NULL);
+    SDL_property_keys_lock = SDL_CreateMutex();
+    SDL_property_keys = SDL_CreateHashTable(0, true, SDL_HashString, SDL_KeyMatchString, NULL, NULL);
+    const bool initialized = (SDL_properties && SDL_property_keys_lock && SDL_property_keys);
+    if (!initialized) {
+        SDL_DestroyHashTable(SDL_properties);
+        SDL_properties = NULL;
+        SDL_DestroyMutex(SDL_property_keys_lock);
+        SDL_property_keys_lock = NULL;
+        SDL_DestroyHashTable(SDL_property_keys);
+        SDL_property_keys = NULL;
+    }
     SDL_SetInitialized(&SDL_properties_init, initialized);
     return initialized;
 }
@@ -131,6 +212,22 @@ void SDL_QuitProperties(void)
     SDL_IterateHashTable(properties, FreeOneProperties, NULL);
     SDL_DestroyHashTable(properties);
 
+    // No properties are left that use the key names, so the keys can go too
+    const Uint32 num_keys = SDL_GetAtomicU32(&SDL_num_property_keys);
+    for (Uint32 i = 0; i < num_keys; ++i) {
+        SDL_free(SDL_property_key_blocks[i / SDL_PROPERTY_KEY_BLOCK_SIZE][i % SDL_PROPERTY_KEY_BLOCK_SIZE].name);
+    }
+    for (int i = 0; i < SDL_MAX_PROPERTY_KEY_BLOCKS; ++i) {
+        SDL_free(SDL_property_key_blocks[i]);
+        SDL_property_key_blocks[i] = NULL;
+    }
+    SDL_first_property_key += num_keys;
+    SDL_SetAtomicU32(&SDL_num_property_keys, 0);
+    SDL_DestroyHashTable(SDL_property_keys);
+    SDL_property_keys = NULL;
+    SDL_DestroyMutex(SDL_property_keys_lock);
+    SDL_property_keys_lock = NULL;
+
     SDL_SetInitialized(&SDL_properties_init, false);
 }
 
@@ -153,6 +250,99 @@ SDL_PropertiesID SDL_GetGlobalProperties(void)
     return props;
 }
 
+static const SDL_PropertyKeyInfo *GetPropertyKeyInfo(SDL_PropertyKey key)
+{
+    const Uint32 index = key - SDL_first_property_key;
+
+    if (key < SDL_first_property_key || index >= SDL_GetAtomicU32(&SDL_num_property_keys)) {
+        return NULL;
+    }
+    return &SDL_property_key_blocks[index / SDL_PROPERTY_KEY_BLOCK_SIZE][index % SDL_PROPERTY_KEY_BLOCK_SIZE];
+}
+
+// Returns the key info for name if it has a key, without creating one
+static const SDL_PropertyKeyInfo *FindPropertyKeyInfo(const char *name)
+{
+    const SDL_PropertyKeyInfo *info = NULL;
+
+    if (SDL_property_keys) {
+        SDL_FindInHashTable(SDL_property_keys, name, (const void **)&info);
+    }
+    return info;
+}
+
+SDL_PropertyKey SDL_FindPropertyKey(const char *name)
+{
+    const SDL_PropertyKeyInfo *info = FindPropertyKeyInfo(name);
+    return info ? info->key : 0;
+}
+
+SDL_PropertyKey SDL_GetPropertyKey(const char *name)
+{
+    SDL_PropertyKeyInfo *info = NULL;
+
+    if (!name || !*name) {
+        SDL_InvalidParamError("name");
+        return 0;
+    }
+
+    if (!SDL_CheckInitProperties()) {
+        return 0;
+    }
+
+    if (SDL_FindInHashTable(SDL_property_keys, name, (const void **)&info)) {
+        return info->key;
+    }
+
+    SDL_PropertyKey key = 0;
+
+    SDL_LockMutex(SDL_property_keys_lock);
+    if (SDL_FindInHashTable(SDL_property_keys, name, (const void **)&info)) {
+        // Somebody else created the key before us
+        key = info->key;
+    } else {
+        const Uint32 index = SDL_GetAtomicU32(&SDL_num_property_keys);
+        const Uint32 block = index / SDL_PROPERTY_KEY_BLOCK_SIZE;
+
+        if (block >= SDL_MAX_PROPERTY_KEY_BLOCKS) {
+            SDL_SetError("Too many property keys");
+        } else {
+            if (!SDL_property_key_blocks[block]) {
+                SDL_property_key_blocks[block] = (SDL_PropertyKeyInfo *)SDL_calloc(SDL_PROPERTY_KEY_BLOCK_SIZE, sizeof(SDL_PropertyKeyInfo));
+            }
+            if (SDL_property_key_blocks[block]) {
+                info = &SDL_property_key_blocks[block][index % SDL_PROPERTY_KEY_BLOCK_SIZE];
+                info->name = SDL_strdup(name);
+                if (info->name) {
+                    info->hash = SDL_HashString(NULL, info->name);
+                    info->key = SDL_first_property_key + index;
+                    if (SDL_InsertIntoHashTable(SDL_property_keys, info->name, info, false)) {
+                        // The key is complete, make it visible to GetPropertyKeyInfo()
+                        SDL_SetAtomicU32(&SDL_num_property_keys, index + 1);
+                        key = info->key;
+                    } else {
+                        SDL_free(info->name);
+                        SDL_zerop(info);
+                    }
+                }
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_property_keys_lock);
+
+    return key;
+}
+
+const char *SDL_GetPropertyKeyName(SDL_PropertyKey key)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        SDL_InvalidParamError("key");
+        return NULL;
+    }
+    return info->name;
+}
+
 SDL_PropertiesID SDL_CreateProperties(void)
 {
     if (!SDL_CheckInitProperties()) {
@@ -164,7 +354,7 @@ SDL_PropertiesID SDL_CreateProperties(void)
         return 0;
     }
 
-    properties->lock = SDL_CreateMutex();
+    properties->lock = SDL_CreateRWLock();
     if (!properties->lock) {
         SDL_free(properties);
         return 0;
@@ -172,7 +362,7 @@ SDL_PropertiesID SDL_CreateProperties(void)
 
     properties->props = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, SDL_FreeProperty, NULL);
     if (!properties->props) {
-        SDL_DestroyMutex(properties->lock);
+        SDL_DestroyRWLock(properties->lock);
         SDL_free(properties);
         return 0;
     }
@@ -216,7 +406,7 @@ static bool SDLCALL CopyOneProperty(void *userdata, const SDL_HashTable *table,
     const char *src_name = (const char *)key;
     SDL_Property *dst_property;
 
-    char *dst_name = SDL_strdup(src_name);
+    char *dst_name = src_property->interned_name ? (char *)src_name : SDL_strdup(src_name);
     if (!dst_name) {
         data->result = false;
         return true; // keep iterating (I guess...?)
@@ -224,7 +414,9 @@ static bool SDLCALL CopyOneProperty(void *userdata, const SDL_HashTable *table,
 
     dst_property = (SDL_Property *)SDL_malloc(sizeof(*dst_property));
     if (!dst_property) {
-        SDL_free(dst_name);
+        if (!src_property->interned_name) {
+            SDL_free(dst_name);
+        }
         data->result = false;
         return true; // keep iterating (I guess...?)
     }
@@ -233,7 +425,9 @@ static bool SDLCALL CopyOneProperty(void *userdata, const SDL_HashTable *table,
     if (src_property->type == SDL_PROPERTY_TYPE_STRING) {
         dst_property->value.string_value = SDL_strdup(src_property->value.string_value);
         if (!dst_property->value.string_value) {
-            SDL_free(dst_name);
+            if (!src_property->interned_name) {
+                SDL_free(dst_name);
+            }
             SDL_free(dst_property);
             data->result = false;
             return true; // keep iterating (I guess...?)
@@ -270,15 +464,15 @@ bool SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
     }
 
     bool result = true;
-    SDL_LockMutex(src_properties->lock);
-    SDL_LockMutex(dst_properties->lock);
+    LockPropertiesForWriting(src_properties);
+    LockPropertiesForWriting(dst_properties);
     {
         CopyOnePropertyData data = { dst_properties, true };
         SDL_IterateHashTable(src_properties->props, CopyOneProperty, &data);
         result = data.result;
     }
-    SDL_UnlockMutex(dst_properties->lock);
-    SDL_UnlockMutex(src_properties->lock);
+    UnlockPropertiesForWriting(dst_properties);
+    UnlockPropertiesForWriting(src_properties);
 
     return result;
 }
@@ -296,7 +490,7 @@ bool SDL_LockProperties(SDL_PropertiesID props)
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(properties->lock);
+    LockPropertiesForWriting(properties);
     return true;
 }
 
@@ -313,10 +507,18 @@ void SDL_UnlockProperties(SDL_PropertiesID props)
         return;
     }
 
-    SDL_UnlockMutex(properties->lock);
+    UnlockPropertiesForWriting(properties);
+}
+
+static bool FindProperty(SDL_Properties *properties, const char *name, const SDL_PropertyKeyInfo *info, SDL_Property **property)
+{
+    if (info) {
+        return SDL_FindInHashTableWithHash(properties->props, info->name, info->hash, (const void **)property);
+    }
+    return SDL_FindInHashTable(properties->props, name, (const void **)property);
 }
 
-static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL_Property *property)
+static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, SDL_Property *property)
 {
     SDL_Properties *properties = NULL;
     bool result = true;
@@ -336,23 +538,34 @@ static bool SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(properties->lock);
+    // If the name has a key, share its name, so getting by key can compare pointers instead of strings
+    if (!info) {
+        info = FindPropertyKeyInfo(name);
+    }
+
+    LockPropertiesForWriting(properties);
     {
         SDL_RemoveFromHashTable(properties->props, name);
         if (property) {
-            char *key = SDL_strdup(name);
+            char *key;
+            if (info) {
+                key = info->name;
+                property->interned_name = true;
+            } else {
+                key = SDL_strdup(name);
+            }
             if (!key || !SDL_InsertIntoHashTable(properties->props, key, property, false)) {
                 SDL_FreePropertyWithCleanup(key, property, NULL, true);
                 result = false;
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    UnlockPropertiesForWriting(properties);
 
     return result;
 }
 
-bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
+static bool SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
 {
     SDL_Property *property;
 
@@ -360,7 +573,7 @@ bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name,
         if (cleanup) {
             cleanup(userdata, value);
         }
-        return SDL_ClearProperty(props, name);
+        return SDL_PrivateSetProperty(props, name, info, NULL);
     }
 
     property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
@@ -375,15 +588,15 @@ bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name,
     property->value.pointer_value = value;
     property->cleanup = cleanup;
     property->userdata = userdata;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, info, property);
 }
 
-bool SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *value)
+static bool SetPointerProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, void *value)
 {
     SDL_Property *property;
 
     if (!value) {
-        return SDL_ClearProperty(props, name);
+        return SDL_PrivateSetProperty(props, name, info, NULL);
     }
 
     property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
@@ -392,7 +605,7 @@ bool SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *valu
     }
     property->type = SDL_PROPERTY_TYPE_POINTER;
     property->value.pointer_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, info, property);
 }
 
 static void SDLCALL CleanupFreeableProperty(void *userdata, void *value)
@@ -417,12 +630,12 @@ bool SDL_SetSurfaceProperty(SDL_PropertiesID props, const char *name, SDL_Surfac
     return SDL_SetPointerPropertyWithCleanup(props, name, surface, CleanupSurface, NULL);
 }
 
-bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value)
+static bool SetStringProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, const char *value)
 {
     SDL_Property *property;
 
     if (!value) {
-        return SDL_ClearProperty(props, name);
+        return SDL_PrivateSetProperty(props, name, info, NULL);
     }
 
     property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
@@ -435,10 +648,10 @@ bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char
         SDL_free(property);
         return false;
     }
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, info, property);
 }
 
-bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
+static bool SetNumberProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, Sint64 value)
 {
     SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
     if (!property) {
@@ -446,10 +659,10 @@ bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 valu
     }
     property->type = SDL_PROPERTY_TYPE_NUMBER;
     property->value.number_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, info, property);
 }
 
-bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
+static bool SetFloatProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, float value)
 {
     SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
     if (!property) {
@@ -457,10 +670,10 @@ bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
     }
     property->type = SDL_PROPERTY_TYPE_FLOAT;
     property->value.float_value = value;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, info, property);
 }
 
-bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value)
+static bool SetBooleanProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, bool value)
 {
     SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
     if (!property) {
@@ -468,15 +681,10 @@ bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value
     }
     property->type = SDL_PROPERTY_TYPE_BOOLEAN;
     property->value.boolean_value = value ? true : false;
-    return SDL_PrivateSetProperty(props, name, property);
+    return SDL_PrivateSetProperty(props, name, info, property);
 }
 
-bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
-{
-    return (SDL_GetPropertyType(props, name) != SDL_PROPERTY_TYPE_INVALID);
-}
-
-SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
+static SDL_PropertyType GetPropertyType(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info)
 {
     SDL_Properties *properties = NULL;
     SDL_PropertyType type = SDL_PROPERTY_TYPE_INVALID;
@@ -493,19 +701,19 @@ SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (FindProperty(properties, name, info, &property)) {
             type = property->type;
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    UnlockPropertiesForReading(properties, locked);
 
     return type;
 }
 
-void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value)
+static void *GetPointerProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, void *default_value)
 {
     SDL_Properties *properties = NULL;
     void *value = default_value;
@@ -525,24 +733,64 @@ void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *def
     // Note that taking the lock here only guarantees that we won't read the
     // hashtable while it's being modified. The value itself can easily be
     // freed from another thread after it is returned here.
-    SDL_LockMutex(properties->lock);
+    const bool locked = LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (FindProperty(properties, name, info, &property)) {
             if (property->type == SDL_PROPERTY_TYPE_POINTER) {
                 value = property->value.pointer_value;
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
-const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+// Returns false if the value has to be converted to a string first, and
+// convert is false.
+static bool SDL_GetPropertyString(SDL_Property *property, bool convert, const char **value)
+{
+    switch (property->type) {
+    case SDL_PROPERTY_TYPE_STRING:
+        *value = property->value.string_value;
+        break;
+    case SDL_PROPERTY_TYPE_NUMBER:
+        if (!property->string_storage) {
+            if (!convert) {
+                return false;
+            }
+            SDL_asprintf(&property->string_storage, "%" SDL_PRIs64, property->value.number_value);
+        }
+        if (property->string_storage) {
+            *value = property->string_storage;
+        }
+        break;
+    case SDL_PROPERTY_TYPE_FLOAT:
+        if (!property->string_storage) {
+            if (!convert) {
+                return false;
+            }
+            SDL_asprintf(&property->string_storage, "%f", property->value.float_value);
+        }
+        if (property->string_storage) {
+            *value = property->string_storage;
+        }
+        break;
+    case SDL_PROPERTY_TYPE_BOOLEAN:
+        *value = property->value.boolean_value ? "true" : "false";
+        break;
+    default:
+        break;
+    }
+    return true;
+}
+
+static const char *GetStringProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, const char *default_value)
 {
     SDL_Properties *properties = NULL;
     const char *value = default_value;
+    bool converted = true;
 
     if (!props) {
         return value;
@@ -556,48 +804,32 @@ const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, cons
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
-            switch (property->type) {
-            case SDL_PROPERTY_TYPE_STRING:
-                value = property->value.string_value;
-                break;
-            case SDL_PROPERTY_TYPE_NUMBER:
-                if (property->string_storage) {
-                    value = property->string_storage;
-                } else {
-                    SDL_asprintf(&property->string_storage, "%" SDL_PRIs64, property->value.number_value);
-                    if (property->string_storage) {
-                        value = property->string_storage;
-                    }
-                }
-                break;
-            case SDL_PROPERTY_TYPE_FLOAT:
-                if (property->string_storage) {
-                    value = property->string_storage;
-                } else {
-                    SDL_asprintf(&property->string_storage, "%f", property->value.float_value);
-                    if (property->string_storage) {
-                        value = property->string_storage;
-                    }
-                }
-                break;
-            case SDL_PROPERTY_TYPE_BOOLEAN:
-                value = property->value.boolean_value ? "true" : "false";
-                break;
-            default:
-                break;
+        if (FindProperty(properties, name, info, &property)) {
+            converted = SDL_GetPropertyString(property, !locked, &value);
+        }
+    }
+    UnlockPropertiesForReading(properties, locked);
+
+    if (!converted) {
+        // Converting the value changes the property, so other readers can't share the lock.
+        // The property may have changed while unlocked, so look it up again.
+        LockPropertiesForWriting(properties);
+        {
+            SDL_Property *property = NULL;
+            if (FindProperty(properties, name, info, &property)) {
+                SDL_GetPropertyString(property, true, &value);
             }
         }
+        UnlockPropertiesForWriting(properties);
     }
-    SDL_UnlockMutex(properties->lock);
 
     return value;
 }
 
-Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+static Sint64 GetNumberProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, Sint64 default_value)
 {
     SDL_Properties *properties = NULL;
     Sint64 value = default_value;
@@ -614,10 +846,10 @@ Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 de
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (FindProperty(properties, name, info, &property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = (Sint64)SDL_strtoll(property->value.string_value, NULL, 0);
@@ -636,12 +868,12 @@ Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 de
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
-float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+static float GetFloatProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, float default_value)
 {
     SDL_Properties *properties = NULL;
     float value = default_value;
@@ -658,10 +890,10 @@ float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float defau
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (FindProperty(properties, name, info, &property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = (float)SDL_atof(property->value.string_value);
@@ -680,12 +912,12 @@ float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float defau
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
-bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
+static bool GetBooleanProperty(SDL_PropertiesID props, const char *name, const SDL_PropertyKeyInfo *info, bool default_value)
 {
     SDL_Properties *properties = NULL;
     bool value = default_value ? true : false;
@@ -702,10 +934,10 @@ bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool defau
         return value;
     }
 
-    SDL_LockMutex(properties->lock);
+    const bool locked = LockPropertiesForReading(properties);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (FindProperty(properties, name, info, &property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = SDL_GetStringBoolean(property->value.string_value, default_value);
@@ -724,14 +956,205 @@ bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool defau
             }
         }
     }
-    SDL_UnlockMutex(properties->lock);
+    UnlockPropertiesForReading(properties, locked);
 
     return value;
 }
 
+
+bool SDL_SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
+{
+    return SetPointerPropertyWithCleanup(props, name, NULL, value, cleanup, userdata);
+}
+
+bool SDL_SetPointerProperty(SDL_PropertiesID props, const char *name, void *value)
+{
+    return SetPointerProperty(props, name, NULL, value);
+}
+
+bool SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value)
+{
+    return SetStringProperty(props, name, NULL, value);
+}
+
+bool SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
+{
+    return SetNumberProperty(props, name, NULL, value);
+}
+
+bool SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
+{
+    return SetFloatProperty(props, name, NULL, value);
+}
+
+bool SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value)
+{
+    return SetBooleanProperty(props, name, NULL, value);
+}
+
+SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
+{
+    return GetPropertyType(props, name, NULL);
+}
+
+void *SDL_GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value)
+{
+    return GetPointerProperty(props, name, NULL, default_value);
+}
+
+const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+{
+    return GetStringProperty(props, name, NULL, default_value);
+}
+
+Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+{
+    return GetNumberProperty(props, name, NULL, default_value);
+}
+
+float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+{
+    return GetFloatProperty(props, name, NULL, default_value);
+}
+
+bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
+{
+    return GetBooleanProperty(props, name, NULL, default_value);
+}
+
+bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
+{
+    return (GetPropertyType(props, name, NULL) != SDL_PROPERTY_TYPE_INVALID);
+}
+
 bool SDL_ClearProperty(SDL_PropertiesID props, const char *name)
 {
-    return SDL_PrivateSetProperty(props, name, NULL);
+    return SDL_PrivateSetProperty(props, name, NULL, NULL);
+}
+
+bool SDL_SetPointerPropertyWithCleanupByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        if (cleanup) {
+            cleanup(userdata, value);
+        }
+        return SDL_InvalidParamError("key");
+    }
+    return SetPointerPropertyWithCleanup(props, info->name, info, value, cleanup, userdata);
+}
+
+bool SDL_SetPointerPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return SDL_InvalidParamError("key");
+    }
+    return SetPointerProperty(props, info->name, info, value);
+}
+
+bool SDL_SetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, const char *value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return SDL_InvalidParamError("key");
+    }
+    return SetStringProperty(props, info->name, info, value);
+}
+
+bool SDL_SetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, Sint64 value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return SDL_InvalidParamError("key");
+    }
+    return SetNumberProperty(props, info->name, info, value);
+}
+
+bool SDL_SetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, float value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return SDL_InvalidParamError("key");
+    }
+    return SetFloatProperty(props, info->name, info, value);
+}
+
+bool SDL_SetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, bool value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return SDL_InvalidParamError("key");
+    }
+    return SetBooleanProperty(props, info->name, info, value);
+}
+
+SDL_PropertyType SDL_GetPropertyTypeByKey(SDL_PropertiesID props, SDL_PropertyKey key)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return SDL_PROPERTY_TYPE_INVALID;
+    }
+    return GetPropertyType(props, info->name, info);
+}
+
+void *SDL_GetPointerPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *default_value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return default_value;
+    }
+    return GetPointerProperty(props, info->name, info, default_value);
+}
+
+const char *SDL_GetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, const char *default_value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return default_value;
+    }
+    return GetStringProperty(props, info->name, info, default_value);
+}
+
+Sint64 SDL_GetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, Sint64 default_value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return default_value;
+    }
+    return GetNumberProperty(props, info->name, info, default_value);
+}
+
+float SDL_GetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, float default_value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return default_value;
+    }
+    return GetFloatProperty(props, info->name, info, default_value);
+}
+
+bool SDL_GetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, bool default_value)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return default_value;
+    }
+    return GetBooleanProperty(props, info->name, info, default_value);
+}
+
+bool SDL_HasPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key)
+{
+    return (SDL_GetPropertyTypeByKey(props, key) != SDL_PROPERTY_TYPE_INVALID);
+}
+
+bool SDL_ClearPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key)
+{
+    const SDL_PropertyKeyInfo *info = GetPropertyKeyInfo(key);
+    if (!info) {
+        return SDL_InvalidParamError("key");
+    }
+    return SDL_PrivateSetProperty(props, info->name, info, NULL);
 }
 
 typedef struct EnumerateOnePropertyData
@@ -767,12 +1190,12 @@ bool SDL_EnumerateProperties(SDL_PropertiesID props, SDL_EnumeratePropertiesCall
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(properties->lock);
+    LockPropertiesForWriting(properties);
     {
         EnumerateOnePropertyData data = { callback, userdata, props };
         SDL_IterateHashTable(properties->props, EnumerateOneProperty, &data);
     }
-    SDL_UnlockMutex(properties->lock);
+    UnlockPropertiesForWriting(properties);
 
     return true;
 }
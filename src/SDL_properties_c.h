@@ -20,6 +20,7 @@
 */
 
 extern bool SDL_InitProperties(void);
+extern SDL_PropertyKey SDL_FindPropertyKey(const char *name);
 extern bool SDL_SetFreeableProperty(SDL_PropertiesID props, const char *name, void *value);
 extern bool SDL_SetSurfaceProperty(SDL_PropertiesID props, const char *name, SDL_Surface *surface);
 extern bool SDL_DumpProperties(SDL_PropertiesID props);
@@ -909,6 +909,160 @@ static Uint32 SDLCALL HashAudioDeviceID(void *userdata, const void *key)
     return ((Uint32) ((uintptr_t) key)) >> 2;
 }
 
+/* Audio mix threads. When SDL_HINT_AUDIO_MIX_THREADS is set, playback devices queue a batch of jobs (one per bound
+   stream) each period, and this pool converts those streams in parallel while the device thread waits to mix them. */
+
+typedef struct SDL_AudioMixJob
+{
+    SDL_LogicalAudioDevice *logdev;
+    SDL_AudioStream *stream;  // NULL for the entry that starts each logical device's jobs.
+    float *buffer;
+    float gain;  // the total gain to apply while mixing; set when the job runs.
+    int result;  // bytes written to `buffer`, or -1 on failure.
+    bool on_device_thread;  // true if the mix threads must leave this job alone.
+} SDL_AudioMixJob;
+
+typedef struct SDL_AudioMixBatch
+{
+    SDL_AudioDevice *device;
+    SDL_AudioMixJob *jobs;
+    int num_jobs;
+    int next_job;  // jobs before this have been claimed (or don't need claiming).
+    int jobs_left;  // jobs for the mix threads that haven't finished yet.
+    int buffer_size;
+    struct SDL_AudioMixBatch *next;
+} SDL_AudioMixBatch;
+
+static void RunAudioMixJob(SDL_AudioDevice *device, SDL_AudioMixJob *job, int buffer_size)
+{
+    job->result = SDL_GetAudioStreamDataDeferGain(job->stream, job->buffer, buffer_size, job->logdev->gain, &job->gain);
+
+    // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
+    if ((job->result > 0) && !SDL_AudioChannelMapsEqual(device->spec.channels, job->stream->dst_chmap, device->chmap)) {
+        ConvertAudio(job->result / SDL_AUDIO_FRAMESIZE(device->spec), job->buffer, device->spec.format, device->spec.channels, NULL,
+                     job->buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
+    }
+}
+
+// Claim the next job the mix threads may run, from `batch` (or any queued batch if NULL). You must hold current_audio.mix_lock!
+static SDL_AudioMixJob *ClaimAudioMixJob(SDL_AudioMixBatch *batch, SDL_AudioMixBatch **claimed_from)
+{
+    SDL_AudioMixBatch **prev = &current_audio.mix_batches;
+    SDL_AudioMixBatch *i;
+
+    for (i = *prev; i && batch && (i != batch); i = i->next) {
+        prev = &i->next;
+    }
+
+    if (!i) {
+        return NULL;
+    }
+
+    // queued batches always have at least one unclaimed job at next_job, see below.
+    SDL_assert(i->next_job < i->num_jobs);
+    SDL_assert(!i->jobs[i->next_job].on_device_thread);
+    SDL_AudioMixJob *job = &i->jobs[i->next_job++];
+
+    while ((i->next_job < i->num_jobs) && i->jobs[i->next_job].on_device_thread) {
+        i->next_job++;
+    }
+
+    if (i->next_job == i->num_jobs) {
+        *prev = i->next;  // nothing left to claim, take it off the queue.
+    }
+
+    *claimed_from = i;
+    return job;
+}
+
+static int SDLCALL AudioMixThread(void *data)
+{
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+
+    SDL_LockMutex(current_audio.mix_lock);
+    while (!current_audio.mix_shutdown) {
+        SDL_AudioMixBatch *batch = NULL;
+        SDL_AudioMixJob *job = ClaimAudioMixJob(NULL, &batch);
+        if (!job) {
+            SDL_WaitCondition(current_audio.mix_cond, current_audio.mix_lock);
+            continue;
+        }
+
+        // the batch stays alive until its last job finishes, so it's safe to use without the lock.
+        SDL_UnlockMutex(current_audio.mix_lock);
+        RunAudioMixJob(batch->device, job, batch->buffer_size);
+        SDL_LockMutex(current_audio.mix_lock);
+
+        if (--batch->jobs_left == 0) {
+            SDL_BroadcastCondition(current_audio.mix_done_cond);
+        }
+    }
+    SDL_UnlockMutex(current_audio.mix_lock);
+
+    return 0;
+}
+
+static void QuitAudioMixThreads(void)
+{
+    if (current_audio.mix_lock) {
+        SDL_LockMutex(current_audio.mix_lock);
+        current_audio.mix_shutdown = true;
+        SDL_BroadcastCondition(current_audio.mix_cond);
+        SDL_UnlockMutex(current_audio.mix_lock);
+    }
+
+    for (int i = 0; i < current_audio.num_mix_threads; ++i) {
+        SDL_WaitThread(current_audio.mix_threads[i], NULL);
+    }
+
+    SDL_assert(current_audio.mix_batches == NULL);
+
+    SDL_free(current_audio.mix_threads);
+    SDL_DestroyCondition(current_audio.mix_done_cond);
+    SDL_DestroyCondition(current_audio.mix_cond);
+    SDL_DestroyMutex(current_audio.mix_lock);
+    current_audio.mix_threads = NULL;
+    current_audio.num_mix_threads = 0;
+    current_audio.mix_done_cond = NULL;
+    current_audio.mix_cond = NULL;
+    current_audio.mix_lock = NULL;
+    current_audio.mix_shutdown = false;
+}
+
+// The mix threads are optional; if we can't start them, devices just convert their streams themselves.
+static void InitAudioMixThreads(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_MIX_THREADS);
+    const int num_threads = hint ? SDL_clamp(SDL_atoi(hint), 0, 64) : 0;
+
+    if (num_threads == 0) {
+        return;
+    }
+
+    current_audio.mix_lock = SDL_CreateMutex();
+    current_audio.mix_cond = SDL_CreateCondition();
+    current_audio.mix_done_cond = SDL_CreateCondition();
+    current_audio.mix_threads = (SDL_Thread **) SDL_calloc(num_threads, sizeof (SDL_Thread *));
+    if (!current_audio.mix_lock || !current_audio.mix_cond || !current_audio.mix_done_cond || !current_audio.mix_threads) {
+        QuitAudioMixThreads();
+        return;
+    }
+
+    for (int i = 0; i < num_threads; ++i) {
+        char name[64];
+        (void)SDL_snprintf(name, sizeof (name), "SDLAudioMix%d", i);
+        SDL_Thread *thread = SDL_CreateThread(AudioMixThread, name, NULL);
+        if (!thread) {
+            break;
+        }
+        current_audio.mix_threads[current_audio.num_mix_threads++] = thread;
+    }
+
+    if (current_audio.num_mix_threads == 0) {
+        QuitAudioMixThreads();
+    }
+}
+
 // !!! FIXME: the video subsystem does SDL_VideoInit, not SDL_InitVideo. Make this match.
 bool SDL_InitAudio(const char *driver_name)
 {
@@ -1020,6 +1174,7 @@ bool SDL_InitAudio(const char *driver_name)
     }
 
     CompleteAudioEntryPoints();
+    InitAudioMixThreads();
 
     // Make sure we have a list of devices available at startup...
     SDL_AudioDevice *default_playback = NULL;
@@ -1093,6 +1248,9 @@ void SDL_QuitAudio(void)
 
     SDL_IterateHashTable(device_hash, DestroyOnePhysicalAudioDevice, NULL);
 
+    // all the device threads are gone, so nothing can queue more work for these.
+    QuitAudioMixThreads();
+
     // Free the driver data
     current_audio.impl.Deinitialize();
 
@@ -1107,13 +1265,247 @@ void SDL_AudioThreadFinalize(SDL_AudioDevice *device)
 {
 }
 
-static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
+/* Pull the next chunk of `stream`'s data into `mix_buffer`. If nothing has been mixed into that buffer yet (`*silent`),
+   the stream renders straight into it and is scaled and clamped in place, so we skip silencing the buffer. Otherwise the
+   data goes through the work buffer and is scaled and accumulated in one pass. Either way the gain is applied after
+   conversion, like MixAudioStreamsInParallel does, so both paths produce the same output. */
+static bool MixAudioStream(SDL_AudioDevice *device, SDL_LogicalAudioDevice *logdev, SDL_AudioStream *stream, float *mix_buffer, int buffer_size, bool *silent)
+{
+    const int frame_size = SDL_AUDIO_FRAMESIZE(device->spec);
+    const bool swizzle = !SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap);
+
+    /* this will hold a lock on `stream` while getting. We don't explicitly lock the streams
+       for iterating here because the binding linked list can only change while the device lock is held.
+       (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
+       the same stream to different devices at the same time, though.) */
+    if (*silent) {
+        float gain = 1.0f;
+        const int br = SDL_GetAudioStreamDataDeferGain(stream, mix_buffer, buffer_size, logdev->gain, &gain);
+        if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+            return false;
+        } else if (br > 0) {
+            // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
+            if (swizzle) {
+                ConvertAudio(br / frame_size, mix_buffer, device->spec.format, device->spec.channels, NULL,
+                             mix_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
+            }
+            ScaleClampFloat32Audio(mix_buffer, mix_buffer, br / sizeof (float), gain);
+            if (br < buffer_size) {
+                SDL_memset(((Uint8 *) mix_buffer) + br, '\0', buffer_size - br);  // silence whatever we didn't write to.
+            }
+            *silent = false;
+        }
+    } else {
+        float gain = 1.0f;
+        const int br = SDL_GetAudioStreamDataDeferGain(stream, device->work_buffer, buffer_size, logdev->gain, &gain);
+        if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+            return false;
+        } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
+            if (swizzle) {
+                ConvertAudio(br / frame_size, device->work_buffer, device->spec.format, device->spec.channels, NULL,
+                             device->work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
+            }
+            MixFloat32Audio(mix_buffer, (const float *) device->work_buffer, br / sizeof (float), gain);
+        }
+    }
+
+    return true;
+}
+
+// Add a stream's converted data to `mix_buffer`, or scale it straight in if nothing has been mixed there yet. Either way the result is clamped.
+static void AccumulateAudio(float *mix_buffer, const float *src, int br, int buffer_size, float gain, bool *silent)
+{
+    if (*silent) {
+        ScaleClampFloat32Audio(mix_buffer, src, br / sizeof (float), gain);
+        if (br < buffer_size) {
+            SDL_memset(((Uint8 *) mix_buffer) + br, '\0', buffer_size - br);  // silence whatever we didn't write to.
+        }
+        *silent = false;
+    } else {
+        MixFloat32Audio(mix_buffer, src, br / sizeof (float), gain);
+    }
+}
+
+// Run a logical device's postmix callback, if any, and add its output to the final mix.
+static void FinishLogicalDeviceMix(SDL_AudioDevice *device, SDL_LogicalAudioDevice *logdev, const SDL_AudioSpec *outspec, int buffer_size, bool postmix_silent, float *final_mix_buffer, bool *final_mix_silent)
 {
-    if (!SDL_MixAudio((Uint8 *) dst, (const Uint8 *) src, SDL_AUDIO_F32, buffer_size, 1.0f)) {
-        SDL_assert(!"This shouldn't happen.");
+    const SDL_AudioPostmixCallback postmix = logdev->postmix;
+    if (postmix) {
+        float *mix_buffer = device->postmix_buffer;
+        if (postmix_silent) {
+            SDL_memset(mix_buffer, '\0', buffer_size);  // the callback still gets a buffer of silence.
+        }
+        postmix(logdev->postmix_userdata, outspec, mix_buffer, buffer_size);
+        AccumulateAudio(final_mix_buffer, mix_buffer, buffer_size, buffer_size, 1.0f, final_mix_silent);
     }
 }
 
+static bool EnsureAudioMixJobs(SDL_AudioDevice *device, int num_jobs)
+{
+    const int stride = (device->work_buffer_size + 63) & ~63;  // keep each buffer on its own cache lines.
+
+    if ((num_jobs > device->max_mix_jobs) || (stride > device->mix_job_buffer_stride)) {
+        const int max_jobs = SDL_max(num_jobs, device->max_mix_jobs);
+        SDL_AudioMixJob *jobs = (SDL_AudioMixJob *) SDL_realloc(device->mix_jobs, max_jobs * sizeof (*jobs));
+        if (!jobs) {
+            return false;
+        }
+        device->mix_jobs = jobs;
+
+        float *buffers = (float *) SDL_aligned_alloc(SDL_GetSIMDAlignment(), (size_t) max_jobs * stride);
+        if (!buffers) {
+            return false;
+        }
+        SDL_aligned_free(device->mix_job_buffers);
+        device->mix_job_buffers = buffers;
+        device->max_mix_jobs = max_jobs;
+        device->mix_job_buffer_stride = stride;
+    }
+    return true;
+}
+
+/* Convert every bound stream on the mix threads, then mix the results in the same order the serial path would.
+   Returns false without doing anything if this period should be mixed on the device thread instead. */
+static bool MixAudioStreamsInParallel(SDL_AudioDevice *device, const SDL_AudioSpec *outspec, int buffer_size, float *final_mix_buffer, bool *final_mix_silent, bool *failed)
+{
+    int num_jobs = 0;
+    int num_streams = 0;
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        num_jobs++;
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+            num_jobs++;
+            num_streams++;
+        }
+    }
+
+    if ((num_streams < 2) || !EnsureAudioMixJobs(device, num_jobs)) {
+        return false;  // not worth it (or we're out of memory), just do it on this thread.
+    }
+
+    // Each unpaused logical device gets an entry with no stream, followed by an entry for each of its streams.
+    SDL_AudioMixJob *jobs = device->mix_jobs;
+    int num_thread_jobs = 0;
+    num_jobs = 0;
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (SDL_GetAtomicInt(&logdev->paused)) {
+            continue;  // paused? Skip this logical device.
+        }
+
+        SDL_zero(jobs[num_jobs]);
+        jobs[num_jobs].logdev = logdev;
+        jobs[num_jobs].on_device_thread = true;
+        num_jobs++;
+
+        for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+            // We should have updated this elsewhere if the format changed!
+            SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, outspec, NULL, NULL));
+
+            SDL_AudioMixJob *job = &jobs[num_jobs];
+            job->logdev = logdev;
+            job->stream = stream;
+            job->buffer = (float *) (((Uint8 *) device->mix_job_buffers) + ((size_t) num_jobs * device->mix_job_buffer_stride));
+            job->gain = 1.0f;
+            job->result = 0;
+
+            // the app's get callback might do things that need the device lock, so it has to run on this thread.
+            SDL_LockMutex(stream->lock);
+            job->on_device_thread = (stream->get_callback != NULL);
+            SDL_UnlockMutex(stream->lock);
+
+            if (!job->on_device_thread) {
+                num_thread_jobs++;
+            }
+            num_jobs++;
+        }
+    }
+
+    for (int i = 0; i < num_jobs; i++) {
+        SDL_LogicalAudioDevice *logdev = jobs[i].logdev;
+        if (!jobs[i].stream && logdev->iteration_start) {
+            logdev->iteration_start(logdev->iteration_userdata, logdev->instance_id, true);
+        }
+    }
+
+    SDL_AudioMixBatch batch;
+    SDL_zero(batch);
+    batch.device = device;
+    batch.jobs = jobs;
+    batch.num_jobs = num_jobs;
+    batch.jobs_left = num_thread_jobs;
+    batch.buffer_size = buffer_size;
+    while ((batch.next_job < num_jobs) && jobs[batch.next_job].on_device_thread) {
+        batch.next_job++;
+    }
+
+    if (num_thread_jobs > 0) {
+        SDL_LockMutex(current_audio.mix_lock);
+        SDL_AudioMixBatch **tail = &current_audio.mix_batches;
+        while (*tail) {
+            tail = &(*tail)->next;
+        }
+        *tail = &batch;
+        SDL_BroadcastCondition(current_audio.mix_cond);
+        SDL_UnlockMutex(current_audio.mix_lock);
+    }
+
+    for (int i = 0; i < num_jobs; i++) {
+        if (jobs[i].stream && jobs[i].on_device_thread) {
+            RunAudioMixJob(device, &jobs[i], buffer_size);
+        }
+    }
+
+    if (num_thread_jobs > 0) {
+        // help out with whatever the mix threads haven't gotten to yet, then wait for the rest to finish.
+        SDL_AudioMixBatch *claimed_from = NULL;
+        SDL_AudioMixJob *job;
+        SDL_LockMutex(current_audio.mix_lock);
+        while ((job = ClaimAudioMixJob(&batch, &claimed_from)) != NULL) {
+            SDL_UnlockMutex(current_audio.mix_lock);
+            RunAudioMixJob(device, job, buffer_size);
+            SDL_LockMutex(current_audio.mix_lock);
+            batch.jobs_left--;
+        }
+        while (batch.jobs_left > 0) {
+            SDL_WaitCondition(current_audio.mix_done_cond, current_audio.mix_lock);
+        }
+        SDL_UnlockMutex(current_audio.mix_lock);
+    }
+
+    for (int i = 0; i < num_jobs; i++) {
+        SDL_LogicalAudioDevice *logdev = jobs[i].logdev;
+        if (!jobs[i].stream && logdev->iteration_end) {
+            logdev->iteration_end(logdev->iteration_userdata, logdev->instance_id, false);
+        }
+    }
+
+    SDL_LogicalAudioDevice *logdev = NULL;
+    float *mix_buffer = NULL;
+    bool postmix_silent = true;
+    bool *mix_silent = NULL;
+    for (int i = 0; i < num_jobs; i++) {
+        const SDL_AudioMixJob *job = &jobs[i];
+        if (!job->stream) {  // starting a new logical device.
+            if (logdev) {
+                FinishLogicalDeviceMix(device, logdev, outspec, buffer_size, postmix_silent, final_mix_buffer, final_mix_silent);
+            }
+            logdev = job->logdev;
+            postmix_silent = true;
+            mix_buffer = logdev->postmix ? device->postmix_buffer : final_mix_buffer;
+            mix_silent = logdev->postmix ? &postmix_silent : final_mix_silent;
+        } else if (job->result < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
+            *failed = true;
+        } else if (job->result > 0) {
+            AccumulateAudio(mix_buffer, job->buffer, job->result, buffer_size, job->gain, mix_silent);
+        }
+    }
+
+    if (logdev) {
+        FinishLogicalDeviceMix(device, logdev, outspec, buffer_size, postmix_silent, final_mix_buffer, final_mix_silent);
+    }
+
+    return true;
+}
+
 
 // Playback device thread. This is split into chunks, so backends that need to control this directly can use the pieces they need without duplicating effort.
 
@@ -1190,62 +1582,57 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
             SDL_copyp(&outspec, &device->spec);
             outspec.format = SDL_AUDIO_F32;
 
-            SDL_memset(final_mix_buffer, '\0', work_buffer_size);  // start with silence.
+            bool final_mix_silent = true;  // nothing has been mixed into final_mix_buffer yet.
 
-            for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
-                if (SDL_GetAtomicInt(&logdev->paused)) {
-                    continue;  // paused? Skip this logical device.
-                }
+            if (!current_audio.num_mix_threads || !MixAudioStreamsInParallel(device, &outspec, work_buffer_size, final_mix_buffer, &final_mix_silent, &failed)) {
+                for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+                    if (SDL_GetAtomicInt(&logdev->paused)) {
+                        continue;  // paused? Skip this logical device.
+                    }
 
-                const SDL_AudioPostmixCallback postmix = logdev->postmix;
-                float *mix_buffer = final_mix_buffer;
-                if (postmix) {
-                    mix_buffer = device->postmix_buffer;
-                    SDL_memset(mix_buffer, '\0', work_buffer_size);  // start with silence.
-                }
+                    float *mix_buffer = final_mix_buffer;
+                    bool *mix_silent = &final_mix_silent;
+                    bool postmix_silent = true;
+                    if (logdev->postmix) {
+                        mix_buffer = device->postmix_buffer;
+                        mix_silent = &postmix_silent;
+                    }
 
-                if (logdev->iteration_start) {
-                    logdev->iteration_start(logdev->iteration_userdata, logdev->instance_id, true);
-                }
+                    if (logdev->iteration_start) {
+                        logdev->iteration_start(logdev->iteration_userdata, logdev->instance_id, true);
+                    }
 
-                for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
-                    // We should have updated this elsewhere if the format changed!
-                    SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, &outspec, NULL, NULL));
+                    for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                        // We should have updated this elsewhere if the format changed!
+                        SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, &outspec, NULL, NULL));
 
-                    /* this will hold a lock on `stream` while getting. We don't explicitly lock the streams
-                       for iterating here because the binding linked list can only change while the device lock is held.
-                       (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
-                       the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamDataAdjustGain(stream, device->work_buffer, work_buffer_size, logdev->gain);
-                    if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
-                        failed = true;
-                        break;
-                    } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
-                        // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
-                        if (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
-                            ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device->work_buffer, device->spec.format, device->spec.channels, NULL,
-                                         device->work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
+                        if (!MixAudioStream(device, logdev, stream, mix_buffer, work_buffer_size, mix_silent)) {
+                            failed = true;
+                            break;
                         }
-                        MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
                     }
-                }
 
-                if (logdev->iteration_end) {
-                    logdev->iteration_end(logdev->iteration_userdata, logdev->instance_id, false);
-                }
+                    if (logdev->iteration_end) {
+                        logdev->iteration_end(logdev->iteration_userdata, logdev->instance_id, false);
+                    }
 
-                if (postmix) {
-                    SDL_assert(mix_buffer == device->postmix_buffer);
-                    postmix(logdev->postmix_userdata, &outspec, mix_buffer, work_buffer_size);
-                    MixFloat32Audio(final_mix_buffer, mix_buffer, work_buffer_size);
+                    FinishLogicalDeviceMix(device, logdev, &outspec, work_buffer_size, postmix_silent, final_mix_buffer, &final_mix_silent);
                 }
             }
 
+            if (final_mix_silent) {
+                SDL_memset(final_mix_buffer, '\0', work_buffer_size);  // nothing played, so supply silence.
+            }
+
             if (((Uint8 *) final_mix_buffer) != device_buffer) {
-                // !!! FIXME: we can't promise the device buf is aligned/padded for SIMD.
-                //ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, NULL, device_buffer, device->spec.format, device->spec.channels, NULL, NULL, 1.0f);
-                ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, NULL, device->work_buffer, device->spec.format, device->spec.channels, NULL, NULL, 1.0f);
-                SDL_memcpy(device_buffer, device->work_buffer, buffer_size);
+                // The converters align their stores themselves, but they need the device buffer to be at least sample-aligned to write to it directly.
+                const int frames = needed_samples / device->spec.channels;
+                if ((((uintptr_t) device_buffer) % SDL_AUDIO_BYTESIZE(device->spec.format)) == 0) {
+                    ConvertAudio(frames, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, NULL, device_buffer, device->spec.format, device->spec.channels, NULL, device->work_buffer, 1.0f);
+                } else {
+                    ConvertAudio(frames, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, NULL, device->work_buffer, device->spec.format, device->spec.channels, NULL, NULL, 1.0f);
+                    SDL_memcpy(device_buffer, device->work_buffer, buffer_size);
+                }
             }
         }
 
@@ -1647,6 +2034,13 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
     SDL_aligned_free(device->postmix_buffer);
     device->postmix_buffer = NULL;
 
+    SDL_free(device->mix_jobs);
+    device->mix_jobs = NULL;
+    SDL_aligned_free(device->mix_job_buffers);
+    device->mix_job_buffers = NULL;
+    device->max_mix_jobs = 0;
+    device->mix_job_buffer_stride = 0;
+
     SDL_copyp(&device->spec, &device->default_spec);
     device->sample_frames = 0;
     device->silence_value = SDL_GetSilenceValueForFormat(device->spec.format);
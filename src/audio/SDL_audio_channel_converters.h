@@ -41,6 +41,11 @@ static void SDL_ConvertMonoToStereo(float *dst, const float *src, int num_frames
 
 }
 
+static const float SDL_ConvertMonoToStereo_Matrix[2 * 1] = {   // [to][from]
+    1.000000000f,  // FL
+    1.000000000f,  // FR
+};
+
 static void SDL_ConvertMonoTo21(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -59,6 +64,12 @@ static void SDL_ConvertMonoTo21(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertMonoTo21_Matrix[3 * 1] = {   // [to][from]
+    1.000000000f,  // FL
+    1.000000000f,  // FR
+    0.000000000f,  // LFE
+};
+
 static void SDL_ConvertMonoToQuad(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -78,6 +89,13 @@ static void SDL_ConvertMonoToQuad(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertMonoToQuad_Matrix[4 * 1] = {   // [to][from]
+    1.000000000f,  // FL
+    1.000000000f,  // FR
+    0.000000000f,  // BL
+    0.000000000f,  // BR
+};
+
 static void SDL_ConvertMonoTo41(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -98,6 +116,14 @@ static void SDL_ConvertMonoTo41(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertMonoTo41_Matrix[5 * 1] = {   // [to][from]
+    1.000000000f,  // FL
+    1.000000000f,  // FR
+    0.000000000f,  // LFE
+    0.000000000f,  // BL
+    0.000000000f,  // BR
+};
+
 static void SDL_ConvertMonoTo51(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -119,6 +145,15 @@ static void SDL_ConvertMonoTo51(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertMonoTo51_Matrix[6 * 1] = {   // [to][from]
+    1.000000000f,  // FL
+    1.000000000f,  // FR
+    0.000000000f,  // FC
+    0.000000000f,  // LFE
+    0.000000000f,  // BL
+    0.000000000f,  // BR
+};
+
 static void SDL_ConvertMonoTo61(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -141,6 +176,16 @@ static void SDL_ConvertMonoTo61(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertMonoTo61_Matrix[7 * 1] = {   // [to][from]
+    1.000000000f,  // FL
+    1.000000000f,  // FR
+    0.000000000f,  // FC
+    0.000000000f,  // LFE
+    0.000000000f,  // BC
+    0.000000000f,  // SL
+    0.000000000f,  // SR
+};
+
 static void SDL_ConvertMonoTo71(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -164,6 +209,17 @@ static void SDL_ConvertMonoTo71(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertMonoTo71_Matrix[8 * 1] = {   // [to][from]
+    1.000000000f,  // FL
+    1.000000000f,  // FR
+    0.000000000f,  // FC
+    0.000000000f,  // LFE
+    0.000000000f,  // BL
+    0.000000000f,  // BR
+    0.000000000f,  // SL
+    0.000000000f,  // SR
+};
+
 static void SDL_ConvertStereoToMono(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -176,6 +232,10 @@ static void SDL_ConvertStereoToMono(float *dst, const float *src, int num_frames
 
 }
 
+static const float SDL_ConvertStereoToMono_Matrix[1 * 2] = {   // [to][from]
+    0.500000000f, 0.500000000f,  // FC
+};
+
 static void SDL_ConvertStereoTo21(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -193,6 +253,12 @@ static void SDL_ConvertStereoTo21(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertStereoTo21_Matrix[3 * 2] = {   // [to][from]
+    1.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f,  // FR
+    0.000000000f, 0.000000000f,  // LFE
+};
+
 static void SDL_ConvertStereoToQuad(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -211,6 +277,13 @@ static void SDL_ConvertStereoToQuad(float *dst, const float *src, int num_frames
 
 }
 
+static const float SDL_ConvertStereoToQuad_Matrix[4 * 2] = {   // [to][from]
+    1.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f,  // FR
+    0.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f,  // BR
+};
+
 static void SDL_ConvertStereoTo41(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -230,6 +303,14 @@ static void SDL_ConvertStereoTo41(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertStereoTo41_Matrix[5 * 2] = {   // [to][from]
+    1.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f,  // FR
+    0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f,  // BR
+};
+
 static void SDL_ConvertStereoTo51(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -250,6 +331,15 @@ static void SDL_ConvertStereoTo51(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertStereoTo51_Matrix[6 * 2] = {   // [to][from]
+    1.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f,  // FR
+    0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f,  // BR
+};
+
 static void SDL_ConvertStereoTo61(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -271,6 +361,16 @@ static void SDL_ConvertStereoTo61(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertStereoTo61_Matrix[7 * 2] = {   // [to][from]
+    1.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f,  // FR
+    0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f,  // BC
+    0.000000000f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f,  // SR
+};
+
 static void SDL_ConvertStereoTo71(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -293,6 +393,17 @@ static void SDL_ConvertStereoTo71(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertStereoTo71_Matrix[8 * 2] = {   // [to][from]
+    1.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f,  // FR
+    0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f,  // BR
+    0.000000000f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f,  // SR
+};
+
 static void SDL_Convert21ToMono(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -305,6 +416,10 @@ static void SDL_Convert21ToMono(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert21ToMono_Matrix[1 * 3] = {   // [to][from]
+    0.333333343f, 0.333333343f, 0.333333343f,  // FC
+};
+
 static void SDL_Convert21ToStereo(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -319,6 +434,11 @@ static void SDL_Convert21ToStereo(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert21ToStereo_Matrix[2 * 3] = {   // [to][from]
+    0.800000012f, 0.000000000f, 0.200000003f,  // FL
+    0.000000000f, 0.800000012f, 0.200000003f,  // FR
+};
+
 static void SDL_Convert21ToQuad(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -338,6 +458,13 @@ static void SDL_Convert21ToQuad(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert21ToQuad_Matrix[4 * 3] = {   // [to][from]
+    0.888888896f, 0.000000000f, 0.111111112f,  // FL
+    0.000000000f, 0.888888896f, 0.111111112f,  // FR
+    0.000000000f, 0.000000000f, 0.111111112f,  // BL
+    0.000000000f, 0.000000000f, 0.111111112f,  // BR
+};
+
 static void SDL_Convert21To41(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -357,6 +484,14 @@ static void SDL_Convert21To41(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert21To41_Matrix[5 * 3] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 1.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f,  // BR
+};
+
 static void SDL_Convert21To51(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -377,6 +512,15 @@ static void SDL_Convert21To51(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert21To51_Matrix[6 * 3] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 1.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f,  // BR
+};
+
 static void SDL_Convert21To61(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -398,6 +542,16 @@ static void SDL_Convert21To61(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert21To61_Matrix[7 * 3] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 1.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f,  // BC
+    0.000000000f, 0.000000000f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f,  // SR
+};
+
 static void SDL_Convert21To71(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -420,6 +574,17 @@ static void SDL_Convert21To71(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert21To71_Matrix[8 * 3] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 1.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f,  // BR
+    0.000000000f, 0.000000000f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f,  // SR
+};
+
 static void SDL_ConvertQuadToMono(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -432,6 +597,10 @@ static void SDL_ConvertQuadToMono(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertQuadToMono_Matrix[1 * 4] = {   // [to][from]
+    0.250000000f, 0.250000000f, 0.250000000f, 0.250000000f,  // FC
+};
+
 static void SDL_ConvertQuadToStereo(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -447,6 +616,11 @@ static void SDL_ConvertQuadToStereo(float *dst, const float *src, int num_frames
 
 }
 
+static const float SDL_ConvertQuadToStereo_Matrix[2 * 4] = {   // [to][from]
+    0.421000004f, 0.000000000f, 0.358999997f, 0.219999999f,  // FL
+    0.000000000f, 0.421000004f, 0.219999999f, 0.358999997f,  // FR
+};
+
 static void SDL_ConvertQuadTo21(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -463,6 +637,12 @@ static void SDL_ConvertQuadTo21(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertQuadTo21_Matrix[3 * 4] = {   // [to][from]
+    0.421000004f, 0.000000000f, 0.358999997f, 0.219999999f,  // FL
+    0.000000000f, 0.421000004f, 0.219999999f, 0.358999997f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+};
+
 static void SDL_ConvertQuadTo41(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -482,6 +662,14 @@ static void SDL_ConvertQuadTo41(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertQuadTo41_Matrix[5 * 4] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f,  // BR
+};
+
 static void SDL_ConvertQuadTo51(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -502,6 +690,15 @@ static void SDL_ConvertQuadTo51(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertQuadTo51_Matrix[6 * 4] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f,  // BR
+};
+
 static void SDL_ConvertQuadTo61(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -525,6 +722,16 @@ static void SDL_ConvertQuadTo61(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertQuadTo61_Matrix[7 * 4] = {   // [to][from]
+    0.939999998f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 0.939999998f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.500000000f, 0.500000000f,  // BC
+    0.000000000f, 0.000000000f, 0.796000004f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.796000004f,  // SR
+};
+
 static void SDL_ConvertQuadTo71(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -547,6 +754,17 @@ static void SDL_ConvertQuadTo71(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_ConvertQuadTo71_Matrix[8 * 4] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f,  // BR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // SR
+};
+
 static void SDL_Convert41ToMono(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -559,6 +777,10 @@ static void SDL_Convert41ToMono(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert41ToMono_Matrix[1 * 5] = {   // [to][from]
+    0.200000003f, 0.200000003f, 0.200000003f, 0.200000003f, 0.200000003f,  // FC
+};
+
 static void SDL_Convert41ToStereo(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -575,6 +797,11 @@ static void SDL_Convert41ToStereo(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert41ToStereo_Matrix[2 * 5] = {   // [to][from]
+    0.374222219f, 0.000000000f, 0.111111112f, 0.319111109f, 0.195555553f,  // FL
+    0.000000000f, 0.374222219f, 0.111111112f, 0.195555553f, 0.319111109f,  // FR
+};
+
 static void SDL_Convert41To21(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -591,6 +818,12 @@ static void SDL_Convert41To21(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert41To21_Matrix[3 * 5] = {   // [to][from]
+    0.421000004f, 0.000000000f, 0.000000000f, 0.358999997f, 0.219999999f,  // FL
+    0.000000000f, 0.421000004f, 0.000000000f, 0.219999999f, 0.358999997f,  // FR
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // LFE
+};
+
 static void SDL_Convert41ToQuad(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -607,6 +840,13 @@ static void SDL_Convert41ToQuad(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert41ToQuad_Matrix[4 * 5] = {   // [to][from]
+    0.941176474f, 0.000000000f, 0.058823530f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 0.941176474f, 0.058823530f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.058823530f, 0.941176474f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.058823530f, 0.000000000f, 0.941176474f,  // BR
+};
+
 static void SDL_Convert41To51(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -627,6 +867,15 @@ static void SDL_Convert41To51(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert41To51_Matrix[6 * 5] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f,  // BR
+};
+
 static void SDL_Convert41To61(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -650,6 +899,16 @@ static void SDL_Convert41To61(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert41To61_Matrix[7 * 5] = {   // [to][from]
+    0.939999998f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 0.939999998f, 0.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.500000000f, 0.500000000f,  // BC
+    0.000000000f, 0.000000000f, 0.000000000f, 0.796000004f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.796000004f,  // SR
+};
+
 static void SDL_Convert41To71(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -672,6 +931,17 @@ static void SDL_Convert41To71(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert41To71_Matrix[8 * 5] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f,  // BR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // SR
+};
+
 static void SDL_Convert51ToMono(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -684,6 +954,10 @@ static void SDL_Convert51ToMono(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert51ToMono_Matrix[1 * 6] = {   // [to][from]
+    0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f,  // FC
+};
+
 static void SDL_Convert51ToStereo(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -701,6 +975,11 @@ static void SDL_Convert51ToStereo(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert51ToStereo_Matrix[2 * 6] = {   // [to][from]
+    0.294545442f, 0.000000000f, 0.208181813f, 0.090909094f, 0.251818180f, 0.154545456f,  // FL
+    0.000000000f, 0.294545442f, 0.208181813f, 0.090909094f, 0.154545456f, 0.251818180f,  // FR
+};
+
 static void SDL_Convert51To21(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -718,6 +997,12 @@ static void SDL_Convert51To21(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert51To21_Matrix[3 * 6] = {   // [to][from]
+    0.324000001f, 0.000000000f, 0.229000002f, 0.000000000f, 0.277000010f, 0.170000002f,  // FL
+    0.000000000f, 0.324000001f, 0.229000002f, 0.000000000f, 0.170000002f, 0.277000010f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // LFE
+};
+
 static void SDL_Convert51ToQuad(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -735,6 +1020,13 @@ static void SDL_Convert51ToQuad(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert51ToQuad_Matrix[4 * 6] = {   // [to][from]
+    0.558095276f, 0.000000000f, 0.394285709f, 0.047619049f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 0.558095276f, 0.394285709f, 0.047619049f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.047619049f, 0.558095276f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.047619049f, 0.000000000f, 0.558095276f,  // BR
+};
+
 static void SDL_Convert51To41(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -752,6 +1044,14 @@ static void SDL_Convert51To41(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert51To41_Matrix[5 * 6] = {   // [to][from]
+    0.586000025f, 0.000000000f, 0.414000005f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 0.586000025f, 0.414000005f, 0.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.586000025f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.586000025f,  // BR
+};
+
 static void SDL_Convert51To61(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -775,6 +1075,16 @@ static void SDL_Convert51To61(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert51To61_Matrix[7 * 6] = {   // [to][from]
+    0.939999998f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 0.939999998f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.939999998f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.500000000f, 0.500000000f,  // BC
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.796000004f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.796000004f,  // SR
+};
+
 static void SDL_Convert51To71(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -797,6 +1107,17 @@ static void SDL_Convert51To71(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert51To71_Matrix[8 * 6] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f,  // BR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // SR
+};
+
 static void SDL_Convert61ToMono(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -809,6 +1130,10 @@ static void SDL_Convert61ToMono(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert61ToMono_Matrix[1 * 7] = {   // [to][from]
+    0.143142849f, 0.143142849f, 0.143142849f, 0.142857149f, 0.143142849f, 0.143142849f, 0.143142849f,  // FC
+};
+
 static void SDL_Convert61ToStereo(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -827,6 +1152,11 @@ static void SDL_Convert61ToStereo(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert61ToStereo_Matrix[2 * 7] = {   // [to][from]
+    0.247384623f, 0.000000000f, 0.174461529f, 0.076923080f, 0.174461529f, 0.226153851f, 0.100615382f,  // FL
+    0.000000000f, 0.247384623f, 0.174461529f, 0.076923080f, 0.174461529f, 0.100615382f, 0.226153851f,  // FR
+};
+
 static void SDL_Convert61To21(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -845,6 +1175,12 @@ static void SDL_Convert61To21(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert61To21_Matrix[3 * 7] = {   // [to][from]
+    0.268000007f, 0.000000000f, 0.188999996f, 0.000000000f, 0.188999996f, 0.245000005f, 0.108999997f,  // FL
+    0.000000000f, 0.268000007f, 0.188999996f, 0.000000000f, 0.188999996f, 0.108999997f, 0.245000005f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+};
+
 static void SDL_Convert61ToQuad(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -865,6 +1201,13 @@ static void SDL_Convert61ToQuad(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert61ToQuad_Matrix[4 * 7] = {   // [to][from]
+    0.463679999f, 0.000000000f, 0.327360004f, 0.040000003f, 0.000000000f, 0.168960005f, 0.000000000f,  // FL
+    0.000000000f, 0.463679999f, 0.327360004f, 0.040000003f, 0.000000000f, 0.000000000f, 0.168960005f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.040000003f, 0.327360004f, 0.431039989f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.040000003f, 0.327360004f, 0.000000000f, 0.431039989f,  // BR
+};
+
 static void SDL_Convert61To41(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -885,6 +1228,14 @@ static void SDL_Convert61To41(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert61To41_Matrix[5 * 7] = {   // [to][from]
+    0.483000010f, 0.000000000f, 0.340999991f, 0.000000000f, 0.000000000f, 0.175999999f, 0.000000000f,  // FL
+    0.000000000f, 0.483000010f, 0.340999991f, 0.000000000f, 0.000000000f, 0.000000000f, 0.175999999f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.340999991f, 0.449000001f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.340999991f, 0.000000000f, 0.449000001f,  // BR
+};
+
 static void SDL_Convert61To51(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -905,6 +1256,15 @@ static void SDL_Convert61To51(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert61To51_Matrix[6 * 7] = {   // [to][from]
+    0.611000001f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.223000005f, 0.000000000f,  // FL
+    0.000000000f, 0.611000001f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.223000005f,  // FR
+    0.000000000f, 0.000000000f, 0.611000001f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.432000011f, 0.568000019f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.432000011f, 0.000000000f, 0.568000019f,  // BR
+};
+
 static void SDL_Convert61To71(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -928,6 +1288,17 @@ static void SDL_Convert61To71(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert61To71_Matrix[8 * 7] = {   // [to][from]
+    1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.707000017f, 0.000000000f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.707000017f, 0.000000000f, 0.000000000f,  // BR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f,  // SR
+};
+
 static void SDL_Convert71ToMono(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -940,6 +1311,10 @@ static void SDL_Convert71ToMono(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert71ToMono_Matrix[1 * 8] = {   // [to][from]
+    0.125125006f, 0.125125006f, 0.125125006f, 0.125000000f, 0.125125006f, 0.125125006f, 0.125125006f, 0.125125006f,  // FC
+};
+
 static void SDL_Convert71ToStereo(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -959,6 +1334,11 @@ static void SDL_Convert71ToStereo(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert71ToStereo_Matrix[2 * 8] = {   // [to][from]
+    0.211866662f, 0.000000000f, 0.150266662f, 0.066666670f, 0.181066677f, 0.111066669f, 0.194133341f, 0.085866667f,  // FL
+    0.000000000f, 0.211866662f, 0.150266662f, 0.066666670f, 0.111066669f, 0.181066677f, 0.085866667f, 0.194133341f,  // FR
+};
+
 static void SDL_Convert71To21(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -978,6 +1358,12 @@ static void SDL_Convert71To21(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert71To21_Matrix[3 * 8] = {   // [to][from]
+    0.226999998f, 0.000000000f, 0.160999998f, 0.000000000f, 0.194000006f, 0.119000003f, 0.208000004f, 0.092000000f,  // FL
+    0.000000000f, 0.226999998f, 0.160999998f, 0.000000000f, 0.119000003f, 0.194000006f, 0.092000000f, 0.208000004f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+};
+
 static void SDL_Convert71ToQuad(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -997,6 +1383,13 @@ static void SDL_Convert71ToQuad(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert71ToQuad_Matrix[4 * 8] = {   // [to][from]
+    0.466344833f, 0.000000000f, 0.329241365f, 0.034482758f, 0.000000000f, 0.000000000f, 0.169931039f, 0.000000000f,  // FL
+    0.000000000f, 0.466344833f, 0.329241365f, 0.034482758f, 0.000000000f, 0.000000000f, 0.000000000f, 0.169931039f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 0.034482758f, 0.466344833f, 0.000000000f, 0.433517247f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.034482758f, 0.000000000f, 0.466344833f, 0.000000000f, 0.433517247f,  // BR
+};
+
 static void SDL_Convert71To41(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -1016,6 +1409,14 @@ static void SDL_Convert71To41(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert71To41_Matrix[5 * 8] = {   // [to][from]
+    0.483000010f, 0.000000000f, 0.340999991f, 0.000000000f, 0.000000000f, 0.000000000f, 0.175999999f, 0.000000000f,  // FL
+    0.000000000f, 0.483000010f, 0.340999991f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.175999999f,  // FR
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.483000010f, 0.000000000f, 0.449000001f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.483000010f, 0.000000000f, 0.449000001f,  // BR
+};
+
 static void SDL_Convert71To51(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -1035,6 +1436,15 @@ static void SDL_Convert71To51(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert71To51_Matrix[6 * 8] = {   // [to][from]
+    0.518000007f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.188999996f, 0.000000000f,  // FL
+    0.000000000f, 0.518000007f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.188999996f,  // FR
+    0.000000000f, 0.000000000f, 0.518000007f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.518000007f, 0.000000000f, 0.481999993f, 0.000000000f,  // BL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.518000007f, 0.000000000f, 0.481999993f,  // BR
+};
+
 static void SDL_Convert71To61(float *dst, const float *src, int num_frames)
 {
     int i;
@@ -1055,6 +1465,16 @@ static void SDL_Convert71To61(float *dst, const float *src, int num_frames)
 
 }
 
+static const float SDL_Convert71To61_Matrix[7 * 8] = {   // [to][from]
+    0.541000009f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FL
+    0.000000000f, 0.541000009f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FR
+    0.000000000f, 0.000000000f, 0.541000009f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // FC
+    0.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f,  // LFE
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.287999988f, 0.287999988f, 0.000000000f, 0.000000000f,  // BC
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.458999991f, 0.000000000f, 0.541000009f, 0.000000000f,  // SL
+    0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.458999991f, 0.000000000f, 0.541000009f,  // SR
+};
+
 static const SDL_AudioChannelConverter channel_converters[8][8] = {   // [from][to]
     { NULL, SDL_ConvertMonoToStereo, SDL_ConvertMonoTo21, SDL_ConvertMonoToQuad, SDL_ConvertMonoTo41, SDL_ConvertMonoTo51, SDL_ConvertMonoTo61, SDL_ConvertMonoTo71 },
     { SDL_ConvertStereoToMono, NULL, SDL_ConvertStereoTo21, SDL_ConvertStereoToQuad, SDL_ConvertStereoTo41, SDL_ConvertStereoTo51, SDL_ConvertStereoTo61, SDL_ConvertStereoTo71 },
@@ -1066,3 +1486,14 @@ static const SDL_AudioChannelConverter channel_converters[8][8] = {   // [from][
     { SDL_Convert71ToMono, SDL_Convert71ToStereo, SDL_Convert71To21, SDL_Convert71ToQuad, SDL_Convert71To41, SDL_Convert71To51, SDL_Convert71To61, NULL }
 };
 
+static const float *const channel_conversion_matrices[8][8] = {   // [from][to]
+    { NULL, SDL_ConvertMonoToStereo_Matrix, SDL_ConvertMonoTo21_Matrix, SDL_ConvertMonoToQuad_Matrix, SDL_ConvertMonoTo41_Matrix, SDL_ConvertMonoTo51_Matrix, SDL_ConvertMonoTo61_Matrix, SDL_ConvertMonoTo71_Matrix },
+    { SDL_ConvertStereoToMono_Matrix, NULL, SDL_ConvertStereoTo21_Matrix, SDL_ConvertStereoToQuad_Matrix, SDL_ConvertStereoTo41_Matrix, SDL_ConvertStereoTo51_Matrix, SDL_ConvertStereoTo61_Matrix, SDL_ConvertStereoTo71_Matrix },
+    { SDL_Convert21ToMono_Matrix, SDL_Convert21ToStereo_Matrix, NULL, SDL_Convert21ToQuad_Matrix, SDL_Convert21To41_Matrix, SDL_Convert21To51_Matrix, SDL_Convert21To61_Matrix, SDL_Convert21To71_Matrix },
+    { SDL_ConvertQuadToMono_Matrix, SDL_ConvertQuadToStereo_Matrix, SDL_ConvertQuadTo21_Matrix, NULL, SDL_ConvertQuadTo41_Matrix, SDL_ConvertQuadTo51_Matrix, SDL_ConvertQuadTo61_Matrix, SDL_ConvertQuadTo71_Matrix },
+    { SDL_Convert41ToMono_Matrix, SDL_Convert41ToStereo_Matrix, SDL_Convert41To21_Matrix, SDL_Convert41ToQuad_Matrix, NULL, SDL_Convert41To51_Matrix, SDL_Convert41To61_Matrix, SDL_Convert41To71_Matrix },
+    { SDL_Convert51ToMono_Matrix, SDL_Convert51ToStereo_Matrix, SDL_Convert51To21_Matrix, SDL_Convert51ToQuad_Matrix, SDL_Convert51To41_Matrix, NULL, SDL_Convert51To61_Matrix, SDL_Convert51To71_Matrix },
+    { SDL_Convert61ToMono_Matrix, SDL_Convert61ToStereo_Matrix, SDL_Convert61To21_Matrix, SDL_Convert61ToQuad_Matrix, SDL_Convert61To41_Matrix, SDL_Convert61To51_Matrix, NULL, SDL_Convert61To71_Matrix },
+    { SDL_Convert71ToMono_Matrix, SDL_Convert71ToStereo_Matrix, SDL_Convert71To21_Matrix, SDL_Convert71ToQuad_Matrix, SDL_Convert71To41_Matrix, SDL_Convert71To51_Matrix, SDL_Convert71To61_Matrix, NULL }
+};
+
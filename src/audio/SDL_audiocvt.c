@@ -99,6 +99,133 @@ static void SDL_TARGETING("sse") SDL_ConvertMonoToStereo_SSE(float *dst, const f
 // Include the autogenerated channel converters...
 #include "SDL_audio_channel_converters.h"
 
+/* Downmixing to stereo is the only conversion where most of the matrix is used, the others
+   are mostly copies, and the generated converters are already as fast as they can be.
+   These do the whole matrix a frame at a time, using the matrix of the generated converter.
+   They leave the last few frames to the generated converter, rather than load past the end
+   of the buffer. */
+#ifdef SDL_SSE_INTRINSICS
+// Broadcast input channel `c` of two frames, and add it to both frames' left and right output.
+#define MIX_STEREO_PAIR_SSE(c, in0, in1)                                                          \
+    if (src_channels > c) {                                                                       \
+        const __m128 samples = _mm_shuffle_ps(in0, in1, _MM_SHUFFLE(c & 3, c & 3, c & 3, c & 3)); \
+        out = _mm_add_ps(out, _mm_mul_ps(samples, columns[c]));                                   \
+    }
+
+static void SDL_TARGETING("sse") SDL_ConvertToStereo_SSE(float *dst, const float *src, int num_frames, int src_channels,
+                                                         const float *matrix, SDL_AudioChannelConverter scalar_converter)
+{
+    LOG_DEBUG_AUDIO_CONVERT("any", "stereo (using SSE)");
+
+    const int load_channels = (src_channels > 4) ? 8 : 4;
+    const int tail_frames = (load_channels + src_channels - 1) / src_channels - 1;
+    const int simd_frames = SDL_max(num_frames - tail_frames, 0) & ~1;
+    __m128 columns[8];
+    int i;
+
+    // Each input channel gets its weights for left and right output, twice, since we do two frames at a time.
+    for (i = 0; i < src_channels; i++) {
+        columns[i] = _mm_setr_ps(matrix[i], matrix[src_channels + i], matrix[i], matrix[src_channels + i]);
+    }
+
+    for (i = 0; i < simd_frames; i += 2) {
+        const __m128 in0_lo = _mm_loadu_ps(src);
+        const __m128 in1_lo = _mm_loadu_ps(src + src_channels);
+        const __m128 in0_hi = (src_channels > 4) ? _mm_loadu_ps(src + 4) : in0_lo;
+        const __m128 in1_hi = (src_channels > 4) ? _mm_loadu_ps(src + src_channels + 4) : in1_lo;
+        __m128 out = _mm_mul_ps(_mm_shuffle_ps(in0_lo, in1_lo, _MM_SHUFFLE(0, 0, 0, 0)), columns[0]);
+
+        MIX_STEREO_PAIR_SSE(1, in0_lo, in1_lo);
+        MIX_STEREO_PAIR_SSE(2, in0_lo, in1_lo);
+        MIX_STEREO_PAIR_SSE(3, in0_lo, in1_lo);
+        MIX_STEREO_PAIR_SSE(4, in0_hi, in1_hi);
+        MIX_STEREO_PAIR_SSE(5, in0_hi, in1_hi);
+        MIX_STEREO_PAIR_SSE(6, in0_hi, in1_hi);
+        MIX_STEREO_PAIR_SSE(7, in0_hi, in1_hi);
+
+        _mm_storeu_ps(dst, out);
+        src += src_channels * 2;
+        dst += 4;
+    }
+
+    scalar_converter(dst, src, num_frames - simd_frames);
+}
+
+#undef MIX_STEREO_PAIR_SSE
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+// Multiply input channel `c` by its left and right weights, and add it to the output.
+#define MIX_STEREO_NEON(c, in)                                                  \
+    if (src_channels > c) {                                                     \
+        out = vmla_lane_f32(out, columns[c], ((c & 2) ? vget_high_f32(in) : vget_low_f32(in)), c & 1); \
+    }
+
+static void SDL_ConvertToStereo_NEON(float *dst, const float *src, int num_frames, int src_channels,
+                                     const float *matrix, SDL_AudioChannelConverter scalar_converter)
+{
+    LOG_DEBUG_AUDIO_CONVERT("any", "stereo (using NEON)");
+
+    const int load_channels = (src_channels > 4) ? 8 : 4;
+    const int tail_frames = (load_channels + src_channels - 1) / src_channels - 1;
+    const int simd_frames = SDL_max(num_frames - tail_frames, 0);
+    float32x2_t columns[8];
+    int i;
+
+    // Each input channel gets its weights for left and right output.
+    for (i = 0; i < src_channels; i++) {
+        const float weights[2] = { matrix[i], matrix[src_channels + i] };
+        columns[i] = vld1_f32(weights);
+    }
+
+    for (i = 0; i < simd_frames; i++) {
+        const float32x4_t in_lo = vld1q_f32(src);
+        const float32x4_t in_hi = (src_channels > 4) ? vld1q_f32(src + 4) : in_lo;
+        float32x2_t out = vmul_lane_f32(columns[0], vget_low_f32(in_lo), 0);
+
+        MIX_STEREO_NEON(1, in_lo);
+        MIX_STEREO_NEON(2, in_lo);
+        MIX_STEREO_NEON(3, in_lo);
+        MIX_STEREO_NEON(4, in_hi);
+        MIX_STEREO_NEON(5, in_hi);
+        MIX_STEREO_NEON(6, in_hi);
+        MIX_STEREO_NEON(7, in_hi);
+
+        vst1_f32(dst, out);
+        src += src_channels;
+        dst += 2;
+    }
+
+    scalar_converter(dst, src, num_frames - simd_frames);
+}
+
+#undef MIX_STEREO_NEON
+#endif
+
+// Convert channels with the generated converter, or a SIMD version of its matrix.
+static void ConvertChannels(float *dst, const float *src, int num_frames, int src_channels, int dst_channels, SDL_AudioChannelConverter channel_converter)
+{
+    const float *matrix = channel_conversion_matrices[src_channels - 1][dst_channels - 1];
+    SDL_assert(matrix != NULL);
+
+    if (dst_channels == 2 && src_channels > 2) {
+        #ifdef SDL_SSE_INTRINSICS
+        if (SDL_HasSSE()) {
+            SDL_ConvertToStereo_SSE(dst, src, num_frames, src_channels, matrix, channel_converter);
+            return;
+        }
+        #endif
+        #ifdef SDL_NEON_INTRINSICS
+        if (SDL_HasNEON()) {
+            SDL_ConvertToStereo_NEON(dst, src, num_frames, src_channels, matrix, channel_converter);
+            return;
+        }
+        #endif
+    }
+
+    channel_converter(dst, src, num_frames);
+}
+
 static bool SDL_IsSupportedAudioFormat(const SDL_AudioFormat fmt)
 {
     switch (fmt) {
@@ -326,17 +453,7 @@ void ConvertAudio(int num_frames,
     // Gain adjustment
     if (gain != 1.0f) {
         float *buf = (float *)((channelconvert || dstconvert) ? scratch : dst);
-        const int total_samples = num_frames * src_channels;
-        if (src == buf) {
-            for (int i = 0; i < total_samples; i++) {
-                buf[i] *= gain;
-            }
-        } else {
-            const float *fsrc = (const float *)src;
-            for (int i = 0; i < total_samples; i++) {
-                buf[i] = fsrc[i] * gain;
-            }
-        }
+        ScaleFloat32Audio(buf, (const float *)src, num_frames * src_channels, gain);
         src = buf;
     }
 
@@ -364,12 +481,12 @@ void ConvertAudio(int num_frames,
             #endif
         }
 
+        void* buf = dstconvert ? scratch : dst;
         if (override) {
-            channel_converter = override;
+            override((float *) buf, (const float *) src, num_frames);
+        } else {
+            ConvertChannels((float *) buf, (const float *) src, num_frames, src_channels, dst_channels, channel_converter);
         }
-
-        void* buf = dstconvert ? scratch : dst;
-        channel_converter((float *) buf, (const float *) src, num_frames);
         src = buf;
     }
 
@@ -448,7 +565,8 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
 
     result->freq_ratio = 1.0f;
     result->gain = 1.0f;
-    result->queue = SDL_CreateAudioQueue(8192);
+    result->resampler_quality = SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM;
+    result->queue = SDL_CreateAudioQueue(SDL_AUDIO_QUEUE_CHUNK_SIZE);
 
     if (!result->queue) {
         SDL_free(result);
@@ -766,6 +884,42 @@ bool SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain)
     return true;
 }
 
+SDL_AudioResamplerQuality SDL_GetAudioStreamResamplerQuality(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return SDL_AUDIO_RESAMPLER_QUALITY_INVALID;
+    }
+
+    SDL_LockMutex(stream->lock);
+    const SDL_AudioResamplerQuality quality = stream->resampler_quality;
+    SDL_UnlockMutex(stream->lock);
+
+    return quality;
+}
+
+bool SDL_SetAudioStreamResamplerQuality(SDL_AudioStream *stream, SDL_AudioResamplerQuality quality)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLER_QUALITY_FAST:
+    case SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM:
+    case SDL_AUDIO_RESAMPLER_QUALITY_HIGH:
+        break;
+    default:
+        return SDL_InvalidParamError("quality");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->resampler_quality = quality;
+    SDL_UnlockMutex(stream->lock);
+
+    return true;
+}
+
 static bool CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
 {
     if (stream->src_spec.format == SDL_AUDIO_UNKNOWN) {
@@ -874,6 +1028,30 @@ bool SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
     return PutAudioStreamBuffer(stream, buf, len, NULL, NULL);
 }
 
+static void SDLCALL DontReleaseAudioBuffer(void *userdata, const void *buf, int len)
+{
+    // The app didn't ask to be told when we're done with the buffer
+}
+
+bool SDL_PutAudioStreamDataNoCopy(SDL_AudioStream *stream, const void *buf, int len, SDL_AudioStreamDataCompleteCallback callback, void *userdata)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (len == 0) {
+        if (callback) {
+            callback(userdata, buf, len);
+        }
+        return true; // nothing to do.
+    }
+
+    // A callback makes PutAudioStreamBuffer queue the buffer itself, rather than a copy of it
+    return PutAudioStreamBuffer(stream, buf, len, callback ? callback : DontReleaseAudioBuffer, userdata);
+}
+
 
 #define GENERIC_INTERLEAVE_FUNCTION(bits) \
     static void InterleaveAudioChannelsGeneric##bits(void *output, const void * const *channel_buffers, const int channels, int num_samples) { \
@@ -1094,7 +1272,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream* stream, void** inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate, stream->resampler_quality);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -1201,7 +1379,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // In fact, input_frames can sometimes even be zero when upsampling.
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
 
-    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate, stream->resampler_quality);
 
     const SDL_AudioFormat resample_format = SDL_AUDIO_F32;
 
@@ -1274,7 +1452,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     SDL_ResampleAudio(resample_channels,
                   (const float *) input_buffer, input_frames,
                   (float*) resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset, stream->resampler_quality);
 
     // Convert to the final format, if necessary (src channel map is NULL because SDL_ReadFromAudioQueue already handled this).
     ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, buf, dst_format, dst_channels, dst_map, work_buffer, postresample_gain);
@@ -1284,6 +1462,11 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
 
 // get converted/resampled data from the stream
 int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain)
+{
+    return SDL_GetAudioStreamDataDeferGain(stream, voidbuf, len, extra_gain, NULL);
+}
+
+int SDL_GetAudioStreamDataDeferGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, float *deferred_gain)
 {
     Uint8 *buf = (Uint8 *) voidbuf;
 
@@ -1311,7 +1494,13 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         return -1;
     }
 
-    const float gain = stream->gain * extra_gain;
+    // if the caller is going to scale the data itself (probably while mixing it), hand the gain back instead of applying it here.
+    float gain = stream->gain * extra_gain;
+    if (deferred_gain) {
+        *deferred_gain = gain;
+        gain = 1.0f;
+    }
+
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
     len -= len % dst_frame_size;  // chop off any fractional sample frame.
@@ -1381,6 +1570,23 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         total += output_frames * dst_frame_size;
     }
 
+    // Let go of input that has been read completely now, instead of on the next call,
+    // so buffers from SDL_PutAudioStreamDataNoCopy are handed back promptly.
+    {
+        SDL_AudioSpec input_spec;
+        int *input_chmap;
+        bool flushed;
+
+        if ((GetAudioStreamHead(stream, &input_spec, &input_chmap, &flushed) == 0) && flushed) {
+            SDL_PopAudioQueueHead(stream->queue);
+            SDL_zero(stream->input_spec);
+            stream->resample_offset = 0;
+            stream->input_chmap = NULL;
+        } else {
+            SDL_ReleaseConsumedAudioQueueTracks(stream->queue);
+        }
+    }
+
     SDL_UnlockMutex(stream->lock);
 
 #if DEBUG_AUDIOSTREAM
@@ -24,6 +24,7 @@
 #include "SDL_sysaudio.h"
 
 typedef struct SDL_MemoryPool SDL_MemoryPool;
+typedef struct SDL_SharedMemoryPool SDL_SharedMemoryPool;
 
 struct SDL_MemoryPool
 {
@@ -31,6 +32,23 @@ struct SDL_MemoryPool
     size_t block_size;
     size_t num_free;
     size_t max_free;
+    SDL_SharedMemoryPool *shared;
+};
+
+// A pool of free blocks shared by every audio queue, so blocks can move
+// between queues (and threads) without going back to the heap.
+// Each slot holds either NULL or one free block. Blocks are only ever moved
+// in or out of a slot with a single compare-and-swap, so there's no ABA problem.
+struct SDL_SharedMemoryPool
+{
+    void **slots;
+    int num_slots;
+    size_t block_size;
+    SDL_AtomicInt num_free;  // free blocks, plus slots reserved by threads about to release a block
+    SDL_AtomicInt next_slot; // where to start scanning, so threads don't all fight over the first slots
+    SDL_AtomicInt reused;
+    SDL_AtomicInt allocated;
+    SDL_AtomicInt released;
 };
 
 struct SDL_AudioTrack
@@ -64,12 +82,151 @@ struct SDL_AudioQueue
     SDL_MemoryPool chunk_pool;
 };
 
+static SDL_InitState shared_pool_init;
+static SDL_SharedMemoryPool shared_track_pool;
+static SDL_SharedMemoryPool shared_chunk_pool;
+
+static void InitSharedMemoryPool(SDL_SharedMemoryPool *pool, size_t block_size, int num_slots)
+{
+    pool->block_size = block_size;
+    pool->slots = NULL;
+    pool->num_slots = 0;
+    SDL_SetAtomicInt(&pool->num_free, 0);
+
+    if (num_slots > 0) {
+        pool->slots = (void **)SDL_calloc(num_slots, sizeof(*pool->slots));
+        if (pool->slots) {
+            pool->num_slots = num_slots;
+        }
+    }
+}
+
+static void DestroySharedMemoryPool(SDL_SharedMemoryPool *pool)
+{
+    for (int i = 0; i < pool->num_slots; ++i) {
+        SDL_free(SDL_SetAtomicPointer(&pool->slots[i], NULL));
+    }
+    SDL_free(pool->slots);
+    pool->slots = NULL;
+    pool->num_slots = 0;
+    SDL_SetAtomicInt(&pool->num_free, 0);
+}
+
+static void InitSharedMemoryPools(void)
+{
+    if (SDL_ShouldInit(&shared_pool_init)) {
+        const char *hint = SDL_GetHint(SDL_HINT_AUDIO_CHUNK_POOL_SIZE);
+        const Sint64 pool_size = hint ? SDL_strtoll(hint, NULL, 0) : SDL_AUDIO_CHUNK_POOL_SIZE;
+        const int num_chunks = (int)SDL_clamp(pool_size / SDL_AUDIO_QUEUE_CHUNK_SIZE, 0, SDL_MAX_SINT32 / 2);
+
+        // Every chunk needs a track, so keep as many free tracks as free chunks
+        InitSharedMemoryPool(&shared_chunk_pool, SDL_AUDIO_QUEUE_CHUNK_SIZE, num_chunks);
+        InitSharedMemoryPool(&shared_track_pool, sizeof(SDL_AudioTrack), num_chunks);
+
+        SDL_SetInitialized(&shared_pool_init, true);
+    }
+}
+
+void SDL_QuitAudioChunkPool(void)
+{
+    if (SDL_ShouldQuit(&shared_pool_init)) {
+        DestroySharedMemoryPool(&shared_chunk_pool);
+        DestroySharedMemoryPool(&shared_track_pool);
+        SDL_SetInitialized(&shared_pool_init, false);
+    }
+}
+
+bool SDL_GetAudioChunkPoolStats(SDL_AudioChunkPoolStats *stats, bool reset)
+{
+    SDL_SharedMemoryPool *pool = &shared_chunk_pool;
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_zerop(stats);
+    stats->chunk_size = SDL_AUDIO_QUEUE_CHUNK_SIZE;
+    stats->max_free_chunks = pool->num_slots;
+    stats->free_chunks = SDL_clamp(SDL_GetAtomicInt(&pool->num_free), 0, pool->num_slots);
+    stats->reused_chunks = (Uint32)SDL_GetAtomicInt(&pool->reused);
+    stats->allocated_chunks = (Uint32)SDL_GetAtomicInt(&pool->allocated);
+    stats->released_chunks = (Uint32)SDL_GetAtomicInt(&pool->released);
+
+    if (reset) {
+        // Subtract what we read, so nothing counted in the meantime is lost
+        SDL_AddAtomicInt(&pool->reused, -(int)stats->reused_chunks);
+        SDL_AddAtomicInt(&pool->allocated, -(int)stats->allocated_chunks);
+        SDL_AddAtomicInt(&pool->released, -(int)stats->released_chunks);
+    }
+
+    return true;
+}
+
+// Take a free block from a shared pool, or allocate a new one if it's empty
+static void *TakeSharedMemoryPoolBlock(SDL_SharedMemoryPool *pool)
+{
+    if (SDL_GetAtomicInt(&pool->num_free) > 0) {
+        const Uint32 num_slots = (Uint32)pool->num_slots;
+        const Uint32 start = (Uint32)SDL_AddAtomicInt(&pool->next_slot, 1);
+
+        for (Uint32 i = 0; i < num_slots; ++i) {
+            void **slot = &pool->slots[(start + i) % num_slots];
+            void *block = SDL_GetAtomicPointer(slot);
+
+            if (block && SDL_CompareAndSwapAtomicPointer(slot, block, NULL)) {
+                SDL_AddAtomicInt(&pool->num_free, -1);
+                SDL_AddAtomicInt(&pool->reused, 1);
+                return block;
+            }
+        }
+    }
+
+    SDL_AddAtomicInt(&pool->allocated, 1);
+    return SDL_malloc(pool->block_size);
+}
+
+// Give a block to a shared pool, or free it if the pool is full
+static void ReleaseSharedMemoryPoolBlock(SDL_SharedMemoryPool *pool, void *block)
+{
+    // Reserve a slot first, so there's always an empty slot for every thread that gets here
+    if (SDL_AddAtomicInt(&pool->num_free, 1) < pool->num_slots) {
+        const Uint32 num_slots = (Uint32)pool->num_slots;
+        const Uint32 start = (Uint32)SDL_AddAtomicInt(&pool->next_slot, 1);
+
+        // Other threads can fill the empty slots as we pass them, so this may take more than one pass
+        for (Uint32 i = 0; i < num_slots * 4; ++i) {
+            void **slot = &pool->slots[(start + i) % num_slots];
+
+            if (!SDL_GetAtomicPointer(slot) && SDL_CompareAndSwapAtomicPointer(slot, NULL, block)) {
+                return;
+            }
+        }
+    }
+
+    SDL_AddAtomicInt(&pool->num_free, -1);
+    SDL_AddAtomicInt(&pool->released, 1);
+    SDL_free(block);
+}
+
 // Allocate a new block, avoiding checking for ones already in the pool
 static void *AllocNewMemoryPoolBlock(const SDL_MemoryPool *pool)
 {
+    if (pool->shared) {
+        return TakeSharedMemoryPoolBlock(pool->shared);
+    }
     return SDL_malloc(pool->block_size);
 }
 
+// Free a block that doesn't fit in the pool
+static void FreeExtraMemoryPoolBlock(const SDL_MemoryPool *pool, void *block)
+{
+    if (pool->shared) {
+        ReleaseSharedMemoryPoolBlock(pool->shared, block);
+    } else {
+        SDL_free(block);
+    }
+}
+
 // Allocate a new block, first checking if there are any in the pool
 static void *AllocMemoryPoolBlock(SDL_MemoryPool *pool)
 {
@@ -91,7 +248,7 @@ static void FreeMemoryPoolBlock(SDL_MemoryPool *pool, void *block)
         pool->free_blocks = block;
         ++pool->num_free;
     } else {
-        SDL_free(block);
+        FreeExtraMemoryPoolBlock(pool, block);
     }
 }
 
@@ -104,20 +261,25 @@ static void DestroyMemoryPool(SDL_MemoryPool *pool)
 
     while (block) {
         void *next = *(void **)block;
-        SDL_free(block);
+        FreeExtraMemoryPoolBlock(pool, block);
         block = next;
     }
 }
 
 // Keeping a list of free chunks reduces memory allocations,
 // But also increases the amount of work to perform when freeing the track.
-static void InitMemoryPool(SDL_MemoryPool *pool, size_t block_size, size_t max_free)
+// Blocks that don't fit in the list go to the shared pool with the same block size, if there is one.
+static void InitMemoryPool(SDL_MemoryPool *pool, size_t block_size, size_t max_free, SDL_SharedMemoryPool *shared)
 {
     SDL_zerop(pool);
 
     SDL_assert(block_size >= sizeof(void *));
     pool->block_size = block_size;
     pool->max_free = max_free;
+
+    if (shared && shared->num_slots > 0 && shared->block_size == block_size) {
+        pool->shared = shared;
+    }
 }
 
 // Allocates a number of blocks and adds them to the pool
@@ -157,8 +319,9 @@ SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size)
         return NULL;
     }
 
-    InitMemoryPool(&queue->track_pool, sizeof(SDL_AudioTrack), 8);
-    InitMemoryPool(&queue->chunk_pool, chunk_size, 4);
+    InitSharedMemoryPools();
+    InitMemoryPool(&queue->track_pool, sizeof(SDL_AudioTrack), 8, &shared_track_pool);
+    InitMemoryPool(&queue->chunk_pool, chunk_size, 4, &shared_chunk_pool);
 
     if (!ReserveMemoryPoolBlocks(&queue->track_pool, 2)) {
         SDL_DestroyAudioQueue(queue);
@@ -601,6 +764,27 @@ const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
     return ptr;
 }
 
+void SDL_ReleaseConsumedAudioQueueTracks(SDL_AudioQueue *queue)
+{
+    SDL_AudioTrack *track = queue->head;
+
+    // Flushed tracks are left for SDL_PopAudioQueueHead, and partially filled tracks at the end can still be written to.
+    while (track && !track->flushed && (track->head == track->tail) && (track->next || (track->tail >= track->capacity))) {
+        SDL_AudioTrack *next = track->next;
+
+        // The track's data is about to go away, so keep what we need for resampling
+        UpdateAudioQueueHistory(queue, track->data, track->tail);
+
+        queue->head = next;
+        if (!next) {
+            queue->tail = NULL;
+        }
+
+        DestroyAudioTrack(queue, track);
+        track = next;
+    }
+}
+
 size_t SDL_GetAudioQueueQueued(SDL_AudioQueue *queue)
 {
     size_t total = 0;
@@ -25,11 +25,20 @@
 
 // Internal functions used by SDL_AudioStream for queueing audio.
 
+// The size of the chunks that audio streams queue their data in
+#define SDL_AUDIO_QUEUE_CHUNK_SIZE 8192
+
+// The default for SDL_HINT_AUDIO_CHUNK_POOL_SIZE
+#define SDL_AUDIO_CHUNK_POOL_SIZE (1024 * 1024)
+
 typedef void (SDLCALL *SDL_ReleaseAudioBufferCallback)(void *userdata, const void *buffer, int buflen);
 
 typedef struct SDL_AudioQueue SDL_AudioQueue;
 typedef struct SDL_AudioTrack SDL_AudioTrack;
 
+// Free every chunk in the pool shared by all audio queues
+extern void SDL_QuitAudioChunkPool(void);
+
 // Create a new audio queue
 extern SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size);
 
@@ -59,6 +68,10 @@ extern SDL_AudioTrack *SDL_CreateAudioTrack(SDL_AudioQueue *queue,
 // REQUIRES: `track != NULL`
 extern void SDL_AddTrackToAudioQueue(SDL_AudioQueue *queue, SDL_AudioTrack *track);
 
+// Destroy tracks at the head of the queue that have been completely read, releasing their buffers
+// REQUIRES: No pointers returned by SDL_ReadFromAudioQueue are still in use
+extern void SDL_ReleaseConsumedAudioQueueTracks(SDL_AudioQueue *queue);
+
 // Iterate over the tracks in the queue
 extern void *SDL_BeginAudioQueueIter(SDL_AudioQueue *queue);
 
@@ -826,6 +826,229 @@ static void SDL_Convert_Swap32_NEON(Uint32* dst, const Uint32* src, int num_samp
 
 #endif
 
+// Mixing kernels. These add (or copy) a scaled float32 buffer into another, so the
+// gain and the mix happen in a single pass over the data.
+
+static SDL_INLINE float ClampMixedSample(float sample)
+{
+    return (sample > 1.0f) ? 1.0f : ((sample < -1.0f) ? -1.0f : sample);
+}
+
+static void SDL_MixFloat32_Scalar(float *dst, const float *src, int num_samples, float gain)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        dst[i] = ClampMixedSample(dst[i] + (src[i] * gain));
+    }
+}
+
+static void SDL_ScaleFloat32_Scalar(float *dst, const float *src, int num_samples, float gain)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        dst[i] = src[i] * gain;
+    }
+}
+
+static void SDL_ScaleClampFloat32_Scalar(float *dst, const float *src, int num_samples, float gain)
+{
+    int i;
+
+    for (i = 0; i < num_samples; ++i) {
+        dst[i] = ClampMixedSample(src[i] * gain);
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") SDL_MixFloat32_SSE(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m128 vgain = _mm_set1_ps(gain);
+    const __m128 vmin = _mm_set1_ps(-1.0f);
+    const __m128 vmax = _mm_set1_ps(1.0f);
+
+    CONVERT_16_FWD({
+        dst[i] = ClampMixedSample(dst[i] + (src[i] * gain));
+    }, {
+        __m128 mixed0 = _mm_add_ps(_mm_load_ps(&dst[i]), _mm_mul_ps(_mm_loadu_ps(&src[i]), vgain));
+        __m128 mixed1 = _mm_add_ps(_mm_load_ps(&dst[i + 4]), _mm_mul_ps(_mm_loadu_ps(&src[i + 4]), vgain));
+        __m128 mixed2 = _mm_add_ps(_mm_load_ps(&dst[i + 8]), _mm_mul_ps(_mm_loadu_ps(&src[i + 8]), vgain));
+        __m128 mixed3 = _mm_add_ps(_mm_load_ps(&dst[i + 12]), _mm_mul_ps(_mm_loadu_ps(&src[i + 12]), vgain));
+
+        mixed0 = _mm_min_ps(_mm_max_ps(mixed0, vmin), vmax);
+        mixed1 = _mm_min_ps(_mm_max_ps(mixed1, vmin), vmax);
+        mixed2 = _mm_min_ps(_mm_max_ps(mixed2, vmin), vmax);
+        mixed3 = _mm_min_ps(_mm_max_ps(mixed3, vmin), vmax);
+
+        _mm_store_ps(&dst[i], mixed0);
+        _mm_store_ps(&dst[i + 4], mixed1);
+        _mm_store_ps(&dst[i + 8], mixed2);
+        _mm_store_ps(&dst[i + 12], mixed3);
+    })
+}
+
+static void SDL_TARGETING("sse") SDL_ScaleFloat32_SSE(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m128 vgain = _mm_set1_ps(gain);
+
+    CONVERT_16_FWD({
+        dst[i] = src[i] * gain;
+    }, {
+        const __m128 scaled0 = _mm_mul_ps(_mm_loadu_ps(&src[i]), vgain);
+        const __m128 scaled1 = _mm_mul_ps(_mm_loadu_ps(&src[i + 4]), vgain);
+        const __m128 scaled2 = _mm_mul_ps(_mm_loadu_ps(&src[i + 8]), vgain);
+        const __m128 scaled3 = _mm_mul_ps(_mm_loadu_ps(&src[i + 12]), vgain);
+
+        _mm_store_ps(&dst[i], scaled0);
+        _mm_store_ps(&dst[i + 4], scaled1);
+        _mm_store_ps(&dst[i + 8], scaled2);
+        _mm_store_ps(&dst[i + 12], scaled3);
+    })
+}
+
+static void SDL_TARGETING("sse") SDL_ScaleClampFloat32_SSE(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m128 vgain = _mm_set1_ps(gain);
+    const __m128 vmin = _mm_set1_ps(-1.0f);
+    const __m128 vmax = _mm_set1_ps(1.0f);
+
+    CONVERT_16_FWD({
+        dst[i] = ClampMixedSample(src[i] * gain);
+    }, {
+        const __m128 scaled0 = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&src[i]), vgain), vmin), vmax);
+        const __m128 scaled1 = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&src[i + 4]), vgain), vmin), vmax);
+        const __m128 scaled2 = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&src[i + 8]), vgain), vmin), vmax);
+        const __m128 scaled3 = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(&src[i + 12]), vgain), vmin), vmax);
+
+        _mm_store_ps(&dst[i], scaled0);
+        _mm_store_ps(&dst[i + 4], scaled1);
+        _mm_store_ps(&dst[i + 8], scaled2);
+        _mm_store_ps(&dst[i + 12], scaled3);
+    })
+}
+#endif
+
+#ifdef SDL_AVX_INTRINSICS
+// CONVERT_16_FWD only promises 16-byte alignment, so use unaligned loads/stores for the 32-byte vectors.
+static void SDL_TARGETING("avx") SDL_MixFloat32_AVX(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m256 vgain = _mm256_set1_ps(gain);
+    const __m256 vmin = _mm256_set1_ps(-1.0f);
+    const __m256 vmax = _mm256_set1_ps(1.0f);
+
+    CONVERT_16_FWD({
+        dst[i] = ClampMixedSample(dst[i] + (src[i] * gain));
+    }, {
+        __m256 mixed0 = _mm256_add_ps(_mm256_loadu_ps(&dst[i]), _mm256_mul_ps(_mm256_loadu_ps(&src[i]), vgain));
+        __m256 mixed1 = _mm256_add_ps(_mm256_loadu_ps(&dst[i + 8]), _mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), vgain));
+
+        mixed0 = _mm256_min_ps(_mm256_max_ps(mixed0, vmin), vmax);
+        mixed1 = _mm256_min_ps(_mm256_max_ps(mixed1, vmin), vmax);
+
+        _mm256_storeu_ps(&dst[i], mixed0);
+        _mm256_storeu_ps(&dst[i + 8], mixed1);
+    })
+}
+
+static void SDL_TARGETING("avx") SDL_ScaleFloat32_AVX(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m256 vgain = _mm256_set1_ps(gain);
+
+    CONVERT_16_FWD({
+        dst[i] = src[i] * gain;
+    }, {
+        const __m256 scaled0 = _mm256_mul_ps(_mm256_loadu_ps(&src[i]), vgain);
+        const __m256 scaled1 = _mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), vgain);
+
+        _mm256_storeu_ps(&dst[i], scaled0);
+        _mm256_storeu_ps(&dst[i + 8], scaled1);
+    })
+}
+
+static void SDL_TARGETING("avx") SDL_ScaleClampFloat32_AVX(float *dst, const float *src, int num_samples, float gain)
+{
+    const __m256 vgain = _mm256_set1_ps(gain);
+    const __m256 vmin = _mm256_set1_ps(-1.0f);
+    const __m256 vmax = _mm256_set1_ps(1.0f);
+
+    CONVERT_16_FWD({
+        dst[i] = ClampMixedSample(src[i] * gain);
+    }, {
+        const __m256 scaled0 = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), vgain), vmin), vmax);
+        const __m256 scaled1 = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i + 8]), vgain), vmin), vmax);
+
+        _mm256_storeu_ps(&dst[i], scaled0);
+        _mm256_storeu_ps(&dst[i + 8], scaled1);
+    })
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_MixFloat32_NEON(float *dst, const float *src, int num_samples, float gain)
+{
+    const float32x4_t vmin = vdupq_n_f32(-1.0f);
+    const float32x4_t vmax = vdupq_n_f32(1.0f);
+
+    CONVERT_16_FWD({
+        dst[i] = ClampMixedSample(dst[i] + (src[i] * gain));
+    }, {
+        // vmlaq_n_f32 is a separate multiply and add, so this rounds the same as the scalar code.
+        float32x4_t mixed0 = vmlaq_n_f32(vld1q_f32(&dst[i]), vld1q_f32(&src[i]), gain);
+        float32x4_t mixed1 = vmlaq_n_f32(vld1q_f32(&dst[i + 4]), vld1q_f32(&src[i + 4]), gain);
+        float32x4_t mixed2 = vmlaq_n_f32(vld1q_f32(&dst[i + 8]), vld1q_f32(&src[i + 8]), gain);
+        float32x4_t mixed3 = vmlaq_n_f32(vld1q_f32(&dst[i + 12]), vld1q_f32(&src[i + 12]), gain);
+
+        mixed0 = vminq_f32(vmaxq_f32(mixed0, vmin), vmax);
+        mixed1 = vminq_f32(vmaxq_f32(mixed1, vmin), vmax);
+        mixed2 = vminq_f32(vmaxq_f32(mixed2, vmin), vmax);
+        mixed3 = vminq_f32(vmaxq_f32(mixed3, vmin), vmax);
+
+        vst1q_f32(&dst[i], mixed0);
+        vst1q_f32(&dst[i + 4], mixed1);
+        vst1q_f32(&dst[i + 8], mixed2);
+        vst1q_f32(&dst[i + 12], mixed3);
+    })
+}
+
+static void SDL_ScaleFloat32_NEON(float *dst, const float *src, int num_samples, float gain)
+{
+    CONVERT_16_FWD({
+        dst[i] = src[i] * gain;
+    }, {
+        const float32x4_t scaled0 = vmulq_n_f32(vld1q_f32(&src[i]), gain);
+        const float32x4_t scaled1 = vmulq_n_f32(vld1q_f32(&src[i + 4]), gain);
+        const float32x4_t scaled2 = vmulq_n_f32(vld1q_f32(&src[i + 8]), gain);
+        const float32x4_t scaled3 = vmulq_n_f32(vld1q_f32(&src[i + 12]), gain);
+
+        vst1q_f32(&dst[i], scaled0);
+        vst1q_f32(&dst[i + 4], scaled1);
+        vst1q_f32(&dst[i + 8], scaled2);
+        vst1q_f32(&dst[i + 12], scaled3);
+    })
+}
+
+static void SDL_ScaleClampFloat32_NEON(float *dst, const float *src, int num_samples, float gain)
+{
+    const float32x4_t vmin = vdupq_n_f32(-1.0f);
+    const float32x4_t vmax = vdupq_n_f32(1.0f);
+
+    CONVERT_16_FWD({
+        dst[i] = ClampMixedSample(src[i] * gain);
+    }, {
+        const float32x4_t scaled0 = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(&src[i]), gain), vmin), vmax);
+        const float32x4_t scaled1 = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(&src[i + 4]), gain), vmin), vmax);
+        const float32x4_t scaled2 = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(&src[i + 8]), gain), vmin), vmax);
+        const float32x4_t scaled3 = vminq_f32(vmaxq_f32(vmulq_n_f32(vld1q_f32(&src[i + 12]), gain), vmin), vmax);
+
+        vst1q_f32(&dst[i], scaled0);
+        vst1q_f32(&dst[i + 4], scaled1);
+        vst1q_f32(&dst[i + 8], scaled2);
+        vst1q_f32(&dst[i + 12], scaled3);
+    })
+}
+#endif
+
 #undef CONVERT_16_FWD
 #undef CONVERT_16_REV
 
@@ -842,6 +1065,10 @@ static void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_sam
 static void (*SDL_Convert_Swap16)(Uint16* dst, const Uint16* src, int num_samples) = NULL;
 static void (*SDL_Convert_Swap32)(Uint32* dst, const Uint32* src, int num_samples) = NULL;
 
+static void (*SDL_MixFloat32)(float *dst, const float *src, int num_samples, float gain) = NULL;
+static void (*SDL_ScaleFloat32)(float *dst, const float *src, int num_samples, float gain) = NULL;
+static void (*SDL_ScaleClampFloat32)(float *dst, const float *src, int num_samples, float gain) = NULL;
+
 void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt)
 {
     switch (src_fmt) {
@@ -916,6 +1143,21 @@ void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_Aud
     }
 }
 
+void MixFloat32Audio(float *dst, const float *src, int num_samples, float gain)
+{
+    SDL_MixFloat32(dst, src, num_samples, gain);
+}
+
+void ScaleFloat32Audio(float *dst, const float *src, int num_samples, float gain)
+{
+    SDL_ScaleFloat32(dst, src, num_samples, gain);
+}
+
+void ScaleClampFloat32Audio(float *dst, const float *src, int num_samples, float gain)
+{
+    SDL_ScaleClampFloat32(dst, src, num_samples, gain);
+}
+
 void ConvertAudioSwapEndian(void* dst, const void* src, int num_samples, int bitsize)
 {
     switch (bitsize) {
@@ -978,5 +1220,31 @@ void SDL_ChooseAudioConverters(void)
 
 #undef SET_CONVERTER_FUNCS
 
+#define SET_MIXER_FUNCS(fntype) \
+    SDL_MixFloat32 = SDL_MixFloat32_##fntype; \
+    SDL_ScaleFloat32 = SDL_ScaleFloat32_##fntype; \
+    SDL_ScaleClampFloat32 = SDL_ScaleClampFloat32_##fntype;
+
+#ifdef SDL_AVX_INTRINSICS
+    if (SDL_HasAVX()) {
+        SET_MIXER_FUNCS(AVX);
+    } else
+#endif
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        SET_MIXER_FUNCS(SSE);
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SET_MIXER_FUNCS(NEON);
+    } else
+#endif
+    {
+        SET_MIXER_FUNCS(Scalar);
+    }
+
+#undef SET_MIXER_FUNCS
+
     converters_chosen = true;
 }
@@ -114,6 +114,13 @@ extern void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SD
 extern void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_AudioFormat dst_fmt);
 extern void ConvertAudioSwapEndian(void* dst, const void* src, int num_samples, int bitsize);
 
+// dst[i] = clamp(dst[i] + src[i] * gain, -1.0f, 1.0f), using the fastest kernel SDL_ChooseAudioConverters found.
+extern void MixFloat32Audio(float *dst, const float *src, int num_samples, float gain);
+// dst[i] = src[i] * gain. dst may equal src.
+extern void ScaleFloat32Audio(float *dst, const float *src, int num_samples, float gain);
+// dst[i] = clamp(src[i] * gain, -1.0f, 1.0f), the same as MixFloat32Audio into silence. dst may equal src.
+extern void ScaleClampFloat32Audio(float *dst, const float *src, int num_samples, float gain);
+
 extern bool SDL_ChannelMapIsDefault(const int *map, int channels);
 extern bool SDL_ChannelMapIsBogus(const int *map, int channels);
 
@@ -142,6 +149,9 @@ extern void OnAudioStreamDestroy(SDL_AudioStream *stream);
 // This just lets audio playback apply logical device gain at the same time as audiostream gain, so it's one multiplication instead of thousands.
 extern int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain);
 
+// Like SDL_GetAudioStreamDataAdjustGain, but leaves the data unscaled and reports the total gain in *deferred_gain, for callers that apply it while mixing.
+extern int SDL_GetAudioStreamDataDeferGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, float *deferred_gain);
+
 // This is the bulk of `SDL_SetAudioStream*putChannelMap`'s work, but it lets you skip the check about changing the device end of a stream if isinput==-1.
 extern bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec, int **stream_chmap, const int *chmap, int channels, int isinput);
 
@@ -195,6 +205,15 @@ typedef struct SDL_AudioDriver
     SDL_AtomicInt playback_device_count;
     SDL_AtomicInt recording_device_count;
     SDL_AtomicInt shutting_down;  // non-zero during SDL_Quit, so we known not to accept any last-minute device hotplugs.
+
+    // Optional pool of threads that convert bound playback streams in parallel (SDL_HINT_AUDIO_MIX_THREADS).
+    SDL_Mutex *mix_lock;  // protects everything below.
+    SDL_Condition *mix_cond;  // signaled when a batch of streams is queued, or on shutdown.
+    SDL_Condition *mix_done_cond;  // signaled when the last job of a batch finishes.
+    struct SDL_AudioMixBatch *mix_batches;  // batches that still have unclaimed jobs.
+    SDL_Thread **mix_threads;
+    int num_mix_threads;
+    bool mix_shutdown;
 } SDL_AudioDriver;
 
 struct SDL_AudioQueue; // forward decl.
@@ -216,6 +235,7 @@ struct SDL_AudioStream
     int *dst_chmap;
     float freq_ratio;
     float gain;
+    SDL_AudioResamplerQuality resampler_quality;  // set by SDL_SetAudioStreamResamplerQuality()
 
     struct SDL_AudioQueue* queue;
 
@@ -348,6 +368,12 @@ struct SDL_AudioDevice
     // Size of work_buffer (and mix_buffer) in bytes.
     int work_buffer_size;
 
+    // Jobs and per-stream output buffers used when bound streams are converted on the mix threads.
+    struct SDL_AudioMixJob *mix_jobs;
+    float *mix_job_buffers;
+    int max_mix_jobs;
+    int mix_job_buffer_stride;  // bytes between each job's buffer.
+
     // A thread to feed the audio device
     SDL_Thread *thread;
 
@@ -1159,7 +1159,10 @@ static bool LAW_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* Expands companded samples to 16 bits. Works backwards, so src and dst can
+ * point to the same memory.
+ */
+static bool LAW_Convert(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1199,54 +1202,9 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0
     };
 #endif
+    size_t i = sample_count;
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
-
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return false;
-        }
-    }
-
-    // Nothing to decode, nothing to return.
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return true;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    // 1 to avoid allocating zero bytes, to keep static analysis happy.
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!src) {
-        return false;
-    }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
-
-    /* Work backwards, since we're expanding in-place. `format` will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
         while (i--) {
@@ -1291,10 +1249,61 @@ static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    return true;
+}
+
+static bool LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return false;
+        }
+    }
+
+    // Nothing to decode, nothing to return.
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return true;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    // 1 to avoid allocating zero bytes, to keep static analysis happy.
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!src) {
+        return false;
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    /* Expanding in-place. `format` will inform the caller about the byte
+     * order.
+     */
+    if (!LAW_Convert(file->format.encoding, src, (Sint16 *)src, sample_count)) {
+        SDL_free(src);
+        return false;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1344,11 +1353,32 @@ static bool PCM_Init(WaveFile *file, size_t datalength)
     return true;
 }
 
+// Shifts 24-bit samples to 32 bits. Works backwards, so it can expand in-place.
+static void PCM_ExpandSint24ToSint32(Uint8 *ptr, size_t sample_count)
+{
+    size_t i;
+
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = ptr[o * 3];
+        b[2] = ptr[o * 3 + 1];
+        b[3] = ptr[o * 3 + 2];
+
+        ptr[o * 4 + 0] = b[0];
+        ptr[o * 4 + 1] = b[1];
+        ptr[o * 4 + 2] = b[2];
+        ptr[o * 4 + 3] = b[3];
+    }
+}
+
 static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1376,21 +1406,7 @@ static bool PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    // work from end to start, since we're expanding in-place.
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ExpandSint24ToSint32(ptr, sample_count);
 
     return true;
 }
@@ -1770,7 +1786,11 @@ static bool WaveCheckFormat(WaveFile *file, size_t datalength)
     return true;
 }
 
-static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Reads the chunk headers and the fmt chunk and initializes the decoder, but
+ * doesn't touch the audio data. The data chunk is returned in data and the
+ * position after the WAVE file in endposition.
+ */
+static bool WaveReadHeader(SDL_IOStream *src, WaveFile *file, WaveChunk *data, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1778,7 +1798,6 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
     const char *hint;
     Sint64 RIFFstart, RIFFend, lastchunkpos;
     bool RIFFlengthknown = false;
-    WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
     WaveChunk RIFFchunk;
     WaveChunk fmtchunk;
@@ -1981,6 +2000,74 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
 
     WaveFreeChunkData(chunk);
 
+    *data = datachunk;
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return true;
+}
+
+// Sets up the spec for the decoded data. All unsupported formats were filtered out by WaveCheckFormat.
+static bool WaveGetSpec(WaveFile *file, SDL_AudioSpec *spec)
+{
+    WaveFormat *format = &file->format;
+
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = SDL_AUDIO_UNKNOWN;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        // These can be easily stored in the byte order of the system.
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: // Gets shifted to 32 bits.
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            // Just in case something unexpected happened in the checks.
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
+    return true;
+}
+
+static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    WaveChunk datachunk;
+
+    SDL_zero(datachunk);
+
+    if (!WaveReadHeader(src, file, &datachunk, &endposition)) {
+        return false;
+    }
+
     // Process data chunk.
     *chunk = datachunk;
 
@@ -2027,51 +2114,12 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = SDL_AUDIO_UNKNOWN;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        // These can be easily stored in the byte order of the system.
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: // Has been shifted to 32 bits.
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            // Just in case something unexpected happened in the checks.
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
+    if (!WaveGetSpec(file, spec)) {
+        return false;
     }
 
     // Report the end position back to the cleanup code.
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return true;
 }
@@ -2149,3 +2197,439 @@ bool SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint3
     return SDL_LoadWAV_IO(stream, true, spec, audio_buf, audio_len);
 }
 
+
+/* Uncompressed and companded data is decoded in spans of about this many
+ * bytes. ADPCM data is decoded one block at a time.
+ */
+#define WAVE_DECODER_SPAN_SIZE 16384
+
+struct SDL_WAVDecoder
+{
+    SDL_IOStream *src;
+    bool closeio;
+    WaveFile file;
+    SDL_AudioSpec spec;
+    size_t framesize;       // Size of a decoded sample frame.
+    size_t inframesize;     // Size of an uncompressed sample frame in the data chunk.
+    size_t blockheadersize; // Size of the ADPCM block header.
+    Sint64 dataposition;    // Position of the data chunk data in the stream.
+    Sint64 datalength;      // Number of bytes in the data chunk that can be read.
+    Sint64 ioposition;      // Current position in the stream, or -1 if unknown.
+    Sint64 framestotal;     // Number of sample frames that will be decoded.
+    Sint64 blockframes;     // Sample frames per block or span.
+    size_t blocksize;       // Bytes per block or span in the data chunk.
+    Sint64 block;           // Index of the next block to decode.
+    Sint64 position;        // Sample frame that will be returned next.
+    Sint64 skipframes;      // Sample frames to drop from the next block after a seek.
+    bool eof;               // No more blocks can be decoded.
+    Uint8 *input;           // Compressed data of the current block.
+    Uint8 *output;          // Decoded data of the current block.
+    size_t outputpos;
+    size_t outputsize;
+    void *cstate;           // ADPCM decoding state for each channel.
+};
+
+// Recalculates the number of sample frames if not all of the data chunk is available.
+static bool WaveSetDataLength(WaveFile *file, size_t datalength)
+{
+    switch (file->format.encoding) {
+    case MS_ADPCM_CODE:
+        return MS_ADPCM_CalculateSampleFrames(file, datalength);
+    case IMA_ADPCM_CODE:
+        return IMA_ADPCM_CalculateSampleFrames(file, datalength);
+    default:
+        file->sampleframes = WaveAdjustToFactValue(file, datalength / file->format.blockalign);
+        return file->sampleframes >= 0;
+    }
+}
+
+static bool WaveDecoderDecodeADPCM(SDL_WAVDecoder *decoder, size_t blocksize, Sint64 *frames)
+{
+    WaveFile *file = &decoder->file;
+    ADPCM_DecoderState state;
+    bool result;
+
+    SDL_zero(state);
+    state.channels = file->format.channels;
+    state.blocksize = file->format.blockalign;
+    state.blockheadersize = decoder->blockheadersize;
+    state.samplesperblock = file->format.samplesperblock;
+    state.framesize = state.channels * sizeof(Sint16);
+    state.ddata = file->decoderdata;
+    state.cstate = decoder->cstate;
+    state.framestotal = decoder->framestotal;
+    state.framesleft = *frames;
+
+    state.block.data = decoder->input;
+    state.block.size = blocksize;
+    state.block.pos = 0;
+
+    state.output.data = (Sint16 *)decoder->output;
+    state.output.size = (size_t)decoder->blockframes * state.channels;
+    state.output.pos = 0;
+
+    if (file->format.encoding == MS_ADPCM_CODE) {
+        result = MS_ADPCM_DecodeBlockHeader(&state);
+        if (!result) {
+            return false;
+        }
+        result = MS_ADPCM_DecodeBlockData(&state);
+    } else {
+        result = IMA_ADPCM_DecodeBlockHeader(&state);
+        if (!result) {
+            return false;
+        }
+        result = IMA_ADPCM_DecodeBlockData(&state);
+    }
+
+    if (!result) {
+        // Unexpected end. Same handling as in MS_ADPCM_Decode and IMA_ADPCM_Decode.
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Truncated data chunk");
+        } else if (file->trunchint != TruncDropFrame) {
+            state.output.pos -= state.output.pos % (state.samplesperblock * state.channels);
+        }
+        decoder->eof = true;
+    }
+
+    if ((Sint64)(state.output.pos / state.channels) < *frames) {
+        *frames = state.output.pos / state.channels;
+    }
+
+    return true;
+}
+
+// Decodes the next block into the output buffer.
+static bool WaveDecoderDecodeBlock(SDL_WAVDecoder *decoder)
+{
+    WaveFile *file = &decoder->file;
+    const Uint16 channels = file->format.channels;
+    const Sint64 first = decoder->block * decoder->blockframes;
+    const Sint64 offset = decoder->block * (Sint64)decoder->blocksize;
+    const bool adpcm = decoder->input != NULL;
+    Sint64 frames = 0;
+    size_t length = 0;
+    size_t got = 0;
+
+    decoder->outputpos = 0;
+    decoder->outputsize = 0;
+
+    if (first < decoder->framestotal && offset < decoder->datalength) {
+        frames = SDL_min(decoder->blockframes, decoder->framestotal - first);
+        if (adpcm) {
+            length = (size_t)SDL_min((Sint64)decoder->blocksize, decoder->datalength - offset);
+        } else {
+            length = (size_t)SDL_min(frames * (Sint64)decoder->inframesize, decoder->datalength - offset);
+        }
+    }
+
+    if (length > 0) {
+        const Sint64 position = decoder->dataposition + offset;
+        Uint8 *dst = adpcm ? decoder->input : decoder->output;
+
+        if (decoder->ioposition != position && SDL_SeekIO(decoder->src, position, SDL_IO_SEEK_SET) != position) {
+            decoder->ioposition = -1;
+            return SDL_SetError("Could not seek data of WAVE data chunk");
+        }
+        got = SDL_ReadIO(decoder->src, dst, length);
+        decoder->ioposition = position + got;
+
+        if (got != length) {
+            if (SDL_GetIOStatus(decoder->src) == SDL_IO_STATUS_ERROR) {
+                return false;
+            } else if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+                return SDL_SetError("Could not read data of WAVE data chunk");
+            }
+            // The stream ended early. Decode what we got and stop after that.
+            decoder->datalength = offset + got;
+            decoder->eof = true;
+        }
+    }
+
+    if (adpcm) {
+        if (got < decoder->blockheadersize) {
+            frames = 0;
+        } else if (!WaveDecoderDecodeADPCM(decoder, got, &frames)) {
+            return false;
+        }
+    } else {
+        frames = got / decoder->inframesize;
+
+        switch (file->format.encoding) {
+        case ALAW_CODE:
+        case MULAW_CODE:
+            if (!LAW_Convert(file->format.encoding, decoder->output, (Sint16 *)decoder->output, (size_t)frames * channels)) {
+                return false;
+            }
+            break;
+        case PCM_CODE:
+            if (file->format.bitspersample == 24) {
+                PCM_ExpandSint24ToSint32(decoder->output, (size_t)frames * channels);
+            }
+            break;
+        }
+    }
+
+    if (frames == 0) {
+        decoder->eof = true;
+    }
+
+    decoder->block++;
+    decoder->outputsize = (size_t)frames * decoder->framesize;
+
+    return true;
+}
+
+// Makes sure there is decoded data. Returns the number of bytes available, 0 at the end, or -1 on error.
+static int WaveDecoderFill(SDL_WAVDecoder *decoder)
+{
+    while (decoder->outputpos == decoder->outputsize) {
+        size_t skip;
+
+        if (decoder->eof) {
+            return 0;
+        } else if (!WaveDecoderDecodeBlock(decoder)) {
+            return -1;
+        }
+
+        skip = (size_t)decoder->skipframes * decoder->framesize;
+        decoder->outputpos = SDL_min(skip, decoder->outputsize);
+        decoder->skipframes = 0;
+    }
+
+    return (int)(decoder->outputsize - decoder->outputpos);
+}
+
+void SDL_DestroyWAVDecoder(SDL_WAVDecoder *decoder)
+{
+    if (!decoder) {
+        return;
+    }
+
+    if (decoder->closeio) {
+        SDL_CloseIO(decoder->src);
+    }
+    WaveFreeChunkData(&decoder->file.chunk);
+    SDL_free(decoder->file.decoderdata);
+    SDL_free(decoder->cstate);
+    SDL_free(decoder->input);
+    SDL_free(decoder->output);
+    SDL_free(decoder);
+}
+
+SDL_WAVDecoder *SDL_CreateWAVDecoder(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec)
+{
+    SDL_WAVDecoder *decoder = NULL;
+    WaveFile *file;
+    WaveFormat *format;
+    WaveChunk datachunk;
+    Sint64 endposition, iosize;
+    Sint64 available;
+
+    if (spec) {
+        SDL_zerop(spec);
+    }
+
+    if (!src) {
+        SDL_InvalidParamError("src");
+        goto failed;
+    } else if (!spec) {
+        SDL_InvalidParamError("spec");
+        goto failed;
+    }
+
+    decoder = (SDL_WAVDecoder *)SDL_calloc(1, sizeof(*decoder));
+    if (!decoder) {
+        goto failed;
+    }
+    decoder->src = src;
+    decoder->ioposition = -1;
+
+    file = &decoder->file;
+    format = &file->format;
+    file->riffhint = WaveGetRiffSizeHint();
+    file->trunchint = WaveGetTruncationHint();
+    file->facthint = WaveGetFactChunkHint();
+
+    SDL_zero(datachunk);
+    if (!WaveReadHeader(src, file, &datachunk, &endposition) || !WaveGetSpec(file, &decoder->spec)) {
+        goto failed;
+    }
+
+    /* SDL_LoadWAV_IO finds out how much of the data chunk is there by reading
+     * it. The size of the stream tells us the same without reading anything.
+     */
+    available = datachunk.length;
+    iosize = SDL_GetIOSize(src);
+    if (iosize >= 0 && iosize - datachunk.position < available) {
+        available = SDL_max(iosize - datachunk.position, 0);
+    }
+    if (available != datachunk.length) {
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            SDL_SetError("Could not read data of WAVE data chunk");
+            goto failed;
+        } else if (!WaveSetDataLength(file, (size_t)available)) {
+            goto failed;
+        }
+    }
+
+    decoder->dataposition = datachunk.position;
+    decoder->datalength = available;
+    decoder->framesize = (size_t)format->channels * SDL_AUDIO_BYTESIZE(decoder->spec.format);
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        decoder->blockheadersize = (size_t)format->channels * (format->encoding == MS_ADPCM_CODE ? 7 : 4);
+        decoder->blockframes = format->samplesperblock;
+        decoder->blocksize = format->blockalign;
+        decoder->framestotal = file->sampleframes;
+        decoder->input = (Uint8 *)SDL_malloc(decoder->blocksize);
+        decoder->cstate = SDL_calloc(format->channels, sizeof(MS_ADPCM_ChannelState));
+        if (!decoder->input || !decoder->cstate) {
+            goto failed;
+        }
+        break;
+    default:
+        /* The decoders count uncompressed data in units of the block size,
+         * which may be smaller than a sample frame.
+         */
+        decoder->inframesize = (size_t)format->channels * (format->bitspersample / 8);
+        decoder->blockframes = SDL_max(WAVE_DECODER_SPAN_SIZE / decoder->framesize, 1);
+        decoder->blocksize = (size_t)decoder->blockframes * decoder->inframesize;
+        decoder->framestotal = (file->sampleframes * format->blockalign) / (Sint64)decoder->inframesize;
+        break;
+    }
+
+    decoder->output = (Uint8 *)SDL_malloc((size_t)decoder->blockframes * decoder->framesize);
+    if (!decoder->output) {
+        goto failed;
+    }
+
+    decoder->closeio = closeio;
+    *spec = decoder->spec;
+    return decoder;
+
+failed:
+    SDL_DestroyWAVDecoder(decoder);
+    if (closeio && src) {
+        SDL_CloseIO(src);
+    }
+    return NULL;
+}
+
+int SDL_ReadWAVDecoder(SDL_WAVDecoder *decoder, void *buf, int len)
+{
+    Uint8 *dst = (Uint8 *)buf;
+    int total = 0;
+
+    if (!decoder) {
+        SDL_InvalidParamError("decoder");
+        return -1;
+    } else if (!buf) {
+        SDL_InvalidParamError("buf");
+        return -1;
+    } else if (len < 0) {
+        SDL_InvalidParamError("len");
+        return -1;
+    }
+
+    len -= len % (int)decoder->framesize;
+
+    while (total < len) {
+        const int available = WaveDecoderFill(decoder);
+        int amount;
+
+        if (available < 0) {
+            return -1;
+        } else if (available == 0) {
+            break;
+        }
+
+        amount = SDL_min(available, len - total);
+        SDL_memcpy(dst + total, decoder->output + decoder->outputpos, amount);
+        decoder->outputpos += amount;
+        decoder->position += amount / (int)decoder->framesize;
+        total += amount;
+    }
+
+    return total;
+}
+
+int SDL_PutWAVDecoderData(SDL_WAVDecoder *decoder, SDL_AudioStream *stream, int frames)
+{
+    int total = 0;
+
+    if (!decoder) {
+        SDL_InvalidParamError("decoder");
+        return -1;
+    } else if (!stream) {
+        SDL_InvalidParamError("stream");
+        return -1;
+    } else if (frames < 0) {
+        SDL_InvalidParamError("frames");
+        return -1;
+    }
+
+    while (total < frames) {
+        const int available = WaveDecoderFill(decoder);
+        int amount;
+
+        if (available < 0) {
+            return -1;
+        } else if (available == 0) {
+            break;
+        }
+
+        amount = SDL_min(available / (int)decoder->framesize, frames - total);
+        if (!SDL_PutAudioStreamData(stream, decoder->output + decoder->outputpos, amount * (int)decoder->framesize)) {
+            return -1;
+        }
+        decoder->outputpos += (size_t)amount * decoder->framesize;
+        decoder->position += amount;
+        total += amount;
+    }
+
+    return total;
+}
+
+bool SDL_SeekWAVDecoder(SDL_WAVDecoder *decoder, Sint64 frame)
+{
+    if (!decoder) {
+        return SDL_InvalidParamError("decoder");
+    } else if (frame < 0) {
+        return SDL_InvalidParamError("frame");
+    }
+
+    if (frame > decoder->framestotal) {
+        frame = decoder->framestotal;
+    }
+
+    // The block is decoded on the next read, the frames before the target get dropped then.
+    decoder->block = frame / decoder->blockframes;
+    decoder->skipframes = frame % decoder->blockframes;
+    decoder->position = frame;
+    decoder->outputpos = 0;
+    decoder->outputsize = 0;
+    decoder->eof = false;
+
+    return true;
+}
+
+Sint64 SDL_TellWAVDecoder(SDL_WAVDecoder *decoder)
+{
+    if (!decoder) {
+        SDL_InvalidParamError("decoder");
+        return -1;
+    }
+    return decoder->position;
+}
+
+Sint64 SDL_GetWAVDecoderLength(SDL_WAVDecoder *decoder)
+{
+    if (!decoder) {
+        SDL_InvalidParamError("decoder");
+        return -1;
+    }
+    return decoder->framestotal;
+}
@@ -1278,3 +1278,47 @@
 #define SDL_PutAudioStreamPlanarData SDL_PutAudioStreamPlanarData_REAL
 #define SDL_SetAudioIterationCallbacks SDL_SetAudioIterationCallbacks_REAL
 #define SDL_GetEventDescription SDL_GetEventDescription_REAL
+#define SDL_GetEventsByType SDL_GetEventsByType_REAL
+#define SDL_GetTimerLatencyHistogram SDL_GetTimerLatencyHistogram_REAL
+#define SDL_PutAudioStreamDataNoCopy SDL_PutAudioStreamDataNoCopy_REAL
+#define SDL_GetAudioChunkPoolStats SDL_GetAudioChunkPoolStats_REAL
+#define SDL_CreateWAVDecoder SDL_CreateWAVDecoder_REAL
+#define SDL_ReadWAVDecoder SDL_ReadWAVDecoder_REAL
+#define SDL_PutWAVDecoderData SDL_PutWAVDecoderData_REAL
+#define SDL_SeekWAVDecoder SDL_SeekWAVDecoder_REAL
+#define SDL_TellWAVDecoder SDL_TellWAVDecoder_REAL
+#define SDL_GetWAVDecoderLength SDL_GetWAVDecoderLength_REAL
+#define SDL_DestroyWAVDecoder SDL_DestroyWAVDecoder_REAL
+#define SDL_SetLogAsync SDL_SetLogAsync_REAL
+#define SDL_GetLogAsyncStats SDL_GetLogAsyncStats_REAL
+#define SDL_SetLogDeferred SDL_SetLogDeferred_REAL
+#define SDL_ReadLogRecords SDL_ReadLogRecords_REAL
+#define SDL_FormatLogRecord SDL_FormatLogRecord_REAL
+#define SDL_GetPropertyKey SDL_GetPropertyKey_REAL
+#define SDL_GetPropertyKeyName SDL_GetPropertyKeyName_REAL
+#define SDL_SetPointerPropertyWithCleanupByKey SDL_SetPointerPropertyWithCleanupByKey_REAL
+#define SDL_SetPointerPropertyByKey SDL_SetPointerPropertyByKey_REAL
+#define SDL_SetStringPropertyByKey SDL_SetStringPropertyByKey_REAL
+#define SDL_SetNumberPropertyByKey SDL_SetNumberPropertyByKey_REAL
+#define SDL_SetFloatPropertyByKey SDL_SetFloatPropertyByKey_REAL
+#define SDL_SetBooleanPropertyByKey SDL_SetBooleanPropertyByKey_REAL
+#define SDL_HasPropertyByKey SDL_HasPropertyByKey_REAL
+#define SDL_GetPropertyTypeByKey SDL_GetPropertyTypeByKey_REAL
+#define SDL_GetPointerPropertyByKey SDL_GetPointerPropertyByKey_REAL
+#define SDL_GetStringPropertyByKey SDL_GetStringPropertyByKey_REAL
+#define SDL_GetNumberPropertyByKey SDL_GetNumberPropertyByKey_REAL
+#define SDL_GetFloatPropertyByKey SDL_GetFloatPropertyByKey_REAL
+#define SDL_GetBooleanPropertyByKey SDL_GetBooleanPropertyByKey_REAL
+#define SDL_ClearPropertyByKey SDL_ClearPropertyByKey_REAL
+#define SDL_GetHintGeneration SDL_GetHintGeneration_REAL
+#define SDL_GetCachedHintBoolean SDL_GetCachedHintBoolean_REAL
+#define SDL_GetThreadCacheMemoryFunctions SDL_GetThreadCacheMemoryFunctions_REAL
+#define SDL_CreateMemoryArena SDL_CreateMemoryArena_REAL
+#define SDL_AllocateArenaMemory SDL_AllocateArenaMemory_REAL
+#define SDL_ResetMemoryArena SDL_ResetMemoryArena_REAL
+#define SDL_DestroyMemoryArena SDL_DestroyMemoryArena_REAL
+#define SDL_EnableMemoryStats SDL_EnableMemoryStats_REAL
+#define SDL_GetMemoryStats SDL_GetMemoryStats_REAL
+#define SDL_ResetMemoryStats SDL_ResetMemoryStats_REAL
+#define SDL_GetAudioStreamResamplerQuality SDL_GetAudioStreamResamplerQuality_REAL
+#define SDL_SetAudioStreamResamplerQuality SDL_SetAudioStreamResamplerQuality_REAL
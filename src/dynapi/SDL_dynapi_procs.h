@@ -1286,3 +1286,47 @@ SDL_DYNAPI_PROC(SDL_Renderer*,SDL_CreateGPURenderer,(SDL_Window *a,SDL_GPUShader
 SDL_DYNAPI_PROC(bool,SDL_PutAudioStreamPlanarData,(SDL_AudioStream *a,const void * const*b,int c,int d),(a,b,c,d),return)
 SDL_DYNAPI_PROC(bool,SDL_SetAudioIterationCallbacks,(SDL_AudioDeviceID a,SDL_AudioIterationCallback b,SDL_AudioIterationCallback c,void *d),(a,b,c,d),return)
 SDL_DYNAPI_PROC(int,SDL_GetEventDescription,(const SDL_Event *a,char *b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_GetEventsByType,(SDL_Event *a,int b,const Uint32 *c,int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_GetTimerLatencyHistogram,(SDL_TimerLatencyHistogram *a,bool b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_PutAudioStreamDataNoCopy,(SDL_AudioStream *a,const void *b,int c,SDL_AudioStreamDataCompleteCallback d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_GetAudioChunkPoolStats,(SDL_AudioChunkPoolStats *a,bool b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_WAVDecoder*,SDL_CreateWAVDecoder,(SDL_IOStream *a,bool b,SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_ReadWAVDecoder,(SDL_WAVDecoder *a,void *b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_PutWAVDecoderData,(SDL_WAVDecoder *a,SDL_AudioStream *b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SeekWAVDecoder,(SDL_WAVDecoder *a,Sint64 b),(a,b),return)
+SDL_DYNAPI_PROC(Sint64,SDL_TellWAVDecoder,(SDL_WAVDecoder *a),(a),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetWAVDecoderLength,(SDL_WAVDecoder *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyWAVDecoder,(SDL_WAVDecoder *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_SetLogAsync,(bool a,SDL_LogOverflowPolicy b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetLogAsyncStats,(SDL_LogAsyncStats *a,bool b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_SetLogDeferred,(bool a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_ReadLogRecords,(SDL_LogRecordFunction a,void *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_FormatLogRecord,(const SDL_LogRecord *a,char *b,size_t c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_PropertyKey,SDL_GetPropertyKey,(const char *a),(a),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetPropertyKeyName,(SDL_PropertyKey a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetPointerPropertyWithCleanupByKey,(SDL_PropertiesID a,SDL_PropertyKey b,void *c,SDL_CleanupPropertyCallback d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_SetPointerPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetStringPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetNumberPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetFloatPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,float c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SetBooleanPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_HasPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_PropertyType,SDL_GetPropertyTypeByKey,(SDL_PropertiesID a,SDL_PropertyKey b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_GetPointerPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetStringPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetNumberPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(float,SDL_GetFloatPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,float c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_GetBooleanPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_ClearPropertyByKey,(SDL_PropertiesID a,SDL_PropertyKey b),(a,b),return)
+SDL_DYNAPI_PROC(Uint32,SDL_GetHintGeneration,(void),(),return)
+SDL_DYNAPI_PROC(bool,SDL_GetCachedHintBoolean,(const char *a,bool b,SDL_HintCache *c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_GetThreadCacheMemoryFunctions,(SDL_malloc_func *a,SDL_calloc_func *b,SDL_realloc_func *c,SDL_free_func *d),(a,b,c,d),)
+SDL_DYNAPI_PROC(SDL_MemoryArena*,SDL_CreateMemoryArena,(size_t a),(a),return)
+SDL_DYNAPI_PROC(void*,SDL_AllocateArenaMemory,(SDL_MemoryArena *a,size_t b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ResetMemoryArena,(SDL_MemoryArena *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DestroyMemoryArena,(SDL_MemoryArena *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_EnableMemoryStats,(void),(),return)
+SDL_DYNAPI_PROC(bool,SDL_GetMemoryStats,(SDL_MemoryTag a,SDL_MemoryStats *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ResetMemoryStats,(void),(),)
+SDL_DYNAPI_PROC(SDL_AudioResamplerQuality,SDL_GetAudioStreamResamplerQuality,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetAudioStreamResamplerQuality,(SDL_AudioStream *a,SDL_AudioResamplerQuality b),(a,b),return)
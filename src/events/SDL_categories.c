@@ -38,7 +38,6 @@ SDL_EventCategory SDL_GetEventCategory(Uint32 type)
     }
     switch (type) {
     default:
-        SDL_SetError("Unknown event type");
         return SDL_EVENTCATEGORY_UNKNOWN;
 
     case SDL_EVENT_KEYMAP_CHANGED:
@@ -187,8 +186,14 @@ SDL_EventCategory SDL_GetEventCategory(Uint32 type)
 SDL_Window *SDL_GetWindowFromEvent(const SDL_Event *event)
 {
     SDL_WindowID windowID;
+    const SDL_EventCategory category = SDL_GetEventCategory(event->type);
+
+    if (category == SDL_EVENTCATEGORY_UNKNOWN) {
+        SDL_SetError("Unknown event type");
+        return NULL;
+    }
 
-    switch (SDL_GetEventCategory(event->type)) {
+    switch (category) {
     case SDL_EVENTCATEGORY_USER:
         windowID = event->user.windowID;
         break;
@@ -241,8 +246,7 @@ SDL_Window *SDL_GetWindowFromEvent(const SDL_Event *event)
         windowID = event->render.windowID;
         break;
     default:
-        // < 0  -> invalid event type (error is set by SDL_GetEventCategory)
-        // else -> event has no associated window (not an error)
+        // event has no associated window (not an error)
         return NULL;
     }
     return SDL_GetWindowFromID(windowID);
@@ -23,6 +23,7 @@
 // General event handling code for SDL
 
 #include "SDL_events_c.h"
+#include "SDL_categories_c.h"
 #include "SDL_eventwatch_c.h"
 #include "SDL_windowevents_c.h"
 #include "../SDL_hints_c.h"
@@ -112,17 +113,40 @@ typedef struct
 static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static SDL_AtomicInt SDL_userevents;
 
+/* Temporary memory comes from an arena belonging to the thread that
+   allocated it. Memory that's attached to an event keeps a reference on its
+   arena, so the memory stays valid until the thread that gets the event is
+   done with it. A thread's arena is reset when nothing refers to it anymore,
+   or left to the events that still use it once it has grown big enough.
+ */
+#define SDL_TEMPORARY_ARENA_BLOCK_SIZE  4096
+#define SDL_TEMPORARY_ARENA_RETIRE_SIZE (64 * 1024)
+
+typedef struct SDL_TemporaryArena
+{
+    SDL_AtomicInt refcount; // one for the thread allocating from it, plus one for each allocation held by an event
+    SDL_MemoryArena *arena;
+} SDL_TemporaryArena;
+
 typedef struct SDL_TemporaryMemory
 {
-    void *memory;
+    SDL_TemporaryArena *owner;
+    bool referenced; // true if this holds a reference on its owner
     struct SDL_TemporaryMemory *prev;
     struct SDL_TemporaryMemory *next;
 } SDL_TemporaryMemory;
 
+// The header is a multiple of the arena alignment, so the memory after it is aligned too
+#define SDL_TEMPORARY_MEMORY_HEADER_SIZE ((sizeof(SDL_TemporaryMemory) + 15) & ~(size_t)15)
+#define SDL_TEMPORARY_MEMORY_DATA(entry) ((void *)((Uint8 *)(entry) + SDL_TEMPORARY_MEMORY_HEADER_SIZE))
+
 typedef struct SDL_TemporaryMemoryState
 {
     SDL_TemporaryMemory *head;
     SDL_TemporaryMemory *tail;
+    SDL_TemporaryArena *arena;
+    int num_allocated;      // entries in the list that were allocated by this thread
+    size_t allocated_bytes; // allocated from the arena since it was last reset
 } SDL_TemporaryMemoryState;
 
 static SDL_TLSID SDL_temporary_memory;
@@ -131,10 +155,26 @@ typedef struct SDL_EventEntry
 {
     SDL_Event event;
     SDL_TemporaryMemory *memory;
+    Uint64 serial;
+    SDL_EventCategory category;
     struct SDL_EventEntry *prev;
     struct SDL_EventEntry *next;
+    struct SDL_EventEntry *category_prev;
+    struct SDL_EventEntry *category_next;
 } SDL_EventEntry;
 
+/* Queued events are also linked into a list per event category, so looking
+   for a specific type or range of types only visits the categories that can
+   contain it, instead of walking the whole queue.
+ */
+typedef struct SDL_EventBucket
+{
+    SDL_EventEntry *head;
+    SDL_EventEntry *tail;
+    Uint32 min_type; // the range of types queued since the bucket was last empty
+    Uint32 max_type;
+} SDL_EventBucket;
+
 static struct
 {
     SDL_Mutex *lock;
@@ -144,14 +184,98 @@ static struct
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
-} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL };
+    Uint64 serial;
+    SDL_EventBucket buckets[SDL_EVENTCATEGORY_COUNT];
+} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL, 0, { { NULL, NULL, 0, 0 } } };
+
+// The set of event types an operation on the queue applies to
+typedef struct SDL_EventMatch
+{
+    Uint32 minType;
+    Uint32 maxType;
+    const Uint32 *types; // if not NULL, the type must also be one of these
+    int numtypes;
+} SDL_EventMatch;
+
+// Walks the queued events that match, in the order they were queued
+typedef struct SDL_EventIterator
+{
+    const SDL_EventMatch *match;
+    bool whole_queue;
+    SDL_EventEntry *next;
+    int num_cursors;
+    SDL_EventEntry *cursors[SDL_EVENTCATEGORY_COUNT];
+} SDL_EventIterator;
+
+/* SDL_PushEvent() stages events in this bounded ring without taking the
+   queue lock, so threads pushing at high rates don't contend with each other
+   or with the thread reading events. Each slot carries a sequence number
+   that tells producers and the consumer whose turn it is. The ring is only
+   drained into SDL_EventQ with the queue lock held, and it's drained before
+   anything else looks at or adds to the queue, so the order in which events
+   were pushed is preserved.
+
+   Producers count themselves in before checking that the ring is active, so
+   once SDL_StopEventLoop() has cleared the flag and seen the count drop to
+   zero, nothing else can be published and the ring can be emptied and reset.
+ */
+#define SDL_EVENT_RING_SIZE 256 // must be a power of two
+#define SDL_EVENT_RING_MASK (SDL_EVENT_RING_SIZE - 1)
+
+typedef struct SDL_EventRingSlot
+{
+    SDL_AtomicInt sequence;
+    SDL_TemporaryMemory *memory;
+    SDL_Event event;
+} SDL_EventRingSlot;
+
+static struct
+{
+    SDL_AtomicInt active;
+    SDL_AtomicInt producers; // threads between checking active and publishing their slot
+    SDL_AtomicInt enqueue_pos;
+    int dequeue_pos; // only used with the queue lock held
+    SDL_EventRingSlot slots[SDL_EVENT_RING_SIZE];
+} SDL_EventRing;
+
+
+static void SDL_ReleaseTemporaryArena(SDL_TemporaryArena *arena)
+{
+    if (SDL_AtomicDecRef(&arena->refcount)) {
+        SDL_DestroyMemoryArena(arena->arena);
+        SDL_free(arena);
+    }
+}
+
+// Called when none of this thread's own allocations are in use anymore
+static void SDL_RecycleTemporaryArena(SDL_TemporaryMemoryState *state)
+{
+    SDL_TemporaryArena *arena = state->arena;
 
+    if (!arena || state->allocated_bytes == 0) {
+        return;
+    }
+
+    if (SDL_GetAtomicInt(&arena->refcount) == 1) {
+        // Nothing refers to the memory anymore, start over from the beginning
+        SDL_ResetMemoryArena(arena->arena);
+        state->allocated_bytes = 0;
+    } else if (state->allocated_bytes >= SDL_TEMPORARY_ARENA_RETIRE_SIZE) {
+        // Events still use some of it, leave it to them rather than letting it grow
+        SDL_ReleaseTemporaryArena(arena);
+        state->arena = NULL;
+        state->allocated_bytes = 0;
+    }
+}
 
 static void SDL_CleanupTemporaryMemory(void *data)
 {
     SDL_TemporaryMemoryState *state = (SDL_TemporaryMemoryState *)data;
 
     SDL_FreeTemporaryMemory();
+    if (state->arena) {
+        SDL_ReleaseTemporaryArena(state->arena);
+    }
     SDL_free(state);
 }
 
@@ -184,7 +308,7 @@ static SDL_TemporaryMemory *SDL_GetTemporaryMemoryEntry(SDL_TemporaryMemoryState
 
     // Start from the end, it's likely to have been recently allocated
     for (entry = state->tail; entry; entry = entry->prev) {
-        if (mem == entry->memory) {
+        if (mem == SDL_TEMPORARY_MEMORY_DATA(entry)) {
             return entry;
         }
     }
@@ -224,14 +348,6 @@ static void SDL_UnlinkTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_
     entry->next = NULL;
 }
 
-static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_TemporaryMemory *entry, bool free_data)
-{
-    if (free_data) {
-        SDL_free(entry->memory);
-    }
-    SDL_free(entry);
-}
-
 static void SDL_LinkTemporaryMemoryToEvent(SDL_EventEntry *event, const void *mem)
 {
     SDL_TemporaryMemoryState *state;
@@ -245,6 +361,11 @@ static void SDL_LinkTemporaryMemoryToEvent(SDL_EventEntry *event, const void *me
     entry = SDL_GetTemporaryMemoryEntry(state, mem);
     if (entry) {
         SDL_UnlinkTemporaryMemoryEntry(state, entry);
+        if (!entry->referenced) {
+            SDL_AtomicIncRef(&entry->owner->refcount);
+            entry->referenced = true;
+            --state->num_allocated;
+        }
         entry->next = event->memory;
         event->memory = entry;
     }
@@ -316,59 +437,59 @@ static void SDL_TransferTemporaryMemoryFromEvent(SDL_EventEntry *event)
     event->memory = NULL;
 }
 
-static void *SDL_FreeLater(void *memory)
+void *SDL_AllocateTemporaryMemory(size_t size)
 {
     SDL_TemporaryMemoryState *state;
+    SDL_TemporaryMemory *entry;
 
-    if (memory == NULL) {
+    state = SDL_GetTemporaryMemoryState(true);
+    if (!state) {
         return NULL;
     }
 
-    // Make sure we're not adding this to the list twice
-    //SDL_assert(!SDL_ClaimTemporaryMemory(memory));
-
-    state = SDL_GetTemporaryMemoryState(true);
-    if (!state) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed.
+    if (state->num_allocated == 0) {
+        SDL_RecycleTemporaryArena(state);
+    }
+    if (!state->arena) {
+        SDL_TemporaryArena *arena = (SDL_TemporaryArena *)SDL_malloc(sizeof(*arena));
+        if (!arena) {
+            return NULL;
+        }
+        arena->arena = SDL_CreateMemoryArena(SDL_TEMPORARY_ARENA_BLOCK_SIZE);
+        if (!arena->arena) {
+            SDL_free(arena);
+            return NULL;
+        }
+        SDL_SetAtomicInt(&arena->refcount, 1);
+        state->arena = arena;
     }
 
-    SDL_TemporaryMemory *entry = (SDL_TemporaryMemory *)SDL_malloc(sizeof(*entry));
+    if (size > SDL_SIZE_MAX - SDL_TEMPORARY_MEMORY_HEADER_SIZE) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    entry = (SDL_TemporaryMemory *)SDL_AllocateArenaMemory(state->arena->arena, SDL_TEMPORARY_MEMORY_HEADER_SIZE + size);
     if (!entry) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed. We could probably pool up and reuse entries, though.
+        return NULL;
     }
-
-    entry->memory = memory;
-
+    entry->owner = state->arena;
+    entry->referenced = false;
     SDL_LinkTemporaryMemoryEntry(state, entry);
+    ++state->num_allocated;
+    state->allocated_bytes += SDL_TEMPORARY_MEMORY_HEADER_SIZE + size;
 
-    return memory;
-}
-
-void *SDL_AllocateTemporaryMemory(size_t size)
-{
-    return SDL_FreeLater(SDL_malloc(size));
+    return SDL_TEMPORARY_MEMORY_DATA(entry);
 }
 
 const char *SDL_CreateTemporaryString(const char *string)
 {
     if (string) {
-        return (const char *)SDL_FreeLater(SDL_strdup(string));
-    }
-    return NULL;
-}
-
-void *SDL_ClaimTemporaryMemory(const void *mem)
-{
-    SDL_TemporaryMemoryState *state;
-
-    state = SDL_GetTemporaryMemoryState(false);
-    if (state && mem) {
-        SDL_TemporaryMemory *entry = SDL_GetTemporaryMemoryEntry(state, mem);
-        if (entry) {
-            SDL_UnlinkTemporaryMemoryEntry(state, entry);
-            SDL_FreeTemporaryMemoryEntry(state, entry, false);
-            return (void *)mem;
+        const size_t len = SDL_strlen(string) + 1;
+        char *copy = (char *)SDL_AllocateTemporaryMemory(len);
+        if (copy) {
+            SDL_memcpy(copy, string, len);
         }
+        return copy;
     }
     return NULL;
 }
@@ -376,18 +497,25 @@ void *SDL_ClaimTemporaryMemory(const void *mem)
 void SDL_FreeTemporaryMemory(void)
 {
     SDL_TemporaryMemoryState *state;
+    SDL_TemporaryMemory *entry, *next;
 
     state = SDL_GetTemporaryMemoryState(false);
     if (!state) {
         return;
     }
 
-    while (state->head) {
-        SDL_TemporaryMemory *entry = state->head;
-
-        SDL_UnlinkTemporaryMemoryEntry(state, entry);
-        SDL_FreeTemporaryMemoryEntry(state, entry, true);
+    // This thread's own allocations go away with the arena, memory from events releases its reference
+    for (entry = state->head; entry; entry = next) {
+        next = entry->next;
+        if (entry->referenced) {
+            SDL_ReleaseTemporaryArena(entry->owner);
+        }
     }
+    state->head = NULL;
+    state->tail = NULL;
+    state->num_allocated = 0;
+
+    SDL_RecycleTemporaryArena(state);
 }
 
 #ifndef SDL_JOYSTICK_DISABLED
@@ -913,6 +1041,350 @@ static void SDL_LogEvent(const SDL_Event *event)
     }
 }
 
+// Get an entry for a new event -- called with the queue locked
+static SDL_EventEntry *SDL_AllocateEventEntry(void)
+{
+    SDL_EventEntry *entry;
+
+    if (SDL_EventQ.free == NULL) {
+        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
+    } else {
+        entry = SDL_EventQ.free;
+        SDL_EventQ.free = entry->next;
+    }
+    return entry;
+}
+
+// Link an event at the end of the queue -- called with the queue locked and the count already updated
+static void SDL_AppendEventEntry(SDL_EventEntry *entry)
+{
+    const int final_count = SDL_GetAtomicInt(&SDL_EventQ.count);
+    const Uint32 type = entry->event.type;
+    SDL_EventBucket *bucket;
+
+    entry->serial = SDL_EventQ.serial++;
+    entry->category = SDL_GetEventCategory(type);
+
+    if (SDL_EventQ.tail) {
+        SDL_EventQ.tail->next = entry;
+        entry->prev = SDL_EventQ.tail;
+        SDL_EventQ.tail = entry;
+        entry->next = NULL;
+    } else {
+        SDL_assert(!SDL_EventQ.head);
+        SDL_EventQ.head = entry;
+        SDL_EventQ.tail = entry;
+        entry->prev = NULL;
+        entry->next = NULL;
+    }
+
+    bucket = &SDL_EventQ.buckets[entry->category];
+    if (bucket->tail) {
+        bucket->tail->category_next = entry;
+        entry->category_prev = bucket->tail;
+        bucket->tail = entry;
+        bucket->min_type = SDL_min(bucket->min_type, type);
+        bucket->max_type = SDL_max(bucket->max_type, type);
+    } else {
+        bucket->head = entry;
+        bucket->tail = entry;
+        entry->category_prev = NULL;
+        bucket->min_type = type;
+        bucket->max_type = type;
+    }
+    entry->category_next = NULL;
+
+    if (final_count > SDL_EventQ.max_events_seen) {
+        SDL_EventQ.max_events_seen = final_count;
+    }
+
+    ++SDL_last_event_id;
+}
+
+static bool SDL_EventMatches(const SDL_EventMatch *match, Uint32 type)
+{
+    int i;
+
+    if (type < match->minType || type > match->maxType) {
+        return false;
+    }
+    if (!match->types) {
+        return true;
+    }
+    for (i = 0; i < match->numtypes; ++i) {
+        if (match->types[i] == type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Could any event queued in this bucket match? -- called with the queue locked
+static bool SDL_EventBucketMayMatch(const SDL_EventBucket *bucket, const SDL_EventMatch *match)
+{
+    int i;
+
+    if (!bucket->head || bucket->max_type < match->minType || bucket->min_type > match->maxType) {
+        return false;
+    }
+    if (!match->types) {
+        return true;
+    }
+    for (i = 0; i < match->numtypes; ++i) {
+        if (bucket->min_type <= match->types[i] && match->types[i] <= bucket->max_type) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Start walking matching events -- called with the queue locked
+static void SDL_StartEventIterator(SDL_EventIterator *it, const SDL_EventMatch *match)
+{
+    int i;
+
+    it->match = match;
+    it->whole_queue = true;
+    it->num_cursors = 0;
+
+    for (i = 0; i < SDL_arraysize(SDL_EventQ.buckets); ++i) {
+        const SDL_EventBucket *bucket = &SDL_EventQ.buckets[i];
+
+        if (!bucket->head) {
+            continue;
+        }
+        if (!SDL_EventBucketMayMatch(bucket, match)) {
+            it->whole_queue = false;
+            continue;
+        }
+        if (match->types || bucket->min_type < match->minType || bucket->max_type > match->maxType) {
+            it->whole_queue = false;
+        }
+        it->cursors[it->num_cursors++] = bucket->head;
+    }
+
+    // If every queued event matches, just walk the queue
+    it->next = it->whole_queue ? SDL_EventQ.head : NULL;
+}
+
+/* Get the next matching event -- called with the queue locked
+
+   The iterator has already moved past the returned entry, so it may be cut from the queue.
+ */
+static SDL_EventEntry *SDL_NextEventEntry(SDL_EventIterator *it)
+{
+    SDL_EventEntry *entry, *best = NULL;
+    int i, best_index = 0;
+
+    if (it->whole_queue) {
+        entry = it->next;
+        if (entry) {
+            it->next = entry->next;
+        }
+        return entry;
+    }
+
+    // Pick the oldest matching event across the buckets that might have one
+    for (i = 0; i < it->num_cursors; ++i) {
+        entry = it->cursors[i];
+        while (entry && !SDL_EventMatches(it->match, entry->event.type)) {
+            entry = entry->category_next;
+        }
+        it->cursors[i] = entry;
+
+        if (entry && (!best || entry->serial < best->serial)) {
+            best = entry;
+            best_index = i;
+        }
+    }
+    if (best) {
+        it->cursors[best_index] = best->category_next;
+    }
+    return best;
+}
+
+// Set the ring up empty -- called with the queue locked and the ring inactive
+static void SDL_ResetEventRing(void)
+{
+    int i;
+
+    for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+        SDL_SetAtomicInt(&SDL_EventRing.slots[i].sequence, i);
+        SDL_EventRing.slots[i].memory = NULL;
+    }
+    SDL_SetAtomicInt(&SDL_EventRing.enqueue_pos, 0);
+    SDL_EventRing.dequeue_pos = 0;
+}
+
+static void SDL_InitEventRing(void)
+{
+    if (SDL_GetAtomicInt(&SDL_EventRing.active)) {
+        return;
+    }
+
+    SDL_ResetEventRing();
+    SDL_SetAtomicInt(&SDL_EventRing.active, 1);
+}
+
+// Stop producers from using the ring, and wait for any that are part way through pushing
+static void SDL_DeactivateEventRing(void)
+{
+    int spins = 0;
+
+    SDL_SetAtomicInt(&SDL_EventRing.active, 0);
+    while (SDL_GetAtomicInt(&SDL_EventRing.producers) > 0) {
+        if (++spins < 64) {
+            SDL_CPUPauseInstruction();
+        } else {
+            SDL_DelayNS(0);
+        }
+    }
+}
+
+// Try to add an event to the ring without locking the queue, returns false if the caller should take the locked path
+static bool SDL_PushEventToRing(SDL_Event *event)
+{
+    SDL_EventEntry staging;
+    SDL_EventRingSlot *slot;
+    int pos, diff;
+
+    // Count ourselves in first, so SDL_StopEventLoop() either sees us or we see it
+    SDL_AddAtomicInt(&SDL_EventRing.producers, 1);
+    if (!SDL_GetAtomicInt(&SDL_EventRing.active)) {
+        SDL_AddAtomicInt(&SDL_EventRing.producers, -1);
+        return false;
+    }
+
+    // Reserve our place in the queue, so the limit holds for both paths
+    if (SDL_AddAtomicInt(&SDL_EventQ.count, 1) >= SDL_MAX_QUEUED_EVENTS) {
+        SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        SDL_AddAtomicInt(&SDL_EventRing.producers, -1);
+        return false;
+    }
+
+    pos = SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+    for (;;) {
+        slot = &SDL_EventRing.slots[pos & SDL_EVENT_RING_MASK];
+        diff = (int)((Uint32)SDL_GetAtomicInt(&slot->sequence) - (Uint32)pos);
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicInt(&SDL_EventRing.enqueue_pos, pos, (int)((Uint32)pos + 1))) {
+                break;
+            }
+            pos = SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+        } else if (diff < 0) {
+            // The ring is full, let the caller queue it directly
+            SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+            SDL_AddAtomicInt(&SDL_EventRing.producers, -1);
+            return false;
+        } else {
+            pos = SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+        }
+    }
+
+    // Claim this thread's temporary memory for the event
+    SDL_copyp(&staging.event, event);
+    staging.memory = NULL;
+    SDL_TransferTemporaryMemoryToEvent(&staging);
+
+    if (SDL_EventLoggingVerbosity > 0) {
+        SDL_LogEvent(&staging.event);
+    }
+
+    if (staging.event.type == SDL_EVENT_POLL_SENTINEL) {
+        SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
+    }
+
+    SDL_copyp(&slot->event, &staging.event);
+    slot->memory = staging.memory;
+
+    // Publish the slot to the consumer
+    SDL_SetAtomicInt(&slot->sequence, (int)((Uint32)pos + 1));
+    SDL_AddAtomicInt(&SDL_EventRing.producers, -1);
+    return true;
+}
+
+/* Move events pushed so far from the ring to the queue -- called with the queue locked
+
+   A producer may still be filling a slot it has claimed. Readers stop there and pick it up
+   next time, but anything adding to the queue directly has to wait for it, otherwise an
+   event that thread pushed through the ring earlier could end up behind the new ones.
+
+   If events is not NULL, events matching match are copied there instead of being
+   queued, up to numevents, and the rest are left in the ring once that fills up. This lets
+   SDL_PeepEvents() hand events straight to the caller while the queue is keeping up.
+ */
+static int SDL_DrainEventRing(bool wait, SDL_Event *events, int numevents, const SDL_EventMatch *match)
+{
+    SDL_EventRingSlot *slot;
+    SDL_EventEntry *entry;
+    int pos, end;
+    int used = 0;
+
+    end = SDL_GetAtomicInt(&SDL_EventRing.enqueue_pos);
+    while (SDL_EventRing.dequeue_pos != end) {
+        Uint32 type;
+
+        if (events && used == numevents) {
+            break;
+        }
+
+        pos = SDL_EventRing.dequeue_pos;
+        slot = &SDL_EventRing.slots[pos & SDL_EVENT_RING_MASK];
+
+        if (SDL_GetAtomicInt(&slot->sequence) != (int)((Uint32)pos + 1)) {
+            int spins = 0;
+
+            if (!wait) {
+                break;
+            }
+
+            // Producers never take the queue lock while holding a slot, so this is brief
+            while (SDL_GetAtomicInt(&slot->sequence) != (int)((Uint32)pos + 1)) {
+                if (++spins < 64) {
+                    SDL_CPUPauseInstruction();
+                } else {
+                    SDL_DelayNS(0);
+                }
+            }
+        }
+
+        type = slot->event.type;
+        if (type == SDL_EVENT_POLL_SENTINEL) {
+            // Sentinels need the bookkeeping in SDL_PeepEventsMatching(), and nothing may be taken past them
+            events = NULL;
+        }
+
+        entry = NULL;
+        if (!events || !SDL_EventMatches(match, type)) {
+            entry = SDL_AllocateEventEntry();
+        }
+        if (entry) {
+            SDL_copyp(&entry->event, &slot->event);
+            entry->memory = slot->memory;
+            SDL_AppendEventEntry(entry);
+        } else {
+            // Either it's going to the caller or we're out of memory and it's dropped, like SDL_CutEvent()
+            SDL_EventEntry taken;
+            SDL_copyp(&taken.event, &slot->event);
+            taken.memory = slot->memory;
+            SDL_TransferTemporaryMemoryFromEvent(&taken);
+            if (events && SDL_EventMatches(match, type)) {
+                SDL_copyp(&events[used], &taken.event);
+                ++used;
+            } else if (type == SDL_EVENT_POLL_SENTINEL) {
+                SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
+            }
+            SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        }
+        slot->memory = NULL;
+
+        // Hand the slot back to producers for the next pass around the ring
+        SDL_SetAtomicInt(&slot->sequence, (int)((Uint32)pos + SDL_EVENT_RING_SIZE));
+        SDL_EventRing.dequeue_pos = (int)((Uint32)pos + 1);
+    }
+    return used;
+}
+
 void SDL_StopEventLoop(void)
 {
     const char *report = SDL_GetHint("SDL_EVENT_QUEUE_STATISTICS");
@@ -923,6 +1395,11 @@ void SDL_StopEventLoop(void)
 
     SDL_EventQ.active = false;
 
+    // Pick up anything that was pushed without the lock, so it's cleaned up below
+    SDL_DeactivateEventRing();
+    SDL_DrainEventRing(true, NULL, 0, NULL);
+    SDL_ResetEventRing();
+
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d",
                 SDL_EventQ.max_events_seen);
@@ -946,6 +1423,7 @@ void SDL_StopEventLoop(void)
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
+    SDL_zeroa(SDL_EventQ.buckets);
     SDL_SetAtomicInt(&SDL_sentinel_pending, 0);
 
     // Clear disabled event state
@@ -997,6 +1475,8 @@ bool SDL_StartEventLoop(void)
 
     SDL_InitWindowEventWatch();
 
+    SDL_InitEventRing();
+
     SDL_EventQ.active = true;
 
 #ifndef SDL_THREADS_DISABLED
@@ -1009,22 +1489,18 @@ bool SDL_StartEventLoop(void)
 static int SDL_AddEvent(SDL_Event *event)
 {
     SDL_EventEntry *entry;
-    const int initial_count = SDL_GetAtomicInt(&SDL_EventQ.count);
-    int final_count;
+    const int initial_count = SDL_AddAtomicInt(&SDL_EventQ.count, 1);
 
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
+        SDL_AddAtomicInt(&SDL_EventQ.count, -1);
         SDL_SetError("Event queue is full (%d events)", initial_count);
         return 0;
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (entry == NULL) {
-            return 0;
-        }
-    } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
+    entry = SDL_AllocateEventEntry();
+    if (entry == NULL) {
+        SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        return 0;
     }
 
     if (SDL_EventLoggingVerbosity > 0) {
@@ -1038,25 +1514,7 @@ static int SDL_AddEvent(SDL_Event *event)
     entry->memory = NULL;
     SDL_TransferTemporaryMemoryToEvent(entry);
 
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
-    }
-
-    final_count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
-    }
-
-    ++SDL_last_event_id;
+    SDL_AppendEventEntry(entry);
 
     return 1;
 }
@@ -1082,6 +1540,20 @@ static void SDL_CutEvent(SDL_EventEntry *entry)
         SDL_EventQ.tail = entry->prev;
     }
 
+    SDL_EventBucket *bucket = &SDL_EventQ.buckets[entry->category];
+    if (entry->category_prev) {
+        entry->category_prev->category_next = entry->category_next;
+    } else {
+        SDL_assert(entry == bucket->head);
+        bucket->head = entry->category_next;
+    }
+    if (entry->category_next) {
+        entry->category_next->category_prev = entry->category_prev;
+    } else {
+        SDL_assert(entry == bucket->tail);
+        bucket->tail = entry->category_prev;
+    }
+
     if (entry->event.type == SDL_EVENT_POLL_SENTINEL) {
         SDL_AddAtomicInt(&SDL_sentinel_pending, -1);
     }
@@ -1116,8 +1588,8 @@ static void SDL_SendWakeupEvent(void)
 }
 
 // Lock the event queue, take a peep at it, and unlock it
-static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAction action,
-                                  Uint32 minType, Uint32 maxType, bool include_sentinel)
+static int SDL_PeepEventsMatching(SDL_Event *events, int numevents, SDL_EventAction action,
+                                  const SDL_EventMatch *match, bool include_sentinel)
 {
     int i, used, sentinels_expected = 0;
 
@@ -1140,40 +1612,49 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
                 SDL_UnlockMutex(SDL_EventQ.lock);
                 return SDL_InvalidParamError("events");
             }
+            SDL_DrainEventRing(true, NULL, 0, NULL);
             for (i = 0; i < numevents; ++i) {
                 used += SDL_AddEvent(&events[i]);
             }
         } else {
-            SDL_EventEntry *entry, *next;
+            SDL_EventIterator it;
+            SDL_EventEntry *entry;
             Uint32 type;
+            const bool take_from_ring = (events && action == SDL_GETEVENT && SDL_GetAtomicInt(&SDL_sentinel_pending) == 0);
+
+            if (!take_from_ring) {
+                SDL_DrainEventRing(false, NULL, 0, NULL);
+            }
 
-            for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
-                next = entry->next;
+            SDL_StartEventIterator(&it, match);
+            while ((events == NULL || used < numevents) && (entry = SDL_NextEventEntry(&it)) != NULL) {
                 type = entry->event.type;
-                if (minType <= type && type <= maxType) {
-                    if (events) {
-                        SDL_copyp(&events[used], &entry->event);
+                if (events) {
+                    SDL_copyp(&events[used], &entry->event);
 
-                        if (action == SDL_GETEVENT) {
-                            SDL_CutEvent(entry);
-                        }
+                    if (action == SDL_GETEVENT) {
+                        SDL_CutEvent(entry);
+                    }
+                }
+                if (type == SDL_EVENT_POLL_SENTINEL) {
+                    // Special handling for the sentinel event
+                    if (!include_sentinel) {
+                        // Skip it, we don't want to include it
+                        continue;
                     }
-                    if (type == SDL_EVENT_POLL_SENTINEL) {
-                        // Special handling for the sentinel event
-                        if (!include_sentinel) {
-                            // Skip it, we don't want to include it
-                            continue;
-                        }
-                        if (events == NULL || action != SDL_GETEVENT) {
-                            ++sentinels_expected;
-                        }
-                        if (SDL_GetAtomicInt(&SDL_sentinel_pending) > sentinels_expected) {
-                            // Skip it, there's another one pending
-                            continue;
-                        }
+                    if (events == NULL || action != SDL_GETEVENT) {
+                        ++sentinels_expected;
+                    }
+                    if (SDL_GetAtomicInt(&SDL_sentinel_pending) > sentinels_expected) {
+                        // Skip it, there's another one pending
+                        continue;
                     }
-                    ++used;
                 }
+                ++used;
+            }
+
+            if (take_from_ring && used < numevents) {
+                used += SDL_DrainEventRing(false, &events[used], numevents - used, match);
             }
         }
     }
@@ -1185,12 +1666,58 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
 
     return used;
 }
+
+static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAction action,
+                                  Uint32 minType, Uint32 maxType, bool include_sentinel)
+{
+    SDL_EventMatch match;
+
+    match.minType = minType;
+    match.maxType = maxType;
+    match.types = NULL;
+    match.numtypes = 0;
+    return SDL_PeepEventsMatching(events, numevents, action, &match, include_sentinel);
+}
+
 int SDL_PeepEvents(SDL_Event *events, int numevents, SDL_EventAction action,
                    Uint32 minType, Uint32 maxType)
 {
     return SDL_PeepEventsInternal(events, numevents, action, minType, maxType, false);
 }
 
+int SDL_GetEventsByType(SDL_Event *events, int numevents, const Uint32 *types, int numtypes)
+{
+    SDL_EventMatch match;
+    int i;
+
+    if (!events) {
+        SDL_InvalidParamError("events");
+        return -1;
+    }
+    if (numevents < 0) {
+        SDL_InvalidParamError("numevents");
+        return -1;
+    }
+    if (!types) {
+        SDL_InvalidParamError("types");
+        return -1;
+    }
+    if (numtypes <= 0) {
+        SDL_InvalidParamError("numtypes");
+        return -1;
+    }
+
+    match.minType = types[0];
+    match.maxType = types[0];
+    for (i = 1; i < numtypes; ++i) {
+        match.minType = SDL_min(match.minType, types[i]);
+        match.maxType = SDL_max(match.maxType, types[i]);
+    }
+    match.types = types;
+    match.numtypes = numtypes;
+    return SDL_PeepEventsMatching(events, numevents, SDL_GETEVENT, &match, false);
+}
+
 bool SDL_HasEvent(Uint32 type)
 {
     return SDL_HasEvents(type, type);
@@ -1203,13 +1730,17 @@ bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         if (SDL_EventQ.active) {
-            for (SDL_EventEntry *entry = SDL_EventQ.head; entry; entry = entry->next) {
-                const Uint32 type = entry->event.type;
-                if (minType <= type && type <= maxType) {
-                    found = true;
-                    break;
-                }
-            }
+            SDL_EventMatch match;
+            SDL_EventIterator it;
+
+            match.minType = minType;
+            match.maxType = maxType;
+            match.types = NULL;
+            match.numtypes = 0;
+
+            SDL_DrainEventRing(false, NULL, 0, NULL);
+            SDL_StartEventIterator(&it, &match);
+            found = (SDL_NextEventEntry(&it) != NULL);
         }
     }
     SDL_UnlockMutex(SDL_EventQ.lock);
@@ -1224,8 +1755,9 @@ void SDL_FlushEvent(Uint32 type)
 
 void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
 {
-    SDL_EventEntry *entry, *next;
-    Uint32 type;
+    SDL_EventMatch match;
+    SDL_EventIterator it;
+    SDL_EventEntry *entry;
 
     // Make sure the events are current
 #if 0
@@ -1243,12 +1775,15 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
-        for (entry = SDL_EventQ.head; entry; entry = next) {
-            next = entry->next;
-            type = entry->event.type;
-            if (minType <= type && type <= maxType) {
-                SDL_CutEvent(entry);
-            }
+        match.minType = minType;
+        match.maxType = maxType;
+        match.types = NULL;
+        match.numtypes = 0;
+
+        SDL_DrainEventRing(false, NULL, 0, NULL);
+        SDL_StartEventIterator(&it, &match);
+        while ((entry = SDL_NextEventEntry(&it)) != NULL) {
+            SDL_CutEvent(entry);
         }
     }
     SDL_UnlockMutex(SDL_EventQ.lock);
@@ -1764,6 +2299,11 @@ bool SDL_PushEvent(SDL_Event *event)
         return false;
     }
 
+    if (SDL_PushEventToRing(event)) {
+        SDL_SendWakeupEvent();
+        return true;
+    }
+
     if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
         return false;
     }
@@ -1783,6 +2323,7 @@ void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
             // Cut all events not accepted by the filter
             SDL_LockMutex(SDL_EventQ.lock);
             {
+                SDL_DrainEventRing(false, NULL, 0, NULL);
                 for (event = SDL_EventQ.head; event; event = next) {
                     next = event->next;
                     if (!filter(userdata, &event->event)) {
@@ -1830,6 +2371,7 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing(false, NULL, 0, NULL);
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -62,6 +62,7 @@ typedef struct SDL_Keyboard
     bool autorelease_pending;
     Uint64 hardware_timestamp;
     int next_reserved_scancode;
+    SDL_HintCache alt_tab_hint;
 } SDL_Keyboard;
 
 static SDL_Keyboard SDL_keyboard;
@@ -656,7 +657,7 @@ static bool SDL_SendKeyboardKeyInternal(Uint64 timestamp, Uint32 flags, SDL_Keyb
         keyboard->focus &&
         (keyboard->focus->flags & SDL_WINDOW_KEYBOARD_GRABBED) &&
         (keyboard->focus->flags & SDL_WINDOW_FULLSCREEN) &&
-        SDL_GetHintBoolean(SDL_HINT_ALLOW_ALT_TAB_WHILE_GRABBED, true)) {
+        SDL_GetCachedHintBoolean(SDL_HINT_ALLOW_ALT_TAB_WHILE_GRABBED, true, &keyboard->alt_tab_hint)) {
         /* We will temporarily forfeit our grab by minimizing our window,
            allowing the user to escape the application */
         SDL_MinimizeWindow(keyboard->focus);
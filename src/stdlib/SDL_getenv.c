@@ -21,6 +21,7 @@
 #include "SDL_internal.h"
 
 #include "SDL_getenv_c.h"
+#include "../SDL_hints_c.h"
 
 #if defined(SDL_PLATFORM_WINDOWS)
 #include "../core/windows/SDL_windows.h"
@@ -266,6 +267,10 @@ bool SDL_SetEnvironmentVariable(SDL_Environment *env, const char *name, const ch
             name = string;
             value = string + len + 1;
             result = SDL_InsertIntoHashTable(env->strings, name, value, overwrite);
+            if (result && env == SDL_environment) {
+                // Hints can come from the environment
+                SDL_ChangedHints();
+            }
             if (!result) {
                 SDL_free(string);
                 if (!overwrite) {
@@ -298,6 +303,9 @@ bool SDL_UnsetEnvironmentVariable(SDL_Environment *env, const char *name)
         const void *value;
         if (SDL_FindInHashTable(env->strings, name, &value)) {
             result = SDL_RemoveFromHashTable(env->strings, name);
+            if (result && env == SDL_environment) {
+                SDL_ChangedHints();
+            }
         } else {
             result = true;
         }
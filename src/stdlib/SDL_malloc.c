@@ -6335,6 +6335,302 @@ static void   SDLCALL real_free(void *p) { free(p); }
 #define real_free dlfree
 #endif
 
+/* An optional cache of small blocks in front of the original allocator.
+   Every block has a header with its size class, so it can be reallocated
+   or freed on any thread. Freed blocks go on a list for their size class
+   belonging to the thread that freed them, and when a list gets long, a
+   batch of blocks moves to a shared depot that other threads refill
+   their lists from. The allocator's own lock is only taken when a thread
+   needs a block and the depot is empty, or frees one and the depot is full.
+   This needs compiler support for thread-local variables, since SDL's own
+   thread-local storage allocates memory. */
+#if defined(SDL_THREAD_PTHREAD) || defined(SDL_THREAD_WINDOWS)
+#ifdef _MSC_VER
+#define SDL_MALLOC_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define SDL_MALLOC_THREAD_LOCAL __thread
+#endif
+#endif
+
+#ifdef SDL_MALLOC_THREAD_LOCAL
+
+#define CACHE_HEADER_SIZE       16  // keeps blocks aligned like malloc() does
+#define CACHE_NUM_CLASSES       12
+#define CACHE_BATCH_SIZE        32  // blocks moved between a thread and the depot at a time
+#define CACHE_MAX_DEPOT_BATCHES 64  // batches the depot keeps for each size class
+
+static const size_t cache_class_sizes[CACHE_NUM_CLASSES] = {
+    16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024
+};
+
+typedef struct CacheBlock
+{
+    struct CacheBlock *next;
+    struct CacheBlock *next_batch;  // only used by the first block of a batch in the depot
+} CacheBlock;
+
+typedef struct CacheList
+{
+    CacheBlock *head;
+    int count;
+} CacheList;
+
+typedef struct CacheDepot
+{
+    SDL_SpinLock lock;
+    int num_batches;
+    CacheBlock *batches;
+    char padding[64 - sizeof(SDL_SpinLock) - sizeof(int) - sizeof(CacheBlock *)];  // keep the classes apart in memory, so their locks don't contend
+} CacheDepot;
+
+static SDL_MALLOC_THREAD_LOCAL CacheList cache_lists[CACHE_NUM_CLASSES];
+static CacheDepot cache_depot[CACHE_NUM_CLASSES];
+
+// Returns CACHE_NUM_CLASSES if the size is too big to be cached
+static int GetCacheSizeClass(size_t size)
+{
+    Uint32 bits;
+
+    if (size <= 64) {
+        return size ? (int)((size - 1) >> 4) : 0;
+    }
+    if (size > cache_class_sizes[CACHE_NUM_CLASSES - 1]) {
+        return CACHE_NUM_CLASSES;
+    }
+
+    // Above 64 bytes there are two classes for each power of two, at 1.5x and 2x
+    size -= 1;
+    bits = (Uint32)SDL_MostSignificantBitIndex32((Uint32)size);
+    return 4 + 2 * (int)(bits - 6) + (int)((size >> (bits - 1)) & 1);
+}
+
+static int GetBlockSizeClass(void *ptr)
+{
+    return *(int *)((Uint8 *)ptr - CACHE_HEADER_SIZE);
+}
+
+static void *AllocateCacheBlock(size_t size, int size_class)
+{
+    Uint8 *mem = (Uint8 *)real_malloc(CACHE_HEADER_SIZE + size);
+    if (!mem) {
+        return NULL;
+    }
+    *(int *)mem = size_class;
+    return mem + CACHE_HEADER_SIZE;
+}
+
+static void FreeCacheBlock(void *ptr)
+{
+    real_free((Uint8 *)ptr - CACHE_HEADER_SIZE);
+}
+
+// Moves a batch of blocks from the start of the list to the depot
+static void FlushCacheList(int size_class, CacheList *list)
+{
+    CacheDepot *depot = &cache_depot[size_class];
+    CacheBlock *batch = list->head;
+    CacheBlock *tail = batch;
+    int i;
+
+    for (i = 1; i < CACHE_BATCH_SIZE; ++i) {
+        tail = tail->next;
+    }
+    list->head = tail->next;
+    list->count -= CACHE_BATCH_SIZE;
+    tail->next = NULL;
+
+    SDL_LockSpinlock(&depot->lock);
+    if (depot->num_batches < CACHE_MAX_DEPOT_BATCHES) {
+        batch->next_batch = depot->batches;
+        depot->batches = batch;
+        ++depot->num_batches;
+        batch = NULL;
+    }
+    SDL_UnlockSpinlock(&depot->lock);
+
+    // The depot is full, give the batch back to the allocator
+    while (batch) {
+        CacheBlock *next = batch->next;
+        FreeCacheBlock(batch);
+        batch = next;
+    }
+}
+
+static void RefillCacheList(int size_class, CacheList *list)
+{
+    CacheDepot *depot = &cache_depot[size_class];
+    CacheBlock *batch;
+
+    SDL_LockSpinlock(&depot->lock);
+    batch = depot->batches;
+    if (batch) {
+        depot->batches = batch->next_batch;
+        --depot->num_batches;
+    }
+    SDL_UnlockSpinlock(&depot->lock);
+
+    if (batch) {
+        list->head = batch;
+        list->count = CACHE_BATCH_SIZE;
+    }
+}
+
+static void * SDLCALL cache_malloc(size_t size)
+{
+    const int size_class = GetCacheSizeClass(size);
+
+    if (size_class < CACHE_NUM_CLASSES) {
+        CacheList *list = &cache_lists[size_class];
+        CacheBlock *block;
+
+        if (!list->head) {
+            RefillCacheList(size_class, list);
+            if (!list->head) {
+                return AllocateCacheBlock(cache_class_sizes[size_class], size_class);
+            }
+        }
+        block = list->head;
+        list->head = block->next;
+        --list->count;
+        return block;
+    }
+
+    if (size > SDL_SIZE_MAX - CACHE_HEADER_SIZE) {
+        return NULL;
+    }
+    return AllocateCacheBlock(size, CACHE_NUM_CLASSES);
+}
+
+static void * SDLCALL cache_calloc(size_t nmemb, size_t size)
+{
+    Uint8 *mem;
+
+    if (!SDL_size_mul_check_overflow(nmemb, size, &size)) {
+        return NULL;
+    }
+
+    if (GetCacheSizeClass(size) < CACHE_NUM_CLASSES) {
+        mem = (Uint8 *)cache_malloc(size);
+        if (mem) {
+            SDL_memset(mem, 0, size);
+        }
+        return mem;
+    }
+
+    if (size > SDL_SIZE_MAX - CACHE_HEADER_SIZE) {
+        return NULL;
+    }
+    mem = (Uint8 *)real_calloc(1, CACHE_HEADER_SIZE + size);
+    if (!mem) {
+        return NULL;
+    }
+    *(int *)mem = CACHE_NUM_CLASSES;
+    return mem + CACHE_HEADER_SIZE;
+}
+
+static void SDLCALL cache_free(void *ptr)
+{
+    CacheList *list;
+    CacheBlock *block;
+    int size_class;
+
+    if (!ptr) {
+        return;
+    }
+
+    size_class = GetBlockSizeClass(ptr);
+    if (size_class == CACHE_NUM_CLASSES) {
+        FreeCacheBlock(ptr);
+        return;
+    }
+
+    list = &cache_lists[size_class];
+    block = (CacheBlock *)ptr;
+    block->next = list->head;
+    list->head = block;
+    if (++list->count >= 2 * CACHE_BATCH_SIZE) {
+        FlushCacheList(size_class, list);
+    }
+}
+
+static void * SDLCALL cache_realloc(void *ptr, size_t size)
+{
+    Uint8 *mem;
+    int size_class;
+
+    if (!ptr) {
+        return cache_malloc(size);
+    }
+
+    size_class = GetBlockSizeClass(ptr);
+    if (size_class < CACHE_NUM_CLASSES) {
+        // Small blocks stay where they are until they outgrow their class
+        if (size <= cache_class_sizes[size_class]) {
+            return ptr;
+        }
+        mem = (Uint8 *)cache_malloc(size);
+        if (mem) {
+            SDL_memcpy(mem, ptr, cache_class_sizes[size_class]);
+            cache_free(ptr);
+        }
+        return mem;
+    }
+
+    // Large blocks stay large, even if they shrink
+    if (size > SDL_SIZE_MAX - CACHE_HEADER_SIZE) {
+        return NULL;
+    }
+    mem = (Uint8 *)real_realloc((Uint8 *)ptr - CACHE_HEADER_SIZE, CACHE_HEADER_SIZE + size);
+    if (!mem) {
+        return NULL;
+    }
+    return mem + CACHE_HEADER_SIZE;
+}
+
+void SDL_FlushThreadMemoryCache(void)
+{
+    int size_class;
+
+    for (size_class = 0; size_class < CACHE_NUM_CLASSES; ++size_class) {
+        CacheList *list = &cache_lists[size_class];
+
+        while (list->count >= CACHE_BATCH_SIZE) {
+            FlushCacheList(size_class, list);
+        }
+        while (list->head) {
+            CacheBlock *next = list->head->next;
+            FreeCacheBlock(list->head);
+            list->head = next;
+        }
+        list->count = 0;
+    }
+}
+
+#else
+
+#define cache_malloc real_malloc
+#define cache_calloc real_calloc
+#define cache_realloc real_realloc
+#define cache_free real_free
+
+void SDL_FlushThreadMemoryCache(void)
+{
+}
+
+#endif // SDL_MALLOC_THREAD_LOCAL
+
+#ifdef SDL_MALLOC_THREAD_CACHE
+#define default_malloc cache_malloc
+#define default_calloc cache_calloc
+#define default_realloc cache_realloc
+#define default_free cache_free
+#else
+#define default_malloc real_malloc
+#define default_calloc real_calloc
+#define default_realloc real_realloc
+#define default_free real_free
+#endif
+
 // mark the allocator entry points as KEEPALIVE so we can call these from JavaScript.
 // otherwise they could could get so aggressively inlined that their symbols
 // don't exist at all in the final binary!
@@ -6355,7 +6651,7 @@ static struct
     SDL_free_func free_func;
     SDL_AtomicInt num_allocations;
 } s_mem = {
-    real_malloc, real_calloc, real_realloc, real_free, { 0 }
+    default_malloc, default_calloc, default_realloc, default_free, { 0 }
 };
 
 // Define this if you want to track the number of allocations active
@@ -6375,16 +6671,35 @@ void SDL_GetOriginalMemoryFunctions(SDL_malloc_func *malloc_func,
                                     SDL_free_func *free_func)
 {
     if (malloc_func) {
-        *malloc_func = real_malloc;
+        *malloc_func = default_malloc;
+    }
+    if (calloc_func) {
+        *calloc_func = default_calloc;
+    }
+    if (realloc_func) {
+        *realloc_func = default_realloc;
+    }
+    if (free_func) {
+        *free_func = default_free;
+    }
+}
+
+void SDL_GetThreadCacheMemoryFunctions(SDL_malloc_func *malloc_func,
+                                       SDL_calloc_func *calloc_func,
+                                       SDL_realloc_func *realloc_func,
+                                       SDL_free_func *free_func)
+{
+    if (malloc_func) {
+        *malloc_func = cache_malloc;
     }
     if (calloc_func) {
-        *calloc_func = real_calloc;
+        *calloc_func = cache_calloc;
     }
     if (realloc_func) {
-        *realloc_func = real_realloc;
+        *realloc_func = cache_realloc;
     }
     if (free_func) {
-        *free_func = real_free;
+        *free_func = cache_free;
     }
 }
 
@@ -6441,7 +6756,174 @@ int SDL_GetNumAllocations(void)
 #endif
 }
 
-void *SDL_malloc(size_t size)
+/* Optional memory statistics. When they're enabled, every allocation gets a
+   header with its size and tag, so freeing it can take it off the right
+   counters. */
+#define STATS_HEADER_SIZE 16
+
+typedef struct SDL_MemoryStatsHeader
+{
+    size_t size;
+    SDL_MemoryTag tag;
+} SDL_MemoryStatsHeader;
+
+SDL_COMPILE_TIME_ASSERT(memory_stats_header, sizeof(SDL_MemoryStatsHeader) <= STATS_HEADER_SIZE);
+
+// Whether allocations get a header. This only ever moves away from UNDECIDED, and only once.
+#define STATS_UNDECIDED 0
+#define STATS_DISABLED  1
+#define STATS_ENABLED   2
+
+static struct
+{
+    SDL_AtomicInt state;
+    SDL_SpinLock lock;
+    SDL_MemoryStats stats[SDL_MEMORY_TAG_COUNT];
+} s_stats;
+
+/* Statistics can't be enabled once there's memory without a header, so the
+   first allocation without statistics settles it, unless
+   SDL_EnableMemoryStats() gets there first. */
+static bool SDL_MemoryStatsEnabled(void)
+{
+    int state = SDL_GetAtomicInt(&s_stats.state);
+
+    while (state == STATS_UNDECIDED) {
+        if (SDL_CompareAndSwapAtomicInt(&s_stats.state, STATS_UNDECIDED, STATS_DISABLED)) {
+            return false;
+        }
+        state = SDL_GetAtomicInt(&s_stats.state);
+    }
+    return (state == STATS_ENABLED);
+}
+
+#define STATS_HEADER(mem) ((SDL_MemoryStatsHeader *)((Uint8 *)(mem) - STATS_HEADER_SIZE))
+
+static void SDL_AddToMemoryStats(SDL_MemoryStats *stats, size_t size)
+{
+    stats->live_bytes += size;
+    stats->live_allocations++;
+    stats->total_allocations++;
+    if (stats->live_bytes > stats->peak_bytes) {
+        stats->peak_bytes = stats->live_bytes;
+    }
+}
+
+static void SDL_RemoveFromMemoryStats(SDL_MemoryStats *stats, size_t size)
+{
+    stats->live_bytes -= size;
+    stats->live_allocations--;
+}
+
+static void *SDL_MallocWithStats(size_t size, SDL_MemoryTag tag, bool clear)
+{
+    SDL_MemoryStatsHeader *header;
+
+    if (size > SDL_SIZE_MAX - STATS_HEADER_SIZE) {
+        return NULL;
+    }
+
+    if (clear) {
+        header = (SDL_MemoryStatsHeader *)s_mem.calloc_func(1, STATS_HEADER_SIZE + size);
+    } else {
+        header = (SDL_MemoryStatsHeader *)s_mem.malloc_func(STATS_HEADER_SIZE + size);
+    }
+    if (!header) {
+        return NULL;
+    }
+    header->size = size;
+    header->tag = tag;
+
+    SDL_LockSpinlock(&s_stats.lock);
+    SDL_AddToMemoryStats(&s_stats.stats[SDL_MEMORY_TAG_ALL], size);
+    SDL_AddToMemoryStats(&s_stats.stats[tag], size);
+    SDL_UnlockSpinlock(&s_stats.lock);
+
+    return (Uint8 *)header + STATS_HEADER_SIZE;
+}
+
+// The memory is counted under the tag of whoever reallocated it last
+static void *SDL_ReallocWithStats(void *ptr, size_t size, SDL_MemoryTag tag)
+{
+    SDL_MemoryStatsHeader *header = STATS_HEADER(ptr);
+    const size_t old_size = header->size;
+    const SDL_MemoryTag old_tag = header->tag;
+
+    if (size > SDL_SIZE_MAX - STATS_HEADER_SIZE) {
+        return NULL;
+    }
+
+    header = (SDL_MemoryStatsHeader *)s_mem.realloc_func(header, STATS_HEADER_SIZE + size);
+    if (!header) {
+        return NULL;
+    }
+    header->size = size;
+    header->tag = tag;
+
+    SDL_LockSpinlock(&s_stats.lock);
+    SDL_RemoveFromMemoryStats(&s_stats.stats[SDL_MEMORY_TAG_ALL], old_size);
+    SDL_RemoveFromMemoryStats(&s_stats.stats[old_tag], old_size);
+    SDL_AddToMemoryStats(&s_stats.stats[SDL_MEMORY_TAG_ALL], size);
+    SDL_AddToMemoryStats(&s_stats.stats[tag], size);
+    SDL_UnlockSpinlock(&s_stats.lock);
+
+    return (Uint8 *)header + STATS_HEADER_SIZE;
+}
+
+static void *SDL_FreeWithStats(void *ptr)
+{
+    SDL_MemoryStatsHeader *header = STATS_HEADER(ptr);
+
+    SDL_LockSpinlock(&s_stats.lock);
+    SDL_RemoveFromMemoryStats(&s_stats.stats[SDL_MEMORY_TAG_ALL], header->size);
+    SDL_RemoveFromMemoryStats(&s_stats.stats[header->tag], header->size);
+    SDL_UnlockSpinlock(&s_stats.lock);
+
+    return header;
+}
+
+bool SDL_EnableMemoryStats(void)
+{
+    if (!SDL_CompareAndSwapAtomicInt(&s_stats.state, STATS_UNDECIDED, STATS_ENABLED) &&
+        SDL_GetAtomicInt(&s_stats.state) != STATS_ENABLED) {
+        return SDL_SetError("Memory statistics must be enabled before anything is allocated");
+    }
+    return true;
+}
+
+bool SDL_GetMemoryStats(SDL_MemoryTag tag, SDL_MemoryStats *stats)
+{
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    SDL_zerop(stats);
+
+    if ((int)tag < 0 || tag >= SDL_MEMORY_TAG_COUNT) {
+        return SDL_InvalidParamError("tag");
+    }
+    if (SDL_GetAtomicInt(&s_stats.state) != STATS_ENABLED) {
+        return SDL_SetError("Memory statistics aren't enabled");
+    }
+
+    SDL_LockSpinlock(&s_stats.lock);
+    SDL_copyp(stats, &s_stats.stats[tag]);
+    SDL_UnlockSpinlock(&s_stats.lock);
+    return true;
+}
+
+void SDL_ResetMemoryStats(void)
+{
+    int i;
+
+    SDL_LockSpinlock(&s_stats.lock);
+    for (i = 0; i < SDL_MEMORY_TAG_COUNT; ++i) {
+        s_stats.stats[i].peak_bytes = s_stats.stats[i].live_bytes;
+        s_stats.stats[i].total_allocations = 0;
+    }
+    SDL_UnlockSpinlock(&s_stats.lock);
+}
+
+void *SDL_TaggedMalloc(size_t size, SDL_MemoryTag tag)
 {
     void *mem;
 
@@ -6449,7 +6931,11 @@ void *SDL_malloc(size_t size)
         size = 1;
     }
 
-    mem = s_mem.malloc_func(size);
+    if (SDL_MemoryStatsEnabled()) {
+        mem = SDL_MallocWithStats(size, tag, false);
+    } else {
+        mem = s_mem.malloc_func(size);
+    }
     if (mem) {
         INCREMENT_ALLOCATION_COUNT();
     } else {
@@ -6459,7 +6945,7 @@ void *SDL_malloc(size_t size)
     return mem;
 }
 
-void *SDL_calloc(size_t nmemb, size_t size)
+void *SDL_TaggedCalloc(size_t nmemb, size_t size, SDL_MemoryTag tag)
 {
     void *mem;
 
@@ -6468,7 +6954,17 @@ void *SDL_calloc(size_t nmemb, size_t size)
         size = 1;
     }
 
-    mem = s_mem.calloc_func(nmemb, size);
+    if (SDL_MemoryStatsEnabled()) {
+        size_t total;
+
+        if (SDL_size_mul_check_overflow(nmemb, size, &total)) {
+            mem = SDL_MallocWithStats(total, tag, true);
+        } else {
+            mem = NULL;
+        }
+    } else {
+        mem = s_mem.calloc_func(nmemb, size);
+    }
     if (mem) {
         INCREMENT_ALLOCATION_COUNT();
     } else {
@@ -6478,7 +6974,7 @@ void *SDL_calloc(size_t nmemb, size_t size)
     return mem;
 }
 
-void *SDL_realloc(void *ptr, size_t size)
+void *SDL_TaggedRealloc(void *ptr, size_t size, SDL_MemoryTag tag)
 {
     void *mem;
 
@@ -6486,7 +6982,13 @@ void *SDL_realloc(void *ptr, size_t size)
         size = 1;
     }
 
-    mem = s_mem.realloc_func(ptr, size);
+    if (!SDL_MemoryStatsEnabled()) {
+        mem = s_mem.realloc_func(ptr, size);
+    } else if (ptr) {
+        mem = SDL_ReallocWithStats(ptr, size, tag);
+    } else {
+        mem = SDL_MallocWithStats(size, tag, false);
+    }
     if (mem && !ptr) {
         INCREMENT_ALLOCATION_COUNT();
     } else if (!mem) {
@@ -6496,12 +6998,150 @@ void *SDL_realloc(void *ptr, size_t size)
     return mem;
 }
 
+void *SDL_malloc(size_t size)
+{
+    return SDL_TaggedMalloc(size, SDL_MEMORY_TAG_OTHER);
+}
+
+void *SDL_calloc(size_t nmemb, size_t size)
+{
+    return SDL_TaggedCalloc(nmemb, size, SDL_MEMORY_TAG_OTHER);
+}
+
+void *SDL_realloc(void *ptr, size_t size)
+{
+    return SDL_TaggedRealloc(ptr, size, SDL_MEMORY_TAG_OTHER);
+}
+
 void SDL_free(void *ptr)
 {
     if (!ptr) {
         return;
     }
 
+    // anything there is to free was allocated after this was settled
+    if (SDL_GetAtomicInt(&s_stats.state) == STATS_ENABLED) {
+        ptr = SDL_FreeWithStats(ptr);
+    }
     s_mem.free_func(ptr);
     DECREMENT_ALLOCATION_COUNT();
 }
+
+/* Memory arenas are a list of blocks. Allocations come from the current
+   block, and move on to the next block with enough room, allocating a new
+   one if needed. Resetting keeps the blocks, so they're reused. */
+#define ARENA_ALIGNMENT          16
+#define ARENA_ALIGN(size)        (((size) + (ARENA_ALIGNMENT - 1)) & ~(size_t)(ARENA_ALIGNMENT - 1))
+#define ARENA_DEFAULT_BLOCK_SIZE 4096
+
+typedef struct SDL_MemoryArenaBlock
+{
+    struct SDL_MemoryArenaBlock *next;
+    size_t size;
+    size_t used;
+} SDL_MemoryArenaBlock;
+
+#define ARENA_BLOCK_HEADER_SIZE ARENA_ALIGN(sizeof(SDL_MemoryArenaBlock))
+
+struct SDL_MemoryArena
+{
+    size_t block_size;
+    SDL_MemoryArenaBlock *head;
+    SDL_MemoryArenaBlock *current;
+};
+
+SDL_MemoryArena *SDL_CreateMemoryArena(size_t block_size)
+{
+    SDL_MemoryArena *arena;
+
+    if (block_size > SDL_SIZE_MAX / 2) {
+        SDL_InvalidParamError("block_size");
+        return NULL;
+    }
+
+    arena = (SDL_MemoryArena *)SDL_calloc(1, sizeof(*arena));
+    if (!arena) {
+        return NULL;
+    }
+    arena->block_size = block_size ? ARENA_ALIGN(block_size) : ARENA_DEFAULT_BLOCK_SIZE;
+    return arena;
+}
+
+void *SDL_AllocateArenaMemory(SDL_MemoryArena *arena, size_t size)
+{
+    SDL_MemoryArenaBlock *block;
+    Uint8 *mem;
+
+    if (!arena) {
+        SDL_InvalidParamError("arena");
+        return NULL;
+    }
+
+    if (!size) {
+        size = 1;
+    } else if (size > SDL_SIZE_MAX - ARENA_BLOCK_HEADER_SIZE - ARENA_ALIGNMENT) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    size = ARENA_ALIGN(size);
+
+    for (block = arena->current; block; block = block->next) {
+        if (size <= block->size - block->used) {
+            break;
+        }
+    }
+
+    if (!block) {
+        const size_t block_size = SDL_max(size, arena->block_size);
+
+        block = (SDL_MemoryArenaBlock *)SDL_malloc(ARENA_BLOCK_HEADER_SIZE + block_size);
+        if (!block) {
+            return NULL;
+        }
+        block->size = block_size;
+        block->used = 0;
+
+        // Any blocks after the current one still have room, so they stay next in line
+        if (arena->current) {
+            block->next = arena->current->next;
+            arena->current->next = block;
+        } else {
+            block->next = arena->head;
+            arena->head = block;
+        }
+    }
+
+    arena->current = block;
+    mem = (Uint8 *)block + ARENA_BLOCK_HEADER_SIZE + block->used;
+    block->used += size;
+    return mem;
+}
+
+void SDL_ResetMemoryArena(SDL_MemoryArena *arena)
+{
+    SDL_MemoryArenaBlock *block;
+
+    if (!arena) {
+        return;
+    }
+
+    for (block = arena->head; block; block = block->next) {
+        block->used = 0;
+    }
+    arena->current = arena->head;
+}
+
+void SDL_DestroyMemoryArena(SDL_MemoryArena *arena)
+{
+    SDL_MemoryArenaBlock *block, *next;
+
+    if (!arena) {
+        return;
+    }
+
+    for (block = arena->head; block; block = next) {
+        next = block->next;
+        SDL_free(block);
+    }
+    SDL_free(arena);
+}
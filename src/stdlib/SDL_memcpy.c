@@ -20,6 +20,7 @@
 */
 #include "SDL_internal.h"
 
+#include "SDL_sysstdlib.h"
 
 #ifdef SDL_memcpy
 #undef SDL_memcpy
@@ -40,6 +41,11 @@ void *SDL_memcpy(SDL_OUT_BYTECAP(len) void *dst, SDL_IN_BYTECAP(len) const void
     bcopy(src, dst, len);
     return dst;
 #else
+    if (SDL_memcpySIMD && len >= SDL_SIMD_MEMORY_THRESHOLD) {
+        SDL_memcpySIMD(dst, src, len, (len >= SDL_STREAMING_MEMORY_THRESHOLD));
+        return dst;
+    }
+
     /* GCC 4.9.0 with -O3 will generate movaps instructions with the loop
        using Uint32* pointers, so we need to make sure the pointers are
        aligned before we loop using them.
@@ -0,0 +1,360 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_sysstdlib.h"
+
+/* All of these copy the first vector unaligned, then carry on from the first
+   aligned destination address, and finish with a last unaligned vector that
+   ends exactly at the end of the block. The vectors at either end may
+   overlap the ones in the middle, which only writes the same bytes twice.
+
+   Streaming writes use non-temporal stores, which go around the cache.
+   That's slower for blocks that would have fit in the cache, but for bigger
+   blocks, it keeps the copy from evicting everything else. */
+
+void (*SDL_memcpySIMD)(void *dst, const void *src, size_t len, bool streaming) = NULL;
+void (*SDL_memsetSIMD)(void *dst, int c, size_t len, bool streaming) = NULL;
+
+static void SDL_memcpySmall(Uint8 *dst, const Uint8 *src, size_t len)
+{
+    while (len--) {
+        *dst++ = *src++;
+    }
+}
+
+static void SDL_memsetSmall(Uint8 *dst, Uint8 value, size_t len)
+{
+    while (len--) {
+        *dst++ = value;
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static void SDL_TARGETING("sse2") SDL_memcpySSE2(void *dst, const void *src, size_t len, bool streaming)
+{
+    Uint8 *d = (Uint8 *)dst;
+    const Uint8 *s = (const Uint8 *)src;
+    size_t skip;
+
+    if (len < 16) {
+        SDL_memcpySmall(d, s, len);
+        return;
+    }
+
+    skip = 16 - ((uintptr_t)d & 15);
+    _mm_storeu_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+    d += skip;
+    s += skip;
+    len -= skip;
+
+    if (streaming) {
+        for (; len >= 64; len -= 64) {
+            const __m128i v0 = _mm_loadu_si128((const __m128i *)(s + 0));
+            const __m128i v1 = _mm_loadu_si128((const __m128i *)(s + 16));
+            const __m128i v2 = _mm_loadu_si128((const __m128i *)(s + 32));
+            const __m128i v3 = _mm_loadu_si128((const __m128i *)(s + 48));
+            _mm_stream_si128((__m128i *)(d + 0), v0);
+            _mm_stream_si128((__m128i *)(d + 16), v1);
+            _mm_stream_si128((__m128i *)(d + 32), v2);
+            _mm_stream_si128((__m128i *)(d + 48), v3);
+            s += 64;
+            d += 64;
+        }
+        _mm_sfence();
+    } else {
+        for (; len >= 64; len -= 64) {
+            const __m128i v0 = _mm_loadu_si128((const __m128i *)(s + 0));
+            const __m128i v1 = _mm_loadu_si128((const __m128i *)(s + 16));
+            const __m128i v2 = _mm_loadu_si128((const __m128i *)(s + 32));
+            const __m128i v3 = _mm_loadu_si128((const __m128i *)(s + 48));
+            _mm_store_si128((__m128i *)(d + 0), v0);
+            _mm_store_si128((__m128i *)(d + 16), v1);
+            _mm_store_si128((__m128i *)(d + 32), v2);
+            _mm_store_si128((__m128i *)(d + 48), v3);
+            s += 64;
+            d += 64;
+        }
+    }
+
+    for (; len >= 16; len -= 16) {
+        _mm_store_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+        s += 16;
+        d += 16;
+    }
+    if (len) {
+        _mm_storeu_si128((__m128i *)(d + len - 16), _mm_loadu_si128((const __m128i *)(s + len - 16)));
+    }
+}
+
+static void SDL_TARGETING("sse2") SDL_memsetSSE2(void *dst, int c, size_t len, bool streaming)
+{
+    Uint8 *d = (Uint8 *)dst;
+    const __m128i v = _mm_set1_epi8((char)c);
+    size_t skip;
+
+    if (len < 16) {
+        SDL_memsetSmall(d, (Uint8)c, len);
+        return;
+    }
+
+    skip = 16 - ((uintptr_t)d & 15);
+    _mm_storeu_si128((__m128i *)d, v);
+    d += skip;
+    len -= skip;
+
+    if (streaming) {
+        for (; len >= 64; len -= 64) {
+            _mm_stream_si128((__m128i *)(d + 0), v);
+            _mm_stream_si128((__m128i *)(d + 16), v);
+            _mm_stream_si128((__m128i *)(d + 32), v);
+            _mm_stream_si128((__m128i *)(d + 48), v);
+            d += 64;
+        }
+        _mm_sfence();
+    } else {
+        for (; len >= 64; len -= 64) {
+            _mm_store_si128((__m128i *)(d + 0), v);
+            _mm_store_si128((__m128i *)(d + 16), v);
+            _mm_store_si128((__m128i *)(d + 32), v);
+            _mm_store_si128((__m128i *)(d + 48), v);
+            d += 64;
+        }
+    }
+
+    for (; len >= 16; len -= 16) {
+        _mm_store_si128((__m128i *)d, v);
+        d += 16;
+    }
+    if (len) {
+        _mm_storeu_si128((__m128i *)(d + len - 16), v);
+    }
+}
+#endif // SDL_SSE2_INTRINSICS
+
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+static void SDL_TARGETING("avx2") SDL_memcpyAVX2(void *dst, const void *src, size_t len, bool streaming)
+{
+    Uint8 *d = (Uint8 *)dst;
+    const Uint8 *s = (const Uint8 *)src;
+    size_t skip;
+
+    if (len < 64) {
+        SDL_memcpySSE2(d, s, len, false);
+        return;
+    }
+
+    skip = 32 - ((uintptr_t)d & 31);
+    _mm256_storeu_si256((__m256i *)d, _mm256_loadu_si256((const __m256i *)s));
+    d += skip;
+    s += skip;
+    len -= skip;
+
+    if (streaming) {
+        for (; len >= 128; len -= 128) {
+            const __m256i v0 = _mm256_loadu_si256((const __m256i *)(s + 0));
+            const __m256i v1 = _mm256_loadu_si256((const __m256i *)(s + 32));
+            const __m256i v2 = _mm256_loadu_si256((const __m256i *)(s + 64));
+            const __m256i v3 = _mm256_loadu_si256((const __m256i *)(s + 96));
+            _mm256_stream_si256((__m256i *)(d + 0), v0);
+            _mm256_stream_si256((__m256i *)(d + 32), v1);
+            _mm256_stream_si256((__m256i *)(d + 64), v2);
+            _mm256_stream_si256((__m256i *)(d + 96), v3);
+            s += 128;
+            d += 128;
+        }
+        _mm_sfence();
+    } else {
+        for (; len >= 128; len -= 128) {
+            const __m256i v0 = _mm256_loadu_si256((const __m256i *)(s + 0));
+            const __m256i v1 = _mm256_loadu_si256((const __m256i *)(s + 32));
+            const __m256i v2 = _mm256_loadu_si256((const __m256i *)(s + 64));
+            const __m256i v3 = _mm256_loadu_si256((const __m256i *)(s + 96));
+            _mm256_store_si256((__m256i *)(d + 0), v0);
+            _mm256_store_si256((__m256i *)(d + 32), v1);
+            _mm256_store_si256((__m256i *)(d + 64), v2);
+            _mm256_store_si256((__m256i *)(d + 96), v3);
+            s += 128;
+            d += 128;
+        }
+    }
+
+    for (; len >= 32; len -= 32) {
+        _mm256_store_si256((__m256i *)d, _mm256_loadu_si256((const __m256i *)s));
+        s += 32;
+        d += 32;
+    }
+    if (len) {
+        _mm256_storeu_si256((__m256i *)(d + len - 32), _mm256_loadu_si256((const __m256i *)(s + len - 32)));
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_memsetAVX2(void *dst, int c, size_t len, bool streaming)
+{
+    Uint8 *d = (Uint8 *)dst;
+    const __m256i v = _mm256_set1_epi8((char)c);
+    size_t skip;
+
+    if (len < 64) {
+        SDL_memsetSSE2(d, c, len, false);
+        return;
+    }
+
+    skip = 32 - ((uintptr_t)d & 31);
+    _mm256_storeu_si256((__m256i *)d, v);
+    d += skip;
+    len -= skip;
+
+    if (streaming) {
+        for (; len >= 128; len -= 128) {
+            _mm256_stream_si256((__m256i *)(d + 0), v);
+            _mm256_stream_si256((__m256i *)(d + 32), v);
+            _mm256_stream_si256((__m256i *)(d + 64), v);
+            _mm256_stream_si256((__m256i *)(d + 96), v);
+            d += 128;
+        }
+        _mm_sfence();
+    } else {
+        for (; len >= 128; len -= 128) {
+            _mm256_store_si256((__m256i *)(d + 0), v);
+            _mm256_store_si256((__m256i *)(d + 32), v);
+            _mm256_store_si256((__m256i *)(d + 64), v);
+            _mm256_store_si256((__m256i *)(d + 96), v);
+            d += 128;
+        }
+    }
+
+    for (; len >= 32; len -= 32) {
+        _mm256_store_si256((__m256i *)d, v);
+        d += 32;
+    }
+    if (len) {
+        _mm256_storeu_si256((__m256i *)(d + len - 32), v);
+    }
+}
+#endif // SDL_AVX2_INTRINSICS && SDL_SSE2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+// NEON has no non-temporal stores that compilers expose, so streaming is ignored here
+static void SDL_memcpyNEON(void *dst, const void *src, size_t len, bool streaming)
+{
+    Uint8 *d = (Uint8 *)dst;
+    const Uint8 *s = (const Uint8 *)src;
+    size_t skip;
+
+    (void)streaming;
+
+    if (len < 16) {
+        SDL_memcpySmall(d, s, len);
+        return;
+    }
+
+    skip = 16 - ((uintptr_t)d & 15);
+    vst1q_u8(d, vld1q_u8(s));
+    d += skip;
+    s += skip;
+    len -= skip;
+
+    for (; len >= 64; len -= 64) {
+        const uint8x16_t v0 = vld1q_u8(s + 0);
+        const uint8x16_t v1 = vld1q_u8(s + 16);
+        const uint8x16_t v2 = vld1q_u8(s + 32);
+        const uint8x16_t v3 = vld1q_u8(s + 48);
+        vst1q_u8(d + 0, v0);
+        vst1q_u8(d + 16, v1);
+        vst1q_u8(d + 32, v2);
+        vst1q_u8(d + 48, v3);
+        s += 64;
+        d += 64;
+    }
+
+    for (; len >= 16; len -= 16) {
+        vst1q_u8(d, vld1q_u8(s));
+        s += 16;
+        d += 16;
+    }
+    if (len) {
+        vst1q_u8(d + len - 16, vld1q_u8(s + len - 16));
+    }
+}
+
+static void SDL_memsetNEON(void *dst, int c, size_t len, bool streaming)
+{
+    Uint8 *d = (Uint8 *)dst;
+    const uint8x16_t v = vdupq_n_u8((Uint8)c);
+    size_t skip;
+
+    (void)streaming;
+
+    if (len < 16) {
+        SDL_memsetSmall(d, (Uint8)c, len);
+        return;
+    }
+
+    skip = 16 - ((uintptr_t)d & 15);
+    vst1q_u8(d, v);
+    d += skip;
+    len -= skip;
+
+    for (; len >= 64; len -= 64) {
+        vst1q_u8(d + 0, v);
+        vst1q_u8(d + 16, v);
+        vst1q_u8(d + 32, v);
+        vst1q_u8(d + 48, v);
+        d += 64;
+    }
+
+    for (; len >= 16; len -= 16) {
+        vst1q_u8(d, v);
+        d += 16;
+    }
+    if (len) {
+        vst1q_u8(d + len - 16, v);
+    }
+}
+#endif // SDL_NEON_INTRINSICS
+
+void SDL_ChooseMemoryFunctionsSIMD(void)
+{
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+    if (SDL_HasAVX2()) {
+        SDL_memcpySIMD = SDL_memcpyAVX2;
+        SDL_memsetSIMD = SDL_memsetAVX2;
+        return;
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SDL_memcpySIMD = SDL_memcpySSE2;
+        SDL_memsetSIMD = SDL_memsetSSE2;
+        return;
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_memcpySIMD = SDL_memcpyNEON;
+        SDL_memsetSIMD = SDL_memsetNEON;
+        return;
+    }
+#endif
+    SDL_memcpySIMD = NULL;
+    SDL_memsetSIMD = NULL;
+}
@@ -20,6 +20,7 @@
 */
 #include "SDL_internal.h"
 
+#include "SDL_sysstdlib.h"
 
 #ifdef SDL_memset
 #undef SDL_memset
@@ -40,6 +41,11 @@ void *SDL_memset(SDL_OUT_BYTECAP(len) void *dst, int c, size_t len)
     Uint8 value1;
     Uint32 value4;
 
+    if (SDL_memsetSIMD && len >= SDL_SIMD_MEMORY_THRESHOLD) {
+        SDL_memsetSIMD(dst, c, len, (len >= SDL_STREAMING_MEMORY_THRESHOLD));
+        return dst;
+    }
+
     // The value used in memset() is a byte, passed as an int
     c &= 0xff;
 
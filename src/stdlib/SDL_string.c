@@ -1888,7 +1888,12 @@ static size_t SDL_PrintString(char *text, size_t maxlen, SDL_FormatInfo *info, c
         string = "(null)";
     }
 
-    sz = SDL_strlen(string);
+    // With a precision, the string doesn't have to be terminated within it
+    if (info && info->precision >= 0) {
+        sz = SDL_strnlen(string, (size_t)info->precision);
+    } else {
+        sz = SDL_strlen(string);
+    }
     if (info && info->width > 0 && (size_t)info->width > sz) {
         width = info->width - sz;
         if (info->precision >= 0 && (size_t)info->precision < sz) {
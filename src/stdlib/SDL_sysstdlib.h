@@ -28,5 +28,20 @@
 // this expects `from` to be a Unicode codepoint, and `to` to point to AT LEAST THREE Uint32s.
 int SDL_CaseFoldUnicode(Uint32 from, Uint32 *to);
 
+// Releases the blocks cached by this thread for SDL_GetThreadCacheMemoryFunctions()
+void SDL_FlushThreadMemoryCache(void);
+
+// Blocks at least this big are copied and set with SIMD when SDL isn't using the C runtime
+#define SDL_SIMD_MEMORY_THRESHOLD 64
+
+// Blocks at least this big are written with non-temporal stores, so they don't evict the whole cache
+#define SDL_STREAMING_MEMORY_THRESHOLD (4 * 1024 * 1024)
+
+// SIMD versions of SDL_memcpy() and SDL_memset() for this CPU, or NULL if there aren't any.
+// These are set by SDL_ChooseMemoryFunctionsSIMD(), which is called once SDL starts up.
+extern void (*SDL_memcpySIMD)(void *dst, const void *src, size_t len, bool streaming);
+extern void (*SDL_memsetSIMD)(void *dst, int c, size_t len, bool streaming);
+void SDL_ChooseMemoryFunctionsSIMD(void);
+
 #endif
 
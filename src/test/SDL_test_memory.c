@@ -75,6 +75,7 @@ static int s_previous_allocations = 0;
 static int s_unknown_frees = 0;
 static SDL_tracked_allocation *s_tracked_allocations[256];
 static bool s_randfill_allocations = false;
+static SDL_AtomicInt s_allocation_count;
 static SDL_AtomicInt s_lock;
 
 #define LOCK_ALLOCATOR()                               \
@@ -235,6 +236,7 @@ static void * SDLCALL SDLTest_TrackedMalloc(size_t size)
 
     mem = SDL_malloc_orig(size);
     if (mem) {
+        SDL_AddAtomicInt(&s_allocation_count, 1);
         SDL_TrackAllocation(mem, size);
         rand_fill_memory(mem, 0, size);
     }
@@ -247,6 +249,7 @@ static void * SDLCALL SDLTest_TrackedCalloc(size_t nmemb, size_t size)
 
     mem = SDL_calloc_orig(nmemb, size);
     if (mem) {
+        SDL_AddAtomicInt(&s_allocation_count, 1);
         SDL_TrackAllocation(mem, nmemb * size);
     }
     return mem;
@@ -265,6 +268,7 @@ static void * SDLCALL SDLTest_TrackedRealloc(void *ptr, size_t size)
         SDL_UntrackAllocation(ptr);
     }
     if (mem) {
+        SDL_AddAtomicInt(&s_allocation_count, 1);
         SDL_TrackAllocation(mem, size);
         if (size > old_size) {
             rand_fill_memory(mem, old_size, size);
@@ -355,6 +359,14 @@ void SDLTest_RandFillAllocations(void)
     s_randfill_allocations = true;
 }
 
+int SDLTest_GetAllocationCount(void)
+{
+    if (!SDL_malloc_orig) {
+        return -1;
+    }
+    return SDL_GetAtomicInt(&s_allocation_count);
+}
+
 void SDLTest_LogAllocations(void)
 {
     char *message = NULL;
@@ -25,6 +25,7 @@
 #include "SDL_thread_c.h"
 #include "SDL_systhread.h"
 #include "../SDL_error_c.h"
+#include "../stdlib/SDL_sysstdlib.h"
 
 // The storage is local to the thread, but the IDs are global for the process
 
@@ -338,6 +339,9 @@ void SDL_RunThread(SDL_Thread *thread)
             SDL_free(thread);
         }
     }
+
+    // Release any memory this thread cached, now that it won't free anything else
+    SDL_FlushThreadMemoryCache();
 }
 
 SDL_Thread *SDL_CreateThreadWithPropertiesRuntime(SDL_PropertiesID props,
@@ -35,24 +35,21 @@ typedef struct SDL_Timer
     void *userdata;
     Uint64 interval;
     Uint64 scheduled;
+    Uint64 dispatched;
+    Uint64 sequence;
     SDL_AtomicInt canceled;
     struct SDL_Timer *next;
 } SDL_Timer;
 
-typedef struct SDL_TimerMap
-{
-    SDL_TimerID timerID;
-    SDL_Timer *timer;
-    struct SDL_TimerMap *next;
-} SDL_TimerMap;
+#define SDL_MAX_TIMER_DISPATCH_THREADS 64
 
-// The timers are kept in a sorted list
+// The timers are kept in a binary min-heap, ordered by scheduling time
 typedef struct
 {
     // Data used by the main thread
     SDL_InitState init;
     SDL_Thread *thread;
-    SDL_TimerMap *timermap;
+    SDL_HashTable *timermap;
     SDL_Mutex *timermap_lock;
 
     // Padding to separate cache lines between threads
@@ -65,45 +62,208 @@ typedef struct
     SDL_Timer *freelist;
     SDL_AtomicInt active;
 
-    // List of timers - this is only touched by the timer thread
-    SDL_Timer *timers;
+    // Heap of timers - this is only touched by the timer thread
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint64 next_sequence;
+
+    // Due timers waiting for a dispatch thread, if there are any
+    SDL_Mutex *dispatch_lock;
+    SDL_Condition *dispatch_cond;
+    SDL_Timer *dispatch_head;
+    SDL_Timer *dispatch_tail;
+    int num_dispatch_threads;
+    SDL_Thread *dispatch_threads[SDL_MAX_TIMER_DISPATCH_THREADS];
+
+    // Latency statistics, updated by whichever thread runs the callback
+    SDL_SpinLock stats_lock;
+    SDL_TimerLatencyHistogram stats;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
 
 /* The idea here is that any thread might add a timer, but a single
- * thread manages the active timer queue, sorted by scheduling time.
+ * thread manages the active timer queue, ordered by scheduling time.
  *
  * Timers are removed by simply setting a canceled flag
  */
 
-static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+// Timers scheduled for the same time fire in the order they were queued
+static bool SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
 {
-    SDL_Timer *prev, *curr;
+    if (a->scheduled != b->scheduled) {
+        return a->scheduled < b->scheduled;
+    }
+    return a->sequence < b->sequence;
+}
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
+static bool SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
+{
+    int i;
+
+    if (data->num_timers == data->max_timers) {
+        int max_timers = data->max_timers ? (data->max_timers * 2) : 64;
+        SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return false;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
+
+    timer->sequence = data->next_sequence++;
+
+    // Sift the new timer up from the bottom of the heap
+    i = data->num_timers++;
+    while (i > 0) {
+        const int parent = (i - 1) / 2;
+        if (!SDL_TimerBefore(timer, data->timers[parent])) {
+            break;
+        }
+        data->timers[i] = data->timers[parent];
+        i = parent;
+    }
+    data->timers[i] = timer;
+    return true;
+}
+
+static SDL_Timer *SDL_RemoveFirstTimer(SDL_TimerData *data)
+{
+    SDL_Timer *first, *last;
+    int i, count;
+
+    SDL_assert(data->num_timers > 0);
+
+    first = data->timers[0];
+    count = --data->num_timers;
+    if (count == 0) {
+        return first;
+    }
+
+    // Sift the last timer down from the top of the heap
+    last = data->timers[count];
+    i = 0;
+    for (;;) {
+        int child = (2 * i) + 1;
+        if (child >= count) {
             break;
         }
+        if (child + 1 < count && SDL_TimerBefore(data->timers[child + 1], data->timers[child])) {
+            ++child;
+        }
+        if (!SDL_TimerBefore(data->timers[child], last)) {
+            break;
+        }
+        data->timers[i] = data->timers[child];
+        i = child;
+    }
+    data->timers[i] = last;
+    return first;
+}
+
+static void SDL_RecordTimerLatency(SDL_TimerData *data, Uint64 latency)
+{
+    const Uint64 us = latency / SDL_NS_PER_US;
+    int bucket;
+
+    if (us == 0) {
+        bucket = 0;
+    } else if (us >= ((Uint64)1 << (SDL_TIMER_LATENCY_BUCKETS - 2))) {
+        bucket = SDL_TIMER_LATENCY_BUCKETS - 1;
+    } else {
+        bucket = SDL_MostSignificantBitIndex32((Uint32)us) + 1;
+    }
+
+    SDL_LockSpinlock(&data->stats_lock);
+    ++data->stats.count;
+    data->stats.total_ns += latency;
+    if (latency > data->stats.max_ns) {
+        data->stats.max_ns = latency;
+    }
+    ++data->stats.buckets[bucket];
+    SDL_UnlockSpinlock(&data->stats_lock);
+}
+
+// Run a timer callback and return the next interval, or 0 if the timer is done
+static Uint64 SDL_RunTimerCallback(SDL_TimerData *data, SDL_Timer *timer)
+{
+    const Uint64 now = SDL_GetTicksNS();
+
+    if (SDL_GetAtomicInt(&timer->canceled)) {
+        return 0;
     }
 
-    // Insert the timer here!
-    if (prev) {
-        prev->next = timer;
+    SDL_RecordTimerLatency(data, (now > timer->scheduled) ? (now - timer->scheduled) : 0);
+
+    if (timer->callback_ms) {
+        return SDL_MS_TO_NS(timer->callback_ms(timer->userdata, timer->timerID, (Uint32)SDL_NS_TO_MS(timer->interval)));
     } else {
-        data->timers = timer;
+        return timer->callback_ns(timer->userdata, timer->timerID, timer->interval);
+    }
+}
+
+/* Dispatch threads run callbacks for timers the timer thread found due.
+ * A timer isn't in the heap while its callback runs, so it never runs
+ * concurrently with itself. When the callback is done the timer goes back
+ * to the timer thread through the pending list, like a new timer.
+ */
+static int SDLCALL SDL_TimerDispatchThread(void *_data)
+{
+    SDL_TimerData *data = (SDL_TimerData *)_data;
+    SDL_Timer *timer;
+    Uint64 interval;
+
+    for (;;) {
+        SDL_LockMutex(data->dispatch_lock);
+        while (!data->dispatch_head && SDL_GetAtomicInt(&data->active)) {
+            SDL_WaitCondition(data->dispatch_cond, data->dispatch_lock);
+        }
+        timer = SDL_GetAtomicInt(&data->active) ? data->dispatch_head : NULL;
+        if (timer) {
+            data->dispatch_head = timer->next;
+            if (!data->dispatch_head) {
+                data->dispatch_tail = NULL;
+            }
+        }
+        SDL_UnlockMutex(data->dispatch_lock);
+
+        if (!timer) {
+            // We're shutting down
+            break;
+        }
+
+        interval = SDL_RunTimerCallback(data, timer);
+
+        SDL_LockSpinlock(&data->lock);
+        if (interval > 0) {
+            timer->interval = interval;
+            timer->scheduled = timer->dispatched + interval;
+            timer->next = data->pending;
+            data->pending = timer;
+        } else {
+            SDL_SetAtomicInt(&timer->canceled, 1);
+            timer->next = data->freelist;
+            data->freelist = timer;
+        }
+        SDL_UnlockSpinlock(&data->lock);
+
+        if (interval > 0) {
+            SDL_SignalSemaphore(data->sem);
+        }
     }
-    timer->next = curr;
+    return 0;
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
 {
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
+    SDL_Timer *deferred = NULL;
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
+    SDL_Timer *dispatch_head, *dispatch_tail;
     Uint64 tick, now, interval, delay;
 
     /* Threaded timer loop:
@@ -127,11 +287,26 @@ static int SDLCALL SDL_TimerThread(void *_data)
         }
         SDL_UnlockSpinlock(&data->lock);
 
-        // Sort the pending timers into our list
+        // Timers we couldn't queue last time go first
+        if (deferred) {
+            current = deferred;
+            while (current->next) {
+                current = current->next;
+            }
+            current->next = pending;
+            pending = deferred;
+            deferred = NULL;
+        }
+
+        // Sort the pending timers into our heap
         while (pending) {
             current = pending;
+            if (!SDL_AddTimerInternal(data, current)) {
+                // Out of memory, try again later
+                deferred = pending;
+                break;
+            }
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
         }
         freelist_head = NULL;
         freelist_tail = NULL;
@@ -142,35 +317,42 @@ static int SDLCALL SDL_TimerThread(void *_data)
         }
 
         // Initial delay if there are no timers
-        delay = (Uint64)-1;
+        delay = deferred ? SDL_NS_PER_MS : (Uint64)-1;
 
         tick = SDL_GetTicksNS();
+        dispatch_head = NULL;
+        dispatch_tail = NULL;
 
         // Process all the pending timers for this tick
-        while (data->timers) {
-            current = data->timers;
+        while (data->num_timers > 0) {
+            current = data->timers[0];
 
             if (tick < current->scheduled) {
                 // Scheduled for the future, wait a bit
-                delay = (current->scheduled - tick);
+                delay = SDL_min(delay, current->scheduled - tick);
                 break;
             }
 
             // We're going to do something with this timer
-            data->timers = current->next;
-
-            if (SDL_GetAtomicInt(&current->canceled)) {
-                interval = 0;
-            } else {
-                if (current->callback_ms) {
-                    interval = SDL_MS_TO_NS(current->callback_ms(current->userdata, current->timerID, (Uint32)SDL_NS_TO_MS(current->interval)));
+            SDL_RemoveFirstTimer(data);
+
+            if (data->num_dispatch_threads > 0 && !SDL_GetAtomicInt(&current->canceled)) {
+                // Hand it to a dispatch thread, it'll come back when the callback is done
+                current->dispatched = tick;
+                current->next = NULL;
+                if (dispatch_tail) {
+                    dispatch_tail->next = current;
                 } else {
-                    interval = current->callback_ns(current->userdata, current->timerID, current->interval);
+                    dispatch_head = current;
                 }
+                dispatch_tail = current;
+                continue;
             }
 
+            interval = SDL_RunTimerCallback(data, current);
+
             if (interval > 0) {
-                // Reschedule this timer
+                // Reschedule this timer, this never grows the heap since we just took it out
                 current->interval = interval;
                 current->scheduled = tick + interval;
                 SDL_AddTimerInternal(data, current);
@@ -187,6 +369,18 @@ static int SDLCALL SDL_TimerThread(void *_data)
             }
         }
 
+        if (dispatch_head) {
+            SDL_LockMutex(data->dispatch_lock);
+            if (data->dispatch_tail) {
+                data->dispatch_tail->next = dispatch_head;
+            } else {
+                data->dispatch_head = dispatch_head;
+            }
+            data->dispatch_tail = dispatch_tail;
+            SDL_BroadcastCondition(data->dispatch_cond);
+            SDL_UnlockMutex(data->dispatch_lock);
+        }
+
         // Adjust the delay based on processing time
         now = SDL_GetTicksNS();
         interval = (now - tick);
@@ -203,12 +397,26 @@ static int SDLCALL SDL_TimerThread(void *_data)
          */
         SDL_WaitSemaphoreTimeoutNS(data->sem, delay);
     }
+
+    // Hand back anything we couldn't queue, so it's cleaned up
+    if (deferred) {
+        SDL_LockSpinlock(&data->lock);
+        current = deferred;
+        while (current->next) {
+            current = current->next;
+        }
+        current->next = data->pending;
+        data->pending = deferred;
+        SDL_UnlockSpinlock(&data->lock);
+    }
     return 0;
 }
 
 bool SDL_InitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
+    const char *hint;
+    int i, num_dispatch_threads;
 
     if (!SDL_ShouldInit(&data->init)) {
         return true;
@@ -219,11 +427,18 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    data->timermap = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!data->timermap) {
+        goto error;
+    }
+
     data->sem = SDL_CreateSemaphore(0);
     if (!data->sem) {
         goto error;
     }
 
+    SDL_zero(data->stats);
+
     SDL_SetAtomicInt(&data->active, true);
 
     // Timer threads use a callback into the app, so we can't set a limited stack size here.
@@ -232,6 +447,38 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    hint = SDL_GetHint(SDL_HINT_TIMER_DISPATCH_THREADS);
+    num_dispatch_threads = hint ? SDL_clamp(SDL_atoi(hint), 0, SDL_MAX_TIMER_DISPATCH_THREADS) : 0;
+    if (num_dispatch_threads > 0) {
+        data->dispatch_lock = SDL_CreateMutex();
+        if (!data->dispatch_lock) {
+            goto error;
+        }
+
+        data->dispatch_cond = SDL_CreateCondition();
+        if (!data->dispatch_cond) {
+            goto error;
+        }
+
+        for (i = 0; i < num_dispatch_threads; ++i) {
+            char name[64];
+
+            (void)SDL_snprintf(name, sizeof(name), "SDLTimerDispatch%d", i);
+            data->dispatch_threads[i] = SDL_CreateThread(SDL_TimerDispatchThread, name, data);
+            if (!data->dispatch_threads[i]) {
+                break;
+            }
+        }
+        if (i == 0) {
+            goto error;
+        }
+
+        // The timer thread only looks at this once the threads are ready
+        SDL_LockSpinlock(&data->lock);
+        data->num_dispatch_threads = i;
+        SDL_UnlockSpinlock(&data->lock);
+    }
+
     SDL_SetInitialized(&data->init, true);
     return true;
 
@@ -245,7 +492,7 @@ void SDL_QuitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    int i;
 
     if (!SDL_ShouldQuit(&data->init)) {
         return;
@@ -260,15 +507,53 @@ void SDL_QuitTimers(void)
         data->thread = NULL;
     }
 
+    // Shutdown the dispatch threads, they won't start any more callbacks
+    if (data->dispatch_lock) {
+        SDL_LockMutex(data->dispatch_lock);
+        SDL_BroadcastCondition(data->dispatch_cond);
+        SDL_UnlockMutex(data->dispatch_lock);
+    }
+    for (i = 0; i < SDL_arraysize(data->dispatch_threads); ++i) {
+        if (data->dispatch_threads[i]) {
+            SDL_WaitThread(data->dispatch_threads[i], NULL);
+            data->dispatch_threads[i] = NULL;
+        }
+    }
+    data->num_dispatch_threads = 0;
+
+    if (data->dispatch_cond) {
+        SDL_DestroyCondition(data->dispatch_cond);
+        data->dispatch_cond = NULL;
+    }
+    if (data->dispatch_lock) {
+        SDL_DestroyMutex(data->dispatch_lock);
+        data->dispatch_lock = NULL;
+    }
+
     if (data->sem) {
         SDL_DestroySemaphore(data->sem);
         data->sem = NULL;
     }
 
     // Clean up the timer entries
-    while (data->timers) {
-        timer = data->timers;
-        data->timers = timer->next;
+    while (data->dispatch_head) {
+        timer = data->dispatch_head;
+        data->dispatch_head = timer->next;
+        SDL_free(timer);
+    }
+    data->dispatch_tail = NULL;
+
+    for (i = 0; i < data->num_timers; ++i) {
+        SDL_free(data->timers[i]);
+    }
+    SDL_free(data->timers);
+    data->timers = NULL;
+    data->num_timers = 0;
+    data->max_timers = 0;
+
+    while (data->pending) {
+        timer = data->pending;
+        data->pending = timer->next;
         SDL_free(timer);
     }
     while (data->freelist) {
@@ -276,10 +561,10 @@ void SDL_QuitTimers(void)
         data->freelist = timer->next;
         SDL_free(timer);
     }
-    while (data->timermap) {
-        entry = data->timermap;
-        data->timermap = entry->next;
-        SDL_free(entry);
+
+    if (data->timermap) {
+        SDL_DestroyHashTable(data->timermap);
+        data->timermap = NULL;
     }
 
     if (data->timermap_lock) {
@@ -299,7 +584,8 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    SDL_TimerID timerID;
+    bool added;
 
     if (!callback_ms && !callback_ns) {
         SDL_InvalidParamError("callback");
@@ -318,7 +604,10 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     SDL_UnlockSpinlock(&data->lock);
 
     if (timer) {
-        SDL_RemoveTimer(timer->timerID);
+        // The old ID may still be mapped if the app never removed the timer
+        SDL_LockMutex(data->timermap_lock);
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID);
+        SDL_UnlockMutex(data->timermap_lock);
     } else {
         timer = (SDL_Timer *)SDL_malloc(sizeof(*timer));
         if (!timer) {
@@ -333,18 +622,15 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     timer->scheduled = SDL_GetTicksNS() + timer->interval;
     SDL_SetAtomicInt(&timer->canceled, 0);
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
-        SDL_free(timer);
-        return 0;
-    }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
+    timerID = timer->timerID;
 
     SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
+    added = SDL_InsertIntoHashTable(data->timermap, (const void *)(uintptr_t)timerID, timer, false);
     SDL_UnlockMutex(data->timermap_lock);
+    if (!added) {
+        SDL_free(timer);
+        return 0;
+    }
 
     // Add the timer to the pending list for the timer thread
     SDL_LockSpinlock(&data->lock);
@@ -355,7 +641,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     // Wake up the timer thread if necessary
     SDL_SignalSemaphore(data->sem);
 
-    return entry->timerID;
+    return timerID;
 }
 
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *userdata)
@@ -371,7 +657,7 @@ SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *
 bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    const void *value = NULL;
     bool canceled = false;
 
     if (!id) {
@@ -380,26 +666,17 @@ bool SDL_RemoveTimer(SDL_TimerID id)
 
     // Find the timer
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
-    }
-    SDL_UnlockMutex(data->timermap_lock);
+    if (data->timermap && SDL_FindInHashTable(data->timermap, (const void *)(uintptr_t)id, &value)) {
+        SDL_Timer *timer = (SDL_Timer *)value;
 
-    if (entry) {
-        if (!SDL_GetAtomicInt(&entry->timer->canceled)) {
-            SDL_SetAtomicInt(&entry->timer->canceled, 1);
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)id);
+        if (!SDL_GetAtomicInt(&timer->canceled)) {
+            SDL_SetAtomicInt(&timer->canceled, 1);
             canceled = true;
         }
-        SDL_free(entry);
     }
+    SDL_UnlockMutex(data->timermap_lock);
+
     if (canceled) {
         return true;
     } else {
@@ -407,6 +684,24 @@ bool SDL_RemoveTimer(SDL_TimerID id)
     }
 }
 
+bool SDL_GetTimerLatencyHistogram(SDL_TimerLatencyHistogram *histogram, bool reset)
+{
+    SDL_TimerData *data = &SDL_timer_data;
+
+    if (!histogram) {
+        return SDL_InvalidParamError("histogram");
+    }
+
+    SDL_LockSpinlock(&data->stats_lock);
+    SDL_copyp(histogram, &data->stats);
+    if (reset) {
+        SDL_zero(data->stats);
+    }
+    SDL_UnlockSpinlock(&data->stats_lock);
+
+    return true;
+}
+
 #else
 
 #include <emscripten/emscripten.h>
@@ -533,6 +828,14 @@ bool SDL_RemoveTimer(SDL_TimerID id)
     }
 }
 
+bool SDL_GetTimerLatencyHistogram(SDL_TimerLatencyHistogram *histogram, bool reset)
+{
+    if (!histogram) {
+        return SDL_InvalidParamError("histogram");
+    }
+    return SDL_Unsupported();
+}
+
 #endif // !SDL_PLATFORM_EMSCRIPTEN || !SDL_THREADS_DISABLED
 
 static Uint64 tick_start;
@@ -22,33 +22,7 @@
 
 #include "SDL_surface_c.h"
 #include "SDL_blit_copy.h"
-
-#ifdef SDL_SSE_INTRINSICS
-// This assumes 16-byte aligned src and dst
-static SDL_INLINE void SDL_TARGETING("sse") SDL_memcpySSE(Uint8 *dst, const Uint8 *src, int len)
-{
-    int i;
-
-    __m128 values[4];
-    for (i = len / 64; i--;) {
-        _mm_prefetch((const char *)src, _MM_HINT_NTA);
-        values[0] = *(__m128 *)(src + 0);
-        values[1] = *(__m128 *)(src + 16);
-        values[2] = *(__m128 *)(src + 32);
-        values[3] = *(__m128 *)(src + 48);
-        _mm_stream_ps((float *)(dst + 0), values[0]);
-        _mm_stream_ps((float *)(dst + 16), values[1]);
-        _mm_stream_ps((float *)(dst + 32), values[2]);
-        _mm_stream_ps((float *)(dst + 48), values[3]);
-        src += 64;
-        dst += 64;
-    }
-
-    if (len & 63) {
-        SDL_memcpy(dst, src, len & 63);
-    }
-}
-#endif // SDL_SSE_INTRINSICS
+#include "../stdlib/SDL_sysstdlib.h"
 
 void SDL_BlitCopy(SDL_BlitInfo *info)
 {
@@ -89,18 +63,15 @@ void SDL_BlitCopy(SDL_BlitInfo *info)
         return;
     }
 
-#ifdef SDL_SSE_INTRINSICS
-    if (SDL_HasSSE() &&
-        !((uintptr_t)src & 15) && !(srcskip & 15) &&
-        !((uintptr_t)dst & 15) && !(dstskip & 15)) {
+    // Big blits are written around the cache, so they don't evict everything else
+    if (SDL_memcpySIMD && (size_t)w * h >= SDL_STREAMING_MEMORY_THRESHOLD) {
         while (h--) {
-            SDL_memcpySSE(dst, src, w);
+            SDL_memcpySIMD(dst, src, w, true);
             src += srcskip;
             dst += dstskip;
         }
         return;
     }
-#endif
 
     while (h--) {
         SDL_memcpy(dst, src, w);
@@ -1884,6 +1884,342 @@ bool SDL_FlipSurface(SDL_Surface *surface, SDL_FlipMode flip)
     }
 }
 
+// Conversions smaller than this aren't worth handing to other threads
+#define SDL_MIN_CONVERSION_BAND_PIXELS (128 * 128)
+
+// The most threads the conversion pool will start
+#define SDL_MAX_CONVERSION_THREADS 64
+
+typedef struct SDL_ConversionBand
+{
+    SDL_Surface src;
+    SDL_Surface dst;
+    bool initialized;
+    bool result;
+    char error[256];
+} SDL_ConversionBand;
+
+// The bands of one conversion, queued for the conversion threads
+typedef struct SDL_ConversionBatch
+{
+    SDL_ConversionBand *bands;
+    int num_bands;
+    int next_band;  // bands before this have been claimed
+    int bands_left; // bands that haven't finished yet
+    struct SDL_ConversionBatch *next;
+} SDL_ConversionBatch;
+
+/* Conversion threads. These are started the first time a conversion is split
+   into bands, and stay around until SDL_Quit(), so converting a frame doesn't
+   pay for creating threads. The thread doing the conversion works on its own
+   bands too, so conversions still finish if the threads are busy or couldn't
+   be started. */
+static struct
+{
+    SDL_InitState init;
+    SDL_Mutex *lock;
+    SDL_Condition *cond;
+    SDL_Condition *done_cond;
+    SDL_Thread **threads;
+    int num_threads;
+    bool shutdown;
+    SDL_ConversionBatch *batches; // batches with bands left to claim
+} SDL_conversion_threads;
+
+static int GetConversionBandCount(int width, int height)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_CONVERSION_THREADS);
+    int count = 1;
+
+    if (hint) {
+        count = SDL_atoi(hint);
+        if (count <= 0) {
+            count = SDL_GetNumLogicalCPUCores();
+        }
+    }
+
+    count = SDL_min(count, (int)(((Sint64)width * height) / SDL_MIN_CONVERSION_BAND_PIXELS));
+    count = SDL_min(count, height);
+    return SDL_max(count, 1);
+}
+
+static bool SDL_InitializeConversionBand(SDL_ConversionBand *band, SDL_Surface *src, SDL_Surface *dst, int y, int h)
+{
+    Uint8 *src_pixels = (Uint8 *)src->pixels + (size_t)y * src->pitch;
+    Uint8 *dst_pixels = (Uint8 *)dst->pixels + (size_t)y * dst->pitch;
+
+    if (!SDL_InitializeSurface(&band->src, src->w, h, src->format, src->colorspace, src->props, src_pixels, src->pitch, true)) {
+        return false;
+    }
+    if (!SDL_InitializeSurface(&band->dst, dst->w, h, dst->format, dst->colorspace, dst->props, dst_pixels, dst->pitch, true)) {
+        SDL_DestroySurface(&band->src);
+        return false;
+    }
+    band->initialized = true;
+
+    // Blit like the whole surfaces would, but the bands never own the pixels
+    band->src.flags = src->flags | SDL_SURFACE_PREALLOCATED;
+    band->dst.flags = dst->flags | SDL_SURFACE_PREALLOCATED;
+
+    // Palettes are reference counted, so share them before any threads see the bands
+    if ((src->palette && !SDL_SetSurfacePalette(&band->src, src->palette)) ||
+        (dst->palette && !SDL_SetSurfacePalette(&band->dst, dst->palette))) {
+        return false;
+    }
+    SDL_SetSurfaceBlendMode(&band->src, SDL_BLENDMODE_NONE);
+
+    // Build the blit mapping up front, so the conversion threads only read it
+    return SDL_ValidateMap(&band->src, &band->dst);
+}
+
+static void SDL_ConvertBand(SDL_ConversionBand *band)
+{
+    SDL_Rect rect;
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = band->src.w;
+    rect.h = band->src.h;
+    band->result = SDL_BlitSurfaceUnchecked(&band->src, &rect, &band->dst, &rect);
+    if (!band->result) {
+        SDL_strlcpy(band->error, SDL_GetError(), sizeof(band->error));
+    }
+}
+
+// Claim the next band of a queued batch, this is called with SDL_conversion_threads.lock held
+static SDL_ConversionBand *SDL_ClaimConversionBand(SDL_ConversionBatch *batch)
+{
+    SDL_ConversionBand *band = &batch->bands[batch->next_band++];
+
+    if (batch->next_band == batch->num_bands) {
+        // Nothing left to claim, take it off the queue
+        SDL_ConversionBatch **prev = &SDL_conversion_threads.batches;
+        while (*prev != batch) {
+            prev = &(*prev)->next;
+        }
+        *prev = batch->next;
+    }
+    return band;
+}
+
+static int SDLCALL SDL_ConversionThread(void *data)
+{
+    SDL_LockMutex(SDL_conversion_threads.lock);
+    while (!SDL_conversion_threads.shutdown) {
+        SDL_ConversionBatch *batch = SDL_conversion_threads.batches;
+        SDL_ConversionBand *band;
+
+        if (!batch) {
+            SDL_WaitCondition(SDL_conversion_threads.cond, SDL_conversion_threads.lock);
+            continue;
+        }
+
+        // The batch stays alive until its last band is done, so it's safe to use without the lock
+        band = SDL_ClaimConversionBand(batch);
+        SDL_UnlockMutex(SDL_conversion_threads.lock);
+        SDL_ConvertBand(band);
+        SDL_LockMutex(SDL_conversion_threads.lock);
+
+        if (--batch->bands_left == 0) {
+            SDL_BroadcastCondition(SDL_conversion_threads.done_cond);
+        }
+    }
+    SDL_UnlockMutex(SDL_conversion_threads.lock);
+    return 0;
+}
+
+static void SDL_CleanupConversionThreads(void)
+{
+    int i;
+
+    if (SDL_conversion_threads.lock) {
+        SDL_LockMutex(SDL_conversion_threads.lock);
+        SDL_conversion_threads.shutdown = true;
+        SDL_BroadcastCondition(SDL_conversion_threads.cond);
+        SDL_UnlockMutex(SDL_conversion_threads.lock);
+    }
+
+    for (i = 0; i < SDL_conversion_threads.num_threads; ++i) {
+        SDL_WaitThread(SDL_conversion_threads.threads[i], NULL);
+    }
+
+    SDL_assert(SDL_conversion_threads.batches == NULL);
+
+    SDL_free(SDL_conversion_threads.threads);
+    SDL_DestroyCondition(SDL_conversion_threads.done_cond);
+    SDL_DestroyCondition(SDL_conversion_threads.cond);
+    SDL_DestroyMutex(SDL_conversion_threads.lock);
+    SDL_conversion_threads.threads = NULL;
+    SDL_conversion_threads.num_threads = 0;
+    SDL_conversion_threads.done_cond = NULL;
+    SDL_conversion_threads.cond = NULL;
+    SDL_conversion_threads.lock = NULL;
+    SDL_conversion_threads.shutdown = false;
+}
+
+// Start the conversion threads if they haven't been, returns false if there aren't any
+static bool SDL_InitConversionThreads(int num_bands)
+{
+    if (SDL_ShouldInit(&SDL_conversion_threads.init)) {
+        const int num_threads = SDL_min(SDL_max(num_bands, SDL_GetNumLogicalCPUCores()) - 1, SDL_MAX_CONVERSION_THREADS);
+        int i;
+
+        SDL_conversion_threads.lock = SDL_CreateMutex();
+        SDL_conversion_threads.cond = SDL_CreateCondition();
+        SDL_conversion_threads.done_cond = SDL_CreateCondition();
+        SDL_conversion_threads.threads = (SDL_Thread **)SDL_calloc(SDL_max(num_threads, 1), sizeof(SDL_Thread *));
+        if (SDL_conversion_threads.lock && SDL_conversion_threads.cond &&
+            SDL_conversion_threads.done_cond && SDL_conversion_threads.threads) {
+            for (i = 0; i < num_threads; ++i) {
+                char name[64];
+                SDL_Thread *thread;
+
+                (void)SDL_snprintf(name, sizeof(name), "SDLConvert%d", i);
+                thread = SDL_CreateThread(SDL_ConversionThread, name, NULL);
+                if (!thread) {
+                    break;
+                }
+                SDL_conversion_threads.threads[SDL_conversion_threads.num_threads++] = thread;
+            }
+        }
+        if (SDL_conversion_threads.num_threads == 0) {
+            // Conversions will be done on the calling thread, try again after SDL_Quit()
+            SDL_CleanupConversionThreads();
+        }
+        SDL_SetInitialized(&SDL_conversion_threads.init, true);
+    }
+    return SDL_conversion_threads.num_threads > 0;
+}
+
+void SDL_QuitSurfaceConversionThreads(void)
+{
+    if (!SDL_ShouldQuit(&SDL_conversion_threads.init)) {
+        return;
+    }
+
+    SDL_CleanupConversionThreads();
+
+    SDL_SetInitialized(&SDL_conversion_threads.init, false);
+}
+
+// Convert the bands, sharing them with the conversion threads if there are any
+static void SDL_ConvertBands(SDL_ConversionBand *bands, int num_bands)
+{
+    SDL_ConversionBatch batch;
+    SDL_ConversionBatch **tail;
+    int i;
+
+    if (!SDL_InitConversionThreads(num_bands)) {
+        for (i = 0; i < num_bands; ++i) {
+            SDL_ConvertBand(&bands[i]);
+        }
+        return;
+    }
+
+    batch.bands = bands;
+    batch.num_bands = num_bands;
+    batch.next_band = 0;
+    batch.bands_left = num_bands;
+    batch.next = NULL;
+
+    SDL_LockMutex(SDL_conversion_threads.lock);
+    tail = &SDL_conversion_threads.batches;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+    *tail = &batch;
+    SDL_BroadcastCondition(SDL_conversion_threads.cond);
+
+    // Help out with whatever the threads haven't gotten to yet, then wait for the rest to finish
+    while (batch.next_band < batch.num_bands) {
+        SDL_ConversionBand *band = SDL_ClaimConversionBand(&batch);
+        SDL_UnlockMutex(SDL_conversion_threads.lock);
+        SDL_ConvertBand(band);
+        SDL_LockMutex(SDL_conversion_threads.lock);
+        --batch.bands_left;
+    }
+    while (batch.bands_left > 0) {
+        SDL_WaitCondition(SDL_conversion_threads.done_cond, SDL_conversion_threads.lock);
+    }
+    SDL_UnlockMutex(SDL_conversion_threads.lock);
+}
+
+/* Copy src to dst, which have the same size, without blending. When enabled with
+ * SDL_HINT_SURFACE_CONVERSION_THREADS, the image is split into horizontal bands
+ * that are converted in parallel. Each band gets its own blit mapping, so the
+ * result is the same as converting the whole image at once.
+ */
+static bool SDL_ConvertSurfacePixels(SDL_Surface *src, SDL_Surface *dst)
+{
+    SDL_ConversionBand *bands;
+    SDL_Rect rect;
+    int num_bands, band_height;
+    int i;
+    bool result = true;
+
+    num_bands = GetConversionBandCount(src->w, src->h);
+    if (num_bands > 1 && !SDL_MUSTLOCK(src) && !SDL_MUSTLOCK(dst)) {
+        const Uint8 *src_start = (const Uint8 *)src->pixels;
+        const Uint8 *src_end = src_start + (size_t)src->h * src->pitch;
+        const Uint8 *dst_start = (const Uint8 *)dst->pixels;
+        const Uint8 *dst_end = dst_start + (size_t)dst->h * dst->pitch;
+
+        // Bands can't be converted independently in place
+        if (src_start < dst_end && dst_start < src_end) {
+            num_bands = 1;
+        }
+    } else {
+        num_bands = 1;
+    }
+
+    if (num_bands == 1) {
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = src->w;
+        rect.h = src->h;
+        return SDL_BlitSurfaceUnchecked(src, &rect, dst, &rect);
+    }
+
+    bands = (SDL_ConversionBand *)SDL_calloc(num_bands, sizeof(*bands));
+    if (!bands) {
+        return false;
+    }
+
+    band_height = (src->h + num_bands - 1) / num_bands;
+    for (i = 0; i < num_bands && result; ++i) {
+        const int y = i * band_height;
+        const int h = SDL_min(band_height, src->h - y);
+
+        if (h <= 0) {
+            num_bands = i;
+            break;
+        }
+        result = SDL_InitializeConversionBand(&bands[i], src, dst, y, h);
+    }
+
+    if (result) {
+        SDL_ConvertBands(bands, num_bands);
+
+        for (i = 0; i < num_bands; ++i) {
+            if (!bands[i].result) {
+                SDL_SetError("%s", bands[i].error);
+                result = false;
+                break;
+            }
+        }
+    }
+
+    for (i = 0; i < num_bands; ++i) {
+        if (bands[i].initialized) {
+            SDL_DestroySurface(&bands[i].src);
+            SDL_DestroySurface(&bands[i].dst);
+        }
+    }
+    SDL_free(bands);
+
+    return result;
+}
+
 SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelFormat format, SDL_Palette *palette, SDL_Colorspace colorspace, SDL_PropertiesID props)
 {
     SDL_Palette *temp_palette = NULL;
@@ -1892,7 +2228,6 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
     SDL_PropertiesID src_properties;
     Uint32 copy_flags;
     SDL_Color copy_color;
-    SDL_Rect bounds;
     bool result;
     bool palette_ck_transform = false;
     Uint8 palette_ck_value = 0;
@@ -1982,12 +2317,6 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
     surface->map.info.flags = (copy_flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY));
     SDL_InvalidateMap(&surface->map);
 
-    // Copy over the image data
-    bounds.x = 0;
-    bounds.y = 0;
-    bounds.w = surface->w;
-    bounds.h = surface->h;
-
     /* Source surface has a palette with no real alpha (0 or OPAQUE).
      * Destination format has alpha.
      * -> set alpha channel to be opaque */
@@ -2026,7 +2355,8 @@ SDL_Surface *SDL_ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelForm
         }
     }
 
-    result = SDL_BlitSurfaceUnchecked(surface, &bounds, convert, &bounds);
+    // Copy over the image data
+    result = SDL_ConvertSurfacePixels(surface, convert);
 
     // Restore colorkey alpha value
     if (palette_ck_transform) {
@@ -2296,7 +2626,6 @@ bool SDL_ConvertPixelsAndColorspace(int width, int height,
 {
     SDL_Surface src_surface;
     SDL_Surface dst_surface;
-    SDL_Rect rect;
     void *nonconst_src = (void *)src;
     bool result;
 
@@ -2364,12 +2693,7 @@ bool SDL_ConvertPixelsAndColorspace(int width, int height,
         return false;
     }
 
-    // Set up the rect and go!
-    rect.x = 0;
-    rect.y = 0;
-    rect.w = width;
-    rect.h = height;
-    result = SDL_BlitSurfaceUnchecked(&src_surface, &rect, &dst_surface, &rect);
+    result = SDL_ConvertSurfacePixels(&src_surface, &dst_surface);
 
     SDL_DestroySurface(&src_surface);
     SDL_DestroySurface(&dst_surface);
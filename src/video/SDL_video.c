@@ -5518,11 +5518,13 @@ bool SDL_GetTextInputAutocorrect(SDL_PropertiesID props)
 
 bool SDL_GetTextInputMultiline(SDL_PropertiesID props)
 {
+    static SDL_HintCache return_key_hides_ime;
+
     if (SDL_HasProperty(props, SDL_PROP_TEXTINPUT_MULTILINE_BOOLEAN)) {
         return SDL_GetBooleanProperty(props, SDL_PROP_TEXTINPUT_MULTILINE_BOOLEAN, false);
     }
 
-    if (SDL_GetHintBoolean(SDL_HINT_RETURN_KEY_HIDES_IME, false)) {
+    if (SDL_GetCachedHintBoolean(SDL_HINT_RETURN_KEY_HIDES_IME, false, &return_key_hides_ime)) {
         return false;
     } else {
         return true;
@@ -5852,7 +5854,9 @@ bool SDL_ShowSimpleMessageBox(SDL_MessageBoxFlags flags, const char *title, cons
 
 bool SDL_ShouldAllowTopmost(void)
 {
-    return SDL_GetHintBoolean(SDL_HINT_WINDOW_ALLOW_TOPMOST, true);
+    static SDL_HintCache allow_topmost;
+
+    return SDL_GetCachedHintBoolean(SDL_HINT_WINDOW_ALLOW_TOPMOST, true, &allow_topmost);
 }
 
 bool SDL_ShowWindowSystemMenu(SDL_Window *window, int x, int y)
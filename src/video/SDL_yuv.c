@@ -670,89 +670,659 @@ bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
     return SDL_SetError("Unsupported YUV conversion");
 }
 
+// RGB to YUV factors are stored in 2.14 fixed point, so the scalar and SIMD paths produce identical results
+#define RGB2YUV_SHIFT 14
+#define RGB2YUV_ROUND (1 << (RGB2YUV_SHIFT - 1))
+#define RGB2YUV_FIXED(x) (Sint16)((x) * (1 << RGB2YUV_SHIFT) + (((x) < 0.0f) ? -0.5f : 0.5f))
+
 struct RGB2YUVFactors
 {
     int y_offset;
-    float y[3]; // Rfactor, Gfactor, Bfactor
-    float u[3]; // Rfactor, Gfactor, Bfactor
-    float v[3]; // Rfactor, Gfactor, Bfactor
+    Sint16 y[3]; // Rfactor, Gfactor, Bfactor
+    Sint16 u[3]; // Rfactor, Gfactor, Bfactor
+    Sint16 v[3]; // Rfactor, Gfactor, Bfactor
 };
 
-static struct RGB2YUVFactors RGB2YUVFactorTables[] = {
+static const struct RGB2YUVFactors RGB2YUVFactorTables[] = {
     // ITU-T T.871 (JPEG)
     {
         0,
-        { 0.2990f, 0.5870f, 0.1140f },
-        { -0.1687f, -0.3313f, 0.5000f },
-        { 0.5000f, -0.4187f, -0.0813f },
+        { RGB2YUV_FIXED(0.2990f), RGB2YUV_FIXED(0.5870f), RGB2YUV_FIXED(0.1140f) },
+        { RGB2YUV_FIXED(-0.1687f), RGB2YUV_FIXED(-0.3313f), RGB2YUV_FIXED(0.5000f) },
+        { RGB2YUV_FIXED(0.5000f), RGB2YUV_FIXED(-0.4187f), RGB2YUV_FIXED(-0.0813f) },
     },
     // ITU-R BT.601-7
     {
         16,
-        { 0.2568f, 0.5041f, 0.0979f },
-        { -0.1482f, -0.2910f, 0.4392f },
-        { 0.4392f, -0.3678f, -0.0714f },
+        { RGB2YUV_FIXED(0.2568f), RGB2YUV_FIXED(0.5041f), RGB2YUV_FIXED(0.0979f) },
+        { RGB2YUV_FIXED(-0.1482f), RGB2YUV_FIXED(-0.2910f), RGB2YUV_FIXED(0.4392f) },
+        { RGB2YUV_FIXED(0.4392f), RGB2YUV_FIXED(-0.3678f), RGB2YUV_FIXED(-0.0714f) },
     },
     // ITU-R BT.709-6 full range
     {
         0,
-        { 0.2126f, 0.7152f, 0.0722f },
-        { -0.1141f, -0.3839f, 0.498f },
-        { 0.498f, -0.4524f, -0.0457f },
+        { RGB2YUV_FIXED(0.2126f), RGB2YUV_FIXED(0.7152f), RGB2YUV_FIXED(0.0722f) },
+        { RGB2YUV_FIXED(-0.1141f), RGB2YUV_FIXED(-0.3839f), RGB2YUV_FIXED(0.498f) },
+        { RGB2YUV_FIXED(0.498f), RGB2YUV_FIXED(-0.4524f), RGB2YUV_FIXED(-0.0457f) },
     },
     // ITU-R BT.709-6
     {
         16,
-        { 0.1826f, 0.6142f, 0.0620f },
-        { -0.1006f, -0.3386f, 0.4392f },
-        { 0.4392f, -0.3989f, -0.0403f },
+        { RGB2YUV_FIXED(0.1826f), RGB2YUV_FIXED(0.6142f), RGB2YUV_FIXED(0.0620f) },
+        { RGB2YUV_FIXED(-0.1006f), RGB2YUV_FIXED(-0.3386f), RGB2YUV_FIXED(0.4392f) },
+        { RGB2YUV_FIXED(0.4392f), RGB2YUV_FIXED(-0.3989f), RGB2YUV_FIXED(-0.0403f) },
     },
     // ITU-R BT.2020 10-bit full range
     {
         0,
-        { 0.2627f, 0.6780f, 0.0593f },
-        { -0.1395f, -0.3600f, 0.4995f },
-        { 0.4995f, -0.4593f, -0.0402f },
+        { RGB2YUV_FIXED(0.2627f), RGB2YUV_FIXED(0.6780f), RGB2YUV_FIXED(0.0593f) },
+        { RGB2YUV_FIXED(-0.1395f), RGB2YUV_FIXED(-0.3600f), RGB2YUV_FIXED(0.4995f) },
+        { RGB2YUV_FIXED(0.4995f), RGB2YUV_FIXED(-0.4593f), RGB2YUV_FIXED(-0.0402f) },
     },
 };
 
+static SDL_INLINE int RGB2YUV_Dot(const Sint16 *factors, int r, int g, int b)
+{
+    return (factors[0] * r + factors[1] * g + factors[2] * b + RGB2YUV_ROUND) >> RGB2YUV_SHIFT;
+}
+
+#define MAKE_Y8(r, g, b) (Uint8)SDL_clamp(RGB2YUV_Dot(cvt->y, r, g, b) + cvt->y_offset, 0, 255)
+#define MAKE_U8(r, g, b) (Uint8)SDL_clamp(RGB2YUV_Dot(cvt->u, r, g, b) + 128, 0, 255)
+#define MAKE_V8(r, g, b) (Uint8)SDL_clamp(RGB2YUV_Dot(cvt->v, r, g, b) + 128, 0, 255)
+
+#define MAKE_Y10(r, g, b) (Uint16)(SDL_clamp(RGB2YUV_Dot(cvt->y, r, g, b) + cvt->y_offset, 0, 1023) << 6)
+#define MAKE_U10(r, g, b) (Uint16)(SDL_clamp(RGB2YUV_Dot(cvt->u, r, g, b) + 512, 0, 1023) << 6)
+#define MAKE_V10(r, g, b) (Uint16)(SDL_clamp(RGB2YUV_Dot(cvt->v, r, g, b) + 512, 0, 1023) << 6)
+
+/* The row converters below take a count of pixels (or of horizontal pixel pairs for the
+ * chroma planes) and return how many they handled. The SIMD versions stop at the last
+ * full vector and leave the remainder to the scalar versions, which handle any count.
+ *
+ * Chroma is the floor of the average of each 2x2 block, so a 1x2, 2x1 or 1x1 block at
+ * the right or bottom edge can be handled by passing the same row or pixel twice.
+ */
+typedef int (*XRGB8888_to_Y_Func)(const Uint32 *src, Uint8 *dst, int count, const struct RGB2YUVFactors *cvt);
+typedef int (*XRGB8888_to_UV_Func)(const Uint32 *src0, const Uint32 *src1, Uint8 *dst_u, Uint8 *dst_v, int uv_step, int count, const struct RGB2YUVFactors *cvt);
+typedef int (*XBGR2101010_to_Y_Func)(const Uint32 *src, Uint16 *dst, int count, const struct RGB2YUVFactors *cvt);
+typedef int (*XBGR2101010_to_UV_Func)(const Uint32 *src0, const Uint32 *src1, Uint16 *dst_uv, int count, const struct RGB2YUVFactors *cvt);
+
+typedef struct RGB2YUVFuncs
+{
+    XRGB8888_to_Y_Func XRGB8888_to_Y;
+    XRGB8888_to_UV_Func XRGB8888_to_UV;
+    XBGR2101010_to_Y_Func XBGR2101010_to_Y;
+    XBGR2101010_to_UV_Func XBGR2101010_to_UV;
+} RGB2YUVFuncs;
+
+static int XRGB8888_to_Y_std(const Uint32 *src, Uint8 *dst, int count, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const Uint32 p = src[i];
+        const Uint32 r = (p & 0x00ff0000) >> 16;
+        const Uint32 g = (p & 0x0000ff00) >> 8;
+        const Uint32 b = (p & 0x000000ff);
+        dst[i] = MAKE_Y8(r, g, b);
+    }
+    return count;
+}
+
+static void XRGB8888_to_UV_2x2(Uint32 p1, Uint32 p2, Uint32 p3, Uint32 p4, Uint8 *dst_u, Uint8 *dst_v, const struct RGB2YUVFactors *cvt)
+{
+    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18;
+    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10;
+    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2;
+    *dst_u = MAKE_U8(r, g, b);
+    *dst_v = MAKE_V8(r, g, b);
+}
+
+static int XRGB8888_to_UV_std(const Uint32 *src0, const Uint32 *src1, Uint8 *dst_u, Uint8 *dst_v, int uv_step, int count, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        XRGB8888_to_UV_2x2(src0[2 * i], src0[2 * i + 1], src1[2 * i], src1[2 * i + 1], dst_u, dst_v, cvt);
+        dst_u += uv_step;
+        dst_v += uv_step;
+    }
+    return count;
+}
+
+static int XBGR2101010_to_Y_std(const Uint32 *src, Uint16 *dst, int count, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const Uint32 p = src[i];
+        const Uint32 r = (p >> 0) & 0x03ff;
+        const Uint32 g = (p >> 10) & 0x03ff;
+        const Uint32 b = (p >> 20) & 0x03ff;
+        dst[i] = MAKE_Y10(r, g, b);
+    }
+    return count;
+}
+
+static void XBGR2101010_to_UV_2x2(Uint32 p1, Uint32 p2, Uint32 p3, Uint32 p4, Uint16 *dst_uv, const struct RGB2YUVFactors *cvt)
+{
+    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff) + (p3 & 0x000003ff) + (p4 & 0x000003ff)) >> 2;
+    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00) + (p3 & 0x000ffc00) + (p4 & 0x000ffc00)) >> 12;
+    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000) + (p3 & 0x3ff00000) + (p4 & 0x3ff00000)) >> 22;
+    dst_uv[0] = MAKE_U10(r, g, b);
+    dst_uv[1] = MAKE_V10(r, g, b);
+}
+
+static int XBGR2101010_to_UV_std(const Uint32 *src0, const Uint32 *src1, Uint16 *dst_uv, int count, const struct RGB2YUVFactors *cvt)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        XBGR2101010_to_UV_2x2(src0[2 * i], src0[2 * i + 1], src1[2 * i], src1[2 * i + 1], dst_uv, cvt);
+        dst_uv += 2;
+    }
+    return count;
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+#define RGB2YUV_SHUFFLE_EVEN_SSE2(a, b) _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(2, 0, 2, 0)))
+#define RGB2YUV_SHUFFLE_ODD_SSE2(a, b)  _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), _MM_SHUFFLE(3, 1, 3, 1)))
+
+/* Pixels are split into a pair of 16-bit channels and a (channel, 1) pair in each 32-bit
+ * lane, so that _mm_madd_epi16() against matching factor pairs yields the rounded dot
+ * product in one step.
+ */
+static SDL_INLINE __m128i SDL_TARGETING("sse2") RGB2YUV_FactorPair_SSE2(Sint16 lo, Sint16 hi)
+{
+    return _mm_set1_epi32((int)(((Uint32)(Uint16)hi << 16) | (Uint16)lo));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") RGB2YUV_Dot_SSE2(__m128i pair, __m128i single, __m128i pair_factors, __m128i single_factors)
+{
+    const __m128i sum = _mm_add_epi32(_mm_madd_epi16(pair, pair_factors), _mm_madd_epi16(single, single_factors));
+    return _mm_srai_epi32(sum, RGB2YUV_SHIFT);
+}
+
+// Averages 2x4 XRGB8888 pixels into 4 (B, R) and (G, 1) lanes
+static SDL_INLINE void SDL_TARGETING("sse2") XRGB8888_Average2x2_SSE2(const Uint32 *src0, const Uint32 *src1, __m128i *br, __m128i *g1)
+{
+    const __m128i br_mask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i g_mask = _mm_set1_epi32(0x000000ff);
+    const __m128i a0 = _mm_loadu_si128((const __m128i *)src0);
+    const __m128i a1 = _mm_loadu_si128((const __m128i *)(src0 + 4));
+    const __m128i b0 = _mm_loadu_si128((const __m128i *)src1);
+    const __m128i b1 = _mm_loadu_si128((const __m128i *)(src1 + 4));
+    const __m128i br0 = _mm_add_epi16(_mm_and_si128(a0, br_mask), _mm_and_si128(b0, br_mask));
+    const __m128i br1 = _mm_add_epi16(_mm_and_si128(a1, br_mask), _mm_and_si128(b1, br_mask));
+    const __m128i g0 = _mm_add_epi16(_mm_and_si128(_mm_srli_epi32(a0, 8), g_mask), _mm_and_si128(_mm_srli_epi32(b0, 8), g_mask));
+    const __m128i g_1 = _mm_add_epi16(_mm_and_si128(_mm_srli_epi32(a1, 8), g_mask), _mm_and_si128(_mm_srli_epi32(b1, 8), g_mask));
+
+    *br = _mm_srli_epi16(_mm_add_epi16(RGB2YUV_SHUFFLE_EVEN_SSE2(br0, br1), RGB2YUV_SHUFFLE_ODD_SSE2(br0, br1)), 2);
+    *g1 = _mm_or_si128(_mm_srli_epi16(_mm_add_epi16(RGB2YUV_SHUFFLE_EVEN_SSE2(g0, g_1), RGB2YUV_SHUFFLE_ODD_SSE2(g0, g_1)), 2), _mm_set1_epi32(0x00010000));
+}
+
+// Averages 2x4 XBGR2101010 pixels into 4 (R, B) and (G, 1) lanes
+static SDL_INLINE void SDL_TARGETING("sse2") XBGR2101010_Average2x2_SSE2(const Uint32 *src0, const Uint32 *src1, __m128i *rb, __m128i *g1)
+{
+    const __m128i r_mask = _mm_set1_epi32(0x000003ff);
+    const __m128i b_mask = _mm_set1_epi32(0x03ff0000);
+    const __m128i a0 = _mm_loadu_si128((const __m128i *)src0);
+    const __m128i a1 = _mm_loadu_si128((const __m128i *)(src0 + 4));
+    const __m128i b0 = _mm_loadu_si128((const __m128i *)src1);
+    const __m128i b1 = _mm_loadu_si128((const __m128i *)(src1 + 4));
+    const __m128i rb0 = _mm_add_epi16(_mm_or_si128(_mm_and_si128(a0, r_mask), _mm_and_si128(_mm_srli_epi32(a0, 4), b_mask)),
+                                      _mm_or_si128(_mm_and_si128(b0, r_mask), _mm_and_si128(_mm_srli_epi32(b0, 4), b_mask)));
+    const __m128i rb1 = _mm_add_epi16(_mm_or_si128(_mm_and_si128(a1, r_mask), _mm_and_si128(_mm_srli_epi32(a1, 4), b_mask)),
+                                      _mm_or_si128(_mm_and_si128(b1, r_mask), _mm_and_si128(_mm_srli_epi32(b1, 4), b_mask)));
+    const __m128i g0 = _mm_add_epi16(_mm_and_si128(_mm_srli_epi32(a0, 10), r_mask), _mm_and_si128(_mm_srli_epi32(b0, 10), r_mask));
+    const __m128i g_1 = _mm_add_epi16(_mm_and_si128(_mm_srli_epi32(a1, 10), r_mask), _mm_and_si128(_mm_srli_epi32(b1, 10), r_mask));
+
+    *rb = _mm_srli_epi16(_mm_add_epi16(RGB2YUV_SHUFFLE_EVEN_SSE2(rb0, rb1), RGB2YUV_SHUFFLE_ODD_SSE2(rb0, rb1)), 2);
+    *g1 = _mm_or_si128(_mm_srli_epi16(_mm_add_epi16(RGB2YUV_SHUFFLE_EVEN_SSE2(g0, g_1), RGB2YUV_SHUFFLE_ODD_SSE2(g0, g_1)), 2), _mm_set1_epi32(0x00010000));
+}
+
+// Stores 8 Y values, given as 16-bit lanes without the offset applied
+static SDL_INLINE void SDL_TARGETING("sse2") RGB2YUV_StoreY8_SSE2(__m128i y, Uint8 *dst, const struct RGB2YUVFactors *cvt)
+{
+    y = _mm_adds_epi16(y, _mm_set1_epi16((short)cvt->y_offset));
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(y, y));
+}
+
+static SDL_INLINE void SDL_TARGETING("sse2") RGB2YUV_StoreUV8_SSE2(__m128i u, __m128i v, Uint8 *dst_u, Uint8 *dst_v, int uv_step)
+{
+    const __m128i offset = _mm_set1_epi16(128);
+
+    u = _mm_adds_epi16(u, offset);
+    v = _mm_adds_epi16(v, offset);
+    u = _mm_packus_epi16(u, u);
+    v = _mm_packus_epi16(v, v);
+    if (uv_step == 1) {
+        _mm_storel_epi64((__m128i *)dst_u, u);
+        _mm_storel_epi64((__m128i *)dst_v, v);
+    } else if (dst_u < dst_v) {
+        _mm_storeu_si128((__m128i *)dst_u, _mm_unpacklo_epi8(u, v));
+    } else {
+        _mm_storeu_si128((__m128i *)dst_v, _mm_unpacklo_epi8(v, u));
+    }
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") RGB2YUV_Clamp10_SSE2(__m128i x, int offset)
+{
+    x = _mm_adds_epi16(x, _mm_set1_epi16((short)offset));
+    x = _mm_min_epi16(_mm_max_epi16(x, _mm_setzero_si128()), _mm_set1_epi16(1023));
+    return _mm_slli_epi16(x, 6);
+}
+
+static SDL_INLINE void SDL_TARGETING("sse2") RGB2YUV_StoreUV10_SSE2(__m128i u, __m128i v, Uint16 *dst_uv)
+{
+    u = RGB2YUV_Clamp10_SSE2(u, 512);
+    v = RGB2YUV_Clamp10_SSE2(v, 512);
+    _mm_storeu_si128((__m128i *)dst_uv, _mm_unpacklo_epi16(u, v));
+    _mm_storeu_si128((__m128i *)(dst_uv + 8), _mm_unpackhi_epi16(u, v));
+}
+
+static int SDL_TARGETING("sse2") XRGB8888_to_Y_SSE2(const Uint32 *src, Uint8 *dst, int count, const struct RGB2YUVFactors *cvt)
+{
+    const __m128i br_mask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i g_mask = _mm_set1_epi32(0x000000ff);
+    const __m128i one = _mm_set1_epi32(0x00010000);
+    const __m128i br_factors = RGB2YUV_FactorPair_SSE2(cvt->y[2], cvt->y[0]);
+    const __m128i g1_factors = RGB2YUV_FactorPair_SSE2(cvt->y[1], RGB2YUV_ROUND);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        const __m128i p0 = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i p1 = _mm_loadu_si128((const __m128i *)(src + i + 4));
+        const __m128i y0 = RGB2YUV_Dot_SSE2(_mm_and_si128(p0, br_mask), _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p0, 8), g_mask), one), br_factors, g1_factors);
+        const __m128i y1 = RGB2YUV_Dot_SSE2(_mm_and_si128(p1, br_mask), _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p1, 8), g_mask), one), br_factors, g1_factors);
+        RGB2YUV_StoreY8_SSE2(_mm_packs_epi32(y0, y1), dst + i, cvt);
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse2") XRGB8888_to_UV_SSE2(const Uint32 *src0, const Uint32 *src1, Uint8 *dst_u, Uint8 *dst_v, int uv_step, int count, const struct RGB2YUVFactors *cvt)
+{
+    const __m128i u_br_factors = RGB2YUV_FactorPair_SSE2(cvt->u[2], cvt->u[0]);
+    const __m128i u_g1_factors = RGB2YUV_FactorPair_SSE2(cvt->u[1], RGB2YUV_ROUND);
+    const __m128i v_br_factors = RGB2YUV_FactorPair_SSE2(cvt->v[2], cvt->v[0]);
+    const __m128i v_g1_factors = RGB2YUV_FactorPair_SSE2(cvt->v[1], RGB2YUV_ROUND);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m128i br0, g10, br1, g11;
+        XRGB8888_Average2x2_SSE2(src0 + 2 * i, src1 + 2 * i, &br0, &g10);
+        XRGB8888_Average2x2_SSE2(src0 + 2 * i + 8, src1 + 2 * i + 8, &br1, &g11);
+        RGB2YUV_StoreUV8_SSE2(_mm_packs_epi32(RGB2YUV_Dot_SSE2(br0, g10, u_br_factors, u_g1_factors), RGB2YUV_Dot_SSE2(br1, g11, u_br_factors, u_g1_factors)),
+                              _mm_packs_epi32(RGB2YUV_Dot_SSE2(br0, g10, v_br_factors, v_g1_factors), RGB2YUV_Dot_SSE2(br1, g11, v_br_factors, v_g1_factors)),
+                              dst_u + i * uv_step, dst_v + i * uv_step, uv_step);
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse2") XBGR2101010_to_Y_SSE2(const Uint32 *src, Uint16 *dst, int count, const struct RGB2YUVFactors *cvt)
+{
+    const __m128i r_mask = _mm_set1_epi32(0x000003ff);
+    const __m128i b_mask = _mm_set1_epi32(0x03ff0000);
+    const __m128i one = _mm_set1_epi32(0x00010000);
+    const __m128i rb_factors = RGB2YUV_FactorPair_SSE2(cvt->y[0], cvt->y[2]);
+    const __m128i g1_factors = RGB2YUV_FactorPair_SSE2(cvt->y[1], RGB2YUV_ROUND);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        const __m128i p0 = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i p1 = _mm_loadu_si128((const __m128i *)(src + i + 4));
+        const __m128i y0 = RGB2YUV_Dot_SSE2(_mm_or_si128(_mm_and_si128(p0, r_mask), _mm_and_si128(_mm_srli_epi32(p0, 4), b_mask)),
+                                            _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p0, 10), r_mask), one), rb_factors, g1_factors);
+        const __m128i y1 = RGB2YUV_Dot_SSE2(_mm_or_si128(_mm_and_si128(p1, r_mask), _mm_and_si128(_mm_srli_epi32(p1, 4), b_mask)),
+                                            _mm_or_si128(_mm_and_si128(_mm_srli_epi32(p1, 10), r_mask), one), rb_factors, g1_factors);
+        _mm_storeu_si128((__m128i *)(dst + i), RGB2YUV_Clamp10_SSE2(_mm_packs_epi32(y0, y1), cvt->y_offset));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("sse2") XBGR2101010_to_UV_SSE2(const Uint32 *src0, const Uint32 *src1, Uint16 *dst_uv, int count, const struct RGB2YUVFactors *cvt)
+{
+    const __m128i u_rb_factors = RGB2YUV_FactorPair_SSE2(cvt->u[0], cvt->u[2]);
+    const __m128i u_g1_factors = RGB2YUV_FactorPair_SSE2(cvt->u[1], RGB2YUV_ROUND);
+    const __m128i v_rb_factors = RGB2YUV_FactorPair_SSE2(cvt->v[0], cvt->v[2]);
+    const __m128i v_g1_factors = RGB2YUV_FactorPair_SSE2(cvt->v[1], RGB2YUV_ROUND);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m128i rb0, g10, rb1, g11;
+        XBGR2101010_Average2x2_SSE2(src0 + 2 * i, src1 + 2 * i, &rb0, &g10);
+        XBGR2101010_Average2x2_SSE2(src0 + 2 * i + 8, src1 + 2 * i + 8, &rb1, &g11);
+        RGB2YUV_StoreUV10_SSE2(_mm_packs_epi32(RGB2YUV_Dot_SSE2(rb0, g10, u_rb_factors, u_g1_factors), RGB2YUV_Dot_SSE2(rb1, g11, u_rb_factors, u_g1_factors)),
+                               _mm_packs_epi32(RGB2YUV_Dot_SSE2(rb0, g10, v_rb_factors, v_g1_factors), RGB2YUV_Dot_SSE2(rb1, g11, v_rb_factors, v_g1_factors)),
+                               dst_uv + 2 * i);
+    }
+    return i;
+}
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+/* 256-bit packs and shuffles work within each 128-bit lane, so the results are put
+ * back in pixel order with a cross-lane permute of the 64-bit quarters.
+ */
+#define RGB2YUV_FIXUP_AVX2(x) _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 1, 2, 0))
+#define RGB2YUV_SHUFFLE_EVEN_AVX2(a, b) _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(2, 0, 2, 0)))
+#define RGB2YUV_SHUFFLE_ODD_AVX2(a, b)  _mm256_castps_si256(_mm256_shuffle_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _MM_SHUFFLE(3, 1, 3, 1)))
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") RGB2YUV_FactorPair_AVX2(Sint16 lo, Sint16 hi)
+{
+    return _mm256_set1_epi32((int)(((Uint32)(Uint16)hi << 16) | (Uint16)lo));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") RGB2YUV_Dot_AVX2(__m256i pair, __m256i single, __m256i pair_factors, __m256i single_factors)
+{
+    const __m256i sum = _mm256_add_epi32(_mm256_madd_epi16(pair, pair_factors), _mm256_madd_epi16(single, single_factors));
+    return _mm256_srai_epi32(sum, RGB2YUV_SHIFT);
+}
+
+// Packs two vectors of 8 32-bit lanes into 16 16-bit lanes, in order
+static SDL_INLINE __m256i SDL_TARGETING("avx2") RGB2YUV_Pack_AVX2(__m256i a, __m256i b)
+{
+    return RGB2YUV_FIXUP_AVX2(_mm256_packs_epi32(a, b));
+}
+
+// Averages 2x16 XRGB8888 pixels into 8 (B, R) and (G, 1) lanes
+static SDL_INLINE void SDL_TARGETING("avx2") XRGB8888_Average2x2_AVX2(const Uint32 *src0, const Uint32 *src1, __m256i *br, __m256i *g1)
+{
+    const __m256i br_mask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i g_mask = _mm256_set1_epi32(0x000000ff);
+    const __m256i a0 = _mm256_loadu_si256((const __m256i *)src0);
+    const __m256i a1 = _mm256_loadu_si256((const __m256i *)(src0 + 8));
+    const __m256i b0 = _mm256_loadu_si256((const __m256i *)src1);
+    const __m256i b1 = _mm256_loadu_si256((const __m256i *)(src1 + 8));
+    const __m256i br0 = _mm256_add_epi16(_mm256_and_si256(a0, br_mask), _mm256_and_si256(b0, br_mask));
+    const __m256i br1 = _mm256_add_epi16(_mm256_and_si256(a1, br_mask), _mm256_and_si256(b1, br_mask));
+    const __m256i g0 = _mm256_add_epi16(_mm256_and_si256(_mm256_srli_epi32(a0, 8), g_mask), _mm256_and_si256(_mm256_srli_epi32(b0, 8), g_mask));
+    const __m256i g_1 = _mm256_add_epi16(_mm256_and_si256(_mm256_srli_epi32(a1, 8), g_mask), _mm256_and_si256(_mm256_srli_epi32(b1, 8), g_mask));
+    const __m256i br_sum = _mm256_add_epi16(RGB2YUV_SHUFFLE_EVEN_AVX2(br0, br1), RGB2YUV_SHUFFLE_ODD_AVX2(br0, br1));
+    const __m256i g_sum = _mm256_add_epi16(RGB2YUV_SHUFFLE_EVEN_AVX2(g0, g_1), RGB2YUV_SHUFFLE_ODD_AVX2(g0, g_1));
+
+    *br = RGB2YUV_FIXUP_AVX2(_mm256_srli_epi16(br_sum, 2));
+    *g1 = _mm256_or_si256(RGB2YUV_FIXUP_AVX2(_mm256_srli_epi16(g_sum, 2)), _mm256_set1_epi32(0x00010000));
+}
+
+// Averages 2x16 XBGR2101010 pixels into 8 (R, B) and (G, 1) lanes
+static SDL_INLINE void SDL_TARGETING("avx2") XBGR2101010_Average2x2_AVX2(const Uint32 *src0, const Uint32 *src1, __m256i *rb, __m256i *g1)
+{
+    const __m256i r_mask = _mm256_set1_epi32(0x000003ff);
+    const __m256i b_mask = _mm256_set1_epi32(0x03ff0000);
+    const __m256i a0 = _mm256_loadu_si256((const __m256i *)src0);
+    const __m256i a1 = _mm256_loadu_si256((const __m256i *)(src0 + 8));
+    const __m256i b0 = _mm256_loadu_si256((const __m256i *)src1);
+    const __m256i b1 = _mm256_loadu_si256((const __m256i *)(src1 + 8));
+    const __m256i rb0 = _mm256_add_epi16(_mm256_or_si256(_mm256_and_si256(a0, r_mask), _mm256_and_si256(_mm256_srli_epi32(a0, 4), b_mask)),
+                                         _mm256_or_si256(_mm256_and_si256(b0, r_mask), _mm256_and_si256(_mm256_srli_epi32(b0, 4), b_mask)));
+    const __m256i rb1 = _mm256_add_epi16(_mm256_or_si256(_mm256_and_si256(a1, r_mask), _mm256_and_si256(_mm256_srli_epi32(a1, 4), b_mask)),
+                                         _mm256_or_si256(_mm256_and_si256(b1, r_mask), _mm256_and_si256(_mm256_srli_epi32(b1, 4), b_mask)));
+    const __m256i g0 = _mm256_add_epi16(_mm256_and_si256(_mm256_srli_epi32(a0, 10), r_mask), _mm256_and_si256(_mm256_srli_epi32(b0, 10), r_mask));
+    const __m256i g_1 = _mm256_add_epi16(_mm256_and_si256(_mm256_srli_epi32(a1, 10), r_mask), _mm256_and_si256(_mm256_srli_epi32(b1, 10), r_mask));
+    const __m256i rb_sum = _mm256_add_epi16(RGB2YUV_SHUFFLE_EVEN_AVX2(rb0, rb1), RGB2YUV_SHUFFLE_ODD_AVX2(rb0, rb1));
+    const __m256i g_sum = _mm256_add_epi16(RGB2YUV_SHUFFLE_EVEN_AVX2(g0, g_1), RGB2YUV_SHUFFLE_ODD_AVX2(g0, g_1));
+
+    *rb = RGB2YUV_FIXUP_AVX2(_mm256_srli_epi16(rb_sum, 2));
+    *g1 = _mm256_or_si256(RGB2YUV_FIXUP_AVX2(_mm256_srli_epi16(g_sum, 2)), _mm256_set1_epi32(0x00010000));
+}
+
+static int SDL_TARGETING("avx2") XRGB8888_to_Y_AVX2(const Uint32 *src, Uint8 *dst, int count, const struct RGB2YUVFactors *cvt)
+{
+    const __m256i br_mask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i g_mask = _mm256_set1_epi32(0x000000ff);
+    const __m256i one = _mm256_set1_epi32(0x00010000);
+    const __m256i br_factors = RGB2YUV_FactorPair_AVX2(cvt->y[2], cvt->y[0]);
+    const __m256i g1_factors = RGB2YUV_FactorPair_AVX2(cvt->y[1], RGB2YUV_ROUND);
+    int i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        const __m256i p0 = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i p1 = _mm256_loadu_si256((const __m256i *)(src + i + 8));
+        const __m256i y0 = RGB2YUV_Dot_AVX2(_mm256_and_si256(p0, br_mask), _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(p0, 8), g_mask), one), br_factors, g1_factors);
+        const __m256i y1 = RGB2YUV_Dot_AVX2(_mm256_and_si256(p1, br_mask), _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(p1, 8), g_mask), one), br_factors, g1_factors);
+        const __m256i y = RGB2YUV_Pack_AVX2(y0, y1);
+        RGB2YUV_StoreY8_SSE2(_mm256_castsi256_si128(y), dst + i, cvt);
+        RGB2YUV_StoreY8_SSE2(_mm256_extracti128_si256(y, 1), dst + i + 8, cvt);
+    }
+    return i;
+}
+
+static int SDL_TARGETING("avx2") XRGB8888_to_UV_AVX2(const Uint32 *src0, const Uint32 *src1, Uint8 *dst_u, Uint8 *dst_v, int uv_step, int count, const struct RGB2YUVFactors *cvt)
+{
+    const __m256i u_br_factors = RGB2YUV_FactorPair_AVX2(cvt->u[2], cvt->u[0]);
+    const __m256i u_g1_factors = RGB2YUV_FactorPair_AVX2(cvt->u[1], RGB2YUV_ROUND);
+    const __m256i v_br_factors = RGB2YUV_FactorPair_AVX2(cvt->v[2], cvt->v[0]);
+    const __m256i v_g1_factors = RGB2YUV_FactorPair_AVX2(cvt->v[1], RGB2YUV_ROUND);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m256i br, g1, uv;
+        XRGB8888_Average2x2_AVX2(src0 + 2 * i, src1 + 2 * i, &br, &g1);
+        uv = RGB2YUV_Pack_AVX2(RGB2YUV_Dot_AVX2(br, g1, u_br_factors, u_g1_factors), RGB2YUV_Dot_AVX2(br, g1, v_br_factors, v_g1_factors));
+        RGB2YUV_StoreUV8_SSE2(_mm256_castsi256_si128(uv), _mm256_extracti128_si256(uv, 1), dst_u + i * uv_step, dst_v + i * uv_step, uv_step);
+    }
+    return i;
+}
+
+static int SDL_TARGETING("avx2") XBGR2101010_to_Y_AVX2(const Uint32 *src, Uint16 *dst, int count, const struct RGB2YUVFactors *cvt)
+{
+    const __m256i r_mask = _mm256_set1_epi32(0x000003ff);
+    const __m256i b_mask = _mm256_set1_epi32(0x03ff0000);
+    const __m256i one = _mm256_set1_epi32(0x00010000);
+    const __m256i rb_factors = RGB2YUV_FactorPair_AVX2(cvt->y[0], cvt->y[2]);
+    const __m256i g1_factors = RGB2YUV_FactorPair_AVX2(cvt->y[1], RGB2YUV_ROUND);
+    const __m256i offset = _mm256_set1_epi16((short)cvt->y_offset);
+    const __m256i max = _mm256_set1_epi16(1023);
+    int i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        const __m256i p0 = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i p1 = _mm256_loadu_si256((const __m256i *)(src + i + 8));
+        const __m256i y0 = RGB2YUV_Dot_AVX2(_mm256_or_si256(_mm256_and_si256(p0, r_mask), _mm256_and_si256(_mm256_srli_epi32(p0, 4), b_mask)),
+                                            _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(p0, 10), r_mask), one), rb_factors, g1_factors);
+        const __m256i y1 = RGB2YUV_Dot_AVX2(_mm256_or_si256(_mm256_and_si256(p1, r_mask), _mm256_and_si256(_mm256_srli_epi32(p1, 4), b_mask)),
+                                            _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(p1, 10), r_mask), one), rb_factors, g1_factors);
+        __m256i y = _mm256_adds_epi16(RGB2YUV_Pack_AVX2(y0, y1), offset);
+        y = _mm256_min_epi16(_mm256_max_epi16(y, _mm256_setzero_si256()), max);
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_slli_epi16(y, 6));
+    }
+    return i;
+}
+
+static int SDL_TARGETING("avx2") XBGR2101010_to_UV_AVX2(const Uint32 *src0, const Uint32 *src1, Uint16 *dst_uv, int count, const struct RGB2YUVFactors *cvt)
+{
+    const __m256i u_rb_factors = RGB2YUV_FactorPair_AVX2(cvt->u[0], cvt->u[2]);
+    const __m256i u_g1_factors = RGB2YUV_FactorPair_AVX2(cvt->u[1], RGB2YUV_ROUND);
+    const __m256i v_rb_factors = RGB2YUV_FactorPair_AVX2(cvt->v[0], cvt->v[2]);
+    const __m256i v_g1_factors = RGB2YUV_FactorPair_AVX2(cvt->v[1], RGB2YUV_ROUND);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m256i rb, g1, uv;
+        XBGR2101010_Average2x2_AVX2(src0 + 2 * i, src1 + 2 * i, &rb, &g1);
+        uv = RGB2YUV_Pack_AVX2(RGB2YUV_Dot_AVX2(rb, g1, u_rb_factors, u_g1_factors), RGB2YUV_Dot_AVX2(rb, g1, v_rb_factors, v_g1_factors));
+        RGB2YUV_StoreUV10_SSE2(_mm256_castsi256_si128(uv), _mm256_extracti128_si256(uv, 1), dst_uv + 2 * i);
+    }
+    return i;
+}
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+static SDL_INLINE int32x4_t RGB2YUV_Dot_NEON(int32x4_t r, int32x4_t g, int32x4_t b, const Sint16 *factors)
+{
+    int32x4_t sum = vdupq_n_s32(RGB2YUV_ROUND);
+    sum = vmlaq_n_s32(sum, r, factors[0]);
+    sum = vmlaq_n_s32(sum, g, factors[1]);
+    sum = vmlaq_n_s32(sum, b, factors[2]);
+    return vshrq_n_s32(sum, RGB2YUV_SHIFT);
+}
+
+static SDL_INLINE int32x4_t RGB2YUV_Channel_NEON(uint32x4_t p, int shift, Uint32 mask)
+{
+    // vshrq_n_u32() needs an immediate shift, so shift left by a negative amount instead
+    return vreinterpretq_s32_u32(vandq_u32(vshlq_u32(p, vdupq_n_s32(-shift)), vdupq_n_u32(mask)));
+}
+
+static SDL_INLINE int16x8_t RGB2YUV_Pack_NEON(int32x4_t a, int32x4_t b)
+{
+    return vcombine_s16(vqmovn_s32(a), vqmovn_s32(b));
+}
+
+static SDL_INLINE uint16x8_t RGB2YUV_Clamp10_NEON(int16x8_t x, int offset)
+{
+    x = vqaddq_s16(x, vdupq_n_s16((int16_t)offset));
+    x = vminq_s16(vmaxq_s16(x, vdupq_n_s16(0)), vdupq_n_s16(1023));
+    return vreinterpretq_u16_s16(vshlq_n_s16(x, 6));
+}
+
+// Averages 2x8 pixels into 4 values of each channel
+static SDL_INLINE void RGB2YUV_Average2x2_NEON(const Uint32 *src0, const Uint32 *src1, const int shifts[3], Uint32 mask, int32x4_t *r, int32x4_t *g, int32x4_t *b)
+{
+    const uint32x4x2_t a = vld2q_u32(src0);
+    const uint32x4x2_t c = vld2q_u32(src1);
+    int32x4_t *channels[3];
+    int i;
+
+    channels[0] = r;
+    channels[1] = g;
+    channels[2] = b;
+    for (i = 0; i < 3; ++i) {
+        int32x4_t sum = vaddq_s32(RGB2YUV_Channel_NEON(a.val[0], shifts[i], mask), RGB2YUV_Channel_NEON(a.val[1], shifts[i], mask));
+        sum = vaddq_s32(sum, RGB2YUV_Channel_NEON(c.val[0], shifts[i], mask));
+        sum = vaddq_s32(sum, RGB2YUV_Channel_NEON(c.val[1], shifts[i], mask));
+        *channels[i] = vshrq_n_s32(sum, 2);
+    }
+}
+
+static const int XRGB8888_shifts[3] = { 16, 8, 0 };
+static const int XBGR2101010_shifts[3] = { 0, 10, 20 };
+
+static int XRGB8888_to_Y_NEON(const Uint32 *src, Uint8 *dst, int count, const struct RGB2YUVFactors *cvt)
+{
+    int i, j;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        int32x4_t y[2];
+        for (j = 0; j < 2; ++j) {
+            const uint32x4_t p = vld1q_u32(src + i + j * 4);
+            y[j] = RGB2YUV_Dot_NEON(RGB2YUV_Channel_NEON(p, 16, 0xff), RGB2YUV_Channel_NEON(p, 8, 0xff), RGB2YUV_Channel_NEON(p, 0, 0xff), cvt->y);
+        }
+        vst1_u8(dst + i, vqmovun_s16(vqaddq_s16(RGB2YUV_Pack_NEON(y[0], y[1]), vdupq_n_s16((int16_t)cvt->y_offset))));
+    }
+    return i;
+}
+
+static int XRGB8888_to_UV_NEON(const Uint32 *src0, const Uint32 *src1, Uint8 *dst_u, Uint8 *dst_v, int uv_step, int count, const struct RGB2YUVFactors *cvt)
+{
+    const int16x8_t offset = vdupq_n_s16(128);
+    int i, j;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        int32x4_t u[2], v[2];
+        uint8x8x2_t uv;
+        for (j = 0; j < 2; ++j) {
+            int32x4_t r, g, b;
+            RGB2YUV_Average2x2_NEON(src0 + 2 * i + j * 8, src1 + 2 * i + j * 8, XRGB8888_shifts, 0xff, &r, &g, &b);
+            u[j] = RGB2YUV_Dot_NEON(r, g, b, cvt->u);
+            v[j] = RGB2YUV_Dot_NEON(r, g, b, cvt->v);
+        }
+        uv.val[0] = vqmovun_s16(vqaddq_s16(RGB2YUV_Pack_NEON(u[0], u[1]), offset));
+        uv.val[1] = vqmovun_s16(vqaddq_s16(RGB2YUV_Pack_NEON(v[0], v[1]), offset));
+        if (uv_step == 1) {
+            vst1_u8(dst_u + i, uv.val[0]);
+            vst1_u8(dst_v + i, uv.val[1]);
+        } else if (dst_u < dst_v) {
+            vst2_u8(dst_u + i * uv_step, uv);
+        } else {
+            const uint8x8_t tmp = uv.val[0];
+            uv.val[0] = uv.val[1];
+            uv.val[1] = tmp;
+            vst2_u8(dst_v + i * uv_step, uv);
+        }
+    }
+    return i;
+}
+
+static int XBGR2101010_to_Y_NEON(const Uint32 *src, Uint16 *dst, int count, const struct RGB2YUVFactors *cvt)
+{
+    int i, j;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        int32x4_t y[2];
+        for (j = 0; j < 2; ++j) {
+            const uint32x4_t p = vld1q_u32(src + i + j * 4);
+            y[j] = RGB2YUV_Dot_NEON(RGB2YUV_Channel_NEON(p, 0, 0x3ff), RGB2YUV_Channel_NEON(p, 10, 0x3ff), RGB2YUV_Channel_NEON(p, 20, 0x3ff), cvt->y);
+        }
+        vst1q_u16(dst + i, RGB2YUV_Clamp10_NEON(RGB2YUV_Pack_NEON(y[0], y[1]), cvt->y_offset));
+    }
+    return i;
+}
+
+static int XBGR2101010_to_UV_NEON(const Uint32 *src0, const Uint32 *src1, Uint16 *dst_uv, int count, const struct RGB2YUVFactors *cvt)
+{
+    int i, j;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        int32x4_t u[2], v[2];
+        uint16x8x2_t uv;
+        for (j = 0; j < 2; ++j) {
+            int32x4_t r, g, b;
+            RGB2YUV_Average2x2_NEON(src0 + 2 * i + j * 8, src1 + 2 * i + j * 8, XBGR2101010_shifts, 0x3ff, &r, &g, &b);
+            u[j] = RGB2YUV_Dot_NEON(r, g, b, cvt->u);
+            v[j] = RGB2YUV_Dot_NEON(r, g, b, cvt->v);
+        }
+        uv.val[0] = RGB2YUV_Clamp10_NEON(RGB2YUV_Pack_NEON(u[0], u[1]), 512);
+        uv.val[1] = RGB2YUV_Clamp10_NEON(RGB2YUV_Pack_NEON(v[0], v[1]), 512);
+        vst2q_u16(dst_uv + 2 * i, uv);
+    }
+    return i;
+}
+#endif // SDL_NEON_INTRINSICS
+
+static void GetRGB2YUVFuncs(RGB2YUVFuncs *funcs)
+{
+    SDL_zerop(funcs);
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        funcs->XRGB8888_to_Y = XRGB8888_to_Y_AVX2;
+        funcs->XRGB8888_to_UV = XRGB8888_to_UV_AVX2;
+        funcs->XBGR2101010_to_Y = XBGR2101010_to_Y_AVX2;
+        funcs->XBGR2101010_to_UV = XBGR2101010_to_UV_AVX2;
+        return;
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        funcs->XRGB8888_to_Y = XRGB8888_to_Y_SSE2;
+        funcs->XRGB8888_to_UV = XRGB8888_to_UV_SSE2;
+        funcs->XBGR2101010_to_Y = XBGR2101010_to_Y_SSE2;
+        funcs->XBGR2101010_to_UV = XBGR2101010_to_UV_SSE2;
+        return;
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        funcs->XRGB8888_to_Y = XRGB8888_to_Y_NEON;
+        funcs->XRGB8888_to_UV = XRGB8888_to_UV_NEON;
+        funcs->XBGR2101010_to_Y = XBGR2101010_to_Y_NEON;
+        funcs->XBGR2101010_to_UV = XBGR2101010_to_UV_NEON;
+        return;
+    }
+#endif
+}
+
 static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
 {
-    const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
     const int width_half = width / 2;
     const int width_remainder = (width & 0x1);
     int i, j;
 
     const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
 
-#define MAKE_Y(r, g, b) (Uint8)SDL_clamp(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset), 0, 255)
-#define MAKE_U(r, g, b) (Uint8)SDL_clamp(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128), 0, 255)
-#define MAKE_V(r, g, b) (Uint8)SDL_clamp(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 128), 0, 255)
-
-#define READ_2x2_PIXELS                                                                                     \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10; \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2;
-
-#define READ_2x1_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];            \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;
-
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;
+#define MAKE_Y MAKE_Y8
+#define MAKE_U MAKE_U8
+#define MAKE_V MAKE_V8
 
 #define READ_1x1_PIXEL                                  \
     const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
@@ -786,8 +1356,9 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
         Uint8 *plane_y;
         Uint8 *plane_u;
         Uint8 *plane_v;
-        Uint8 *plane_interleaved_uv;
-        Uint32 y_stride, uv_stride, y_skip, uv_skip;
+        Uint32 y_stride, uv_stride;
+        int uv_step;
+        RGB2YUVFuncs funcs;
 
         if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
                           (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
@@ -795,119 +1366,39 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
             return false;
         }
 
-        plane_interleaved_uv = (plane_y + height * y_stride);
-        y_skip = (y_stride - width);
+        uv_step = (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV) ? 1 : 2;
+
+        GetRGB2YUVFuncs(&funcs);
 
         curr_row = (const Uint8 *)src;
 
         // Write Y plane
         for (j = 0; j < height; j++) {
-            for (i = 0; i < width; i++) {
-                const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-                const Uint32 r = (p1 & 0x00ff0000) >> 16;
-                const Uint32 g = (p1 & 0x0000ff00) >> 8;
-                const Uint32 b = (p1 & 0x000000ff);
-                *plane_y++ = MAKE_Y(r, g, b);
-            }
-            plane_y += y_skip;
+            i = funcs.XRGB8888_to_Y ? funcs.XRGB8888_to_Y((const Uint32 *)curr_row, plane_y, width, cvt) : 0;
+            XRGB8888_to_Y_std((const Uint32 *)curr_row + i, plane_y + i, width - i, cvt);
+            plane_y += y_stride;
             curr_row += src_pitch;
         }
 
+        // Write UV planes, a row of an odd height image is averaged with itself
         curr_row = (const Uint8 *)src;
-        next_row = (const Uint8 *)src;
-        next_row += src_pitch;
-
-        if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV) {
-            // Write UV planes, not interleaved
-            uv_skip = (uv_stride - (width + 1) / 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-            }
-        } else if (dst_format == SDL_PIXELFORMAT_NV12) {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-            }
-        } else /* dst_format == SDL_PIXELFORMAT_NV21 */ {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
+        for (j = 0; j < height; j += 2) {
+            const Uint32 *row0 = (const Uint32 *)curr_row;
+            const Uint32 *row1;
+
+            next_row = (j + 1 < height) ? (curr_row + src_pitch) : curr_row;
+            row1 = (const Uint32 *)next_row;
+
+            i = funcs.XRGB8888_to_UV ? funcs.XRGB8888_to_UV(row0, row1, plane_u, plane_v, uv_step, width_half, cvt) : 0;
+            XRGB8888_to_UV_std(row0 + 2 * i, row1 + 2 * i, plane_u + i * uv_step, plane_v + i * uv_step, uv_step, width_half - i, cvt);
+            if (width_remainder) {
+                const Uint32 p1 = row0[2 * width_half];
+                const Uint32 p2 = row1[2 * width_half];
+                XRGB8888_to_UV_2x2(p1, p1, p2, p2, plane_u + width_half * uv_step, plane_v + width_half * uv_step, cvt);
             }
+            plane_u += uv_stride;
+            plane_v += uv_stride;
+            curr_row += 2 * src_pitch;
         }
     } break;
 
@@ -998,9 +1489,6 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
 #undef MAKE_Y
 #undef MAKE_U
 #undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
 #undef READ_1x1_PIXEL
 #undef READ_TWO_RGB_PIXELS
 #undef READ_ONE_RGB_PIXEL
@@ -1009,55 +1497,19 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
 
 static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
 {
-    const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
     const int width_half = width / 2;
     const int width_remainder = (width & 0x1);
     int i, j;
 
     const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
 
-#define MAKE_Y(r, g, b) (Uint16)(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset) << 6)
-#define MAKE_U(r, g, b) (Uint16)(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 512) << 6)
-#define MAKE_V(r, g, b) (Uint16)(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 512) << 6)
-
-#define READ_2x2_PIXELS                                                                                     \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff) + (p3 & 0x000003ff) + (p4 & 0x000003ff)) >> 2;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00) + (p3 & 0x000ffc00) + (p4 & 0x000ffc00)) >> 12; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000) + (p3 & 0x3ff00000) + (p4 & 0x3ff00000)) >> 22;
-
-#define READ_2x1_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];            \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff)) >> 1;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21;
-
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff)) >> 1;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21;
-
-#define READ_1x1_PIXEL                                  \
-    const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
-    const Uint32 r = (p & 0x000003ff);                  \
-    const Uint32 g = (p & 0x000ffc00) >> 10;            \
-    const Uint32 b = (p & 0x3ff00000) >> 20;
-
     const Uint8 *curr_row, *next_row;
 
     Uint16 *plane_y;
     Uint16 *plane_u;
     Uint16 *plane_v;
-    Uint16 *plane_interleaved_uv;
-    Uint32 y_stride, uv_stride, y_skip, uv_skip;
+    Uint32 y_stride, uv_stride;
+    RGB2YUVFuncs funcs;
 
     if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
                       (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
@@ -1068,64 +1520,38 @@ static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const v
     y_stride /= sizeof(Uint16);
     uv_stride /= sizeof(Uint16);
 
-    plane_interleaved_uv = (plane_y + height * y_stride);
-    y_skip = (y_stride - width);
+    GetRGB2YUVFuncs(&funcs);
 
     curr_row = (const Uint8 *)src;
 
     // Write Y plane
     for (j = 0; j < height; j++) {
-        for (i = 0; i < width; i++) {
-            const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-            const Uint32 r = (p1 >>  0) & 0x03ff;
-            const Uint32 g = (p1 >> 10) & 0x03ff;
-            const Uint32 b = (p1 >> 20) & 0x03ff;
-            *plane_y++ = MAKE_Y(r, g, b);
-        }
-        plane_y += y_skip;
+        i = funcs.XBGR2101010_to_Y ? funcs.XBGR2101010_to_Y((const Uint32 *)curr_row, plane_y, width, cvt) : 0;
+        XBGR2101010_to_Y_std((const Uint32 *)curr_row + i, plane_y + i, width - i, cvt);
+        plane_y += y_stride;
         curr_row += src_pitch;
     }
 
+    // Write UV plane, a row of an odd height image is averaged with itself
     curr_row = (const Uint8 *)src;
-    next_row = (const Uint8 *)src;
-    next_row += src_pitch;
+    for (j = 0; j < height; j += 2) {
+        const Uint32 *row0 = (const Uint32 *)curr_row;
+        const Uint32 *row1;
 
-    uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-    for (j = 0; j < height_half; j++) {
-        for (i = 0; i < width_half; i++) {
-            READ_2x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        if (width_remainder) {
-            READ_2x1_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        plane_interleaved_uv += uv_skip;
-        curr_row += src_pitch_x_2;
-        next_row += src_pitch_x_2;
-    }
-    if (height_remainder) {
-        for (i = 0; i < width_half; i++) {
-            READ_1x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
+        next_row = (j + 1 < height) ? (curr_row + src_pitch) : curr_row;
+        row1 = (const Uint32 *)next_row;
+
+        i = funcs.XBGR2101010_to_UV ? funcs.XBGR2101010_to_UV(row0, row1, plane_u, width_half, cvt) : 0;
+        XBGR2101010_to_UV_std(row0 + 2 * i, row1 + 2 * i, plane_u + 2 * i, width_half - i, cvt);
         if (width_remainder) {
-            READ_1x1_PIXEL;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
+            const Uint32 p1 = row0[2 * width_half];
+            const Uint32 p2 = row1[2 * width_half];
+            XBGR2101010_to_UV_2x2(p1, p1, p2, p2, plane_u + 2 * width_half, cvt);
         }
+        plane_u += uv_stride;
+        curr_row += 2 * src_pitch;
     }
 
-#undef MAKE_Y
-#undef MAKE_U
-#undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
-#undef READ_1x1_PIXEL
     return true;
 }
 
@@ -899,7 +899,8 @@ static void pointer_handle_button_common(SDL_WaylandSeat *seat, uint32_t serial,
         if (window->last_focus_event_time_ns) {
             if (state == WL_POINTER_BUTTON_STATE_PRESSED &&
                 (SDL_GetTicksNS() - window->last_focus_event_time_ns) < WAYLAND_FOCUS_CLICK_TIMEOUT_NS) {
-                ignore_click = !SDL_GetHintBoolean(SDL_HINT_MOUSE_FOCUS_CLICKTHROUGH, false);
+                static SDL_HintCache focus_clickthrough;
+                ignore_click = !SDL_GetCachedHintBoolean(SDL_HINT_MOUSE_FOCUS_CLICKTHROUGH, false, &focus_clickthrough);
             }
 
             window->last_focus_event_time_ns = 0;
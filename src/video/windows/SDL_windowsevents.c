@@ -235,8 +235,10 @@ static SDL_Scancode WindowsScanCodeToSDLScanCode(LPARAM lParam, WPARAM wParam, U
 #if !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
 static bool WIN_ShouldIgnoreFocusClick(SDL_WindowData *data)
 {
+    static SDL_HintCache focus_clickthrough;
+
     return !SDL_WINDOW_IS_POPUP(data->window) &&
-           !SDL_GetHintBoolean(SDL_HINT_MOUSE_FOCUS_CLICKTHROUGH, false);
+           !SDL_GetCachedHintBoolean(SDL_HINT_MOUSE_FOCUS_CLICKTHROUGH, false, &focus_clickthrough);
 }
 
 static void WIN_CheckWParamMouseButton(Uint64 timestamp, bool bwParamMousePressed, Uint32 mouseFlags, bool bSwapButtons, SDL_WindowData *data, Uint8 button, SDL_MouseID mouseID)
@@ -396,7 +398,9 @@ static void WIN_UpdateFocus(SDL_Window *window, bool expect_focus, DWORD pos)
 
 static bool ShouldGenerateWindowCloseOnAltF4(void)
 {
-    return SDL_GetHintBoolean(SDL_HINT_WINDOWS_CLOSE_ON_ALT_F4, true);
+    static SDL_HintCache close_on_alt_f4;
+
+    return SDL_GetCachedHintBoolean(SDL_HINT_WINDOWS_CLOSE_ON_ALT_F4, true, &close_on_alt_f4);
 }
 
 static bool ShouldClearWindowOnEraseBackground(SDL_WindowData *data)
@@ -1049,7 +1049,8 @@ void X11_HandleButtonPress(SDL_VideoDevice *_this, SDL_WindowData *windowdata, S
         if (windowdata->last_focus_event_time) {
             const int X11_FOCUS_CLICK_TIMEOUT = 10;
             if (SDL_GetTicks() < (windowdata->last_focus_event_time + X11_FOCUS_CLICK_TIMEOUT)) {
-                ignore_click = !SDL_GetHintBoolean(SDL_HINT_MOUSE_FOCUS_CLICKTHROUGH, false);
+                static SDL_HintCache focus_clickthrough;
+                ignore_click = !SDL_GetCachedHintBoolean(SDL_HINT_MOUSE_FOCUS_CLICKTHROUGH, false, &focus_clickthrough);
             }
             windowdata->last_focus_event_time = 0;
         }
@@ -0,0 +1,170 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Streams audio through many audio streams at once, checking that once the
+   chunk pool has warmed up, SDL doesn't allocate any memory to do it */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define DEFAULT_STREAMS     200
+#define DEFAULT_ITERATIONS  200
+#define MAX_STREAMS         4096
+#define WRITE_FRAMES        512
+#define BURST_FRAMES        (WRITE_FRAMES * 28)
+
+static SDL_AudioStream *streams[MAX_STREAMS];
+static Sint16 src_buf[BURST_FRAMES * 2];
+static float dst_buf[BURST_FRAMES * 4];
+
+/* Every stream gets a small write and is drained, like a mixer feeding
+   many voices. One stream per iteration also gets a burst, which needs
+   more chunks than a stream keeps for itself. Puts of 64K or more are
+   copied into a separate allocation, so the burst stays below that.
+   The write sizes divide the chunk size, so the number of chunks each
+   stream needs repeats every few iterations. */
+static bool RunIteration(int num_streams, int iteration)
+{
+    const int burst = iteration % num_streams;
+    int i;
+
+    for (i = 0; i < num_streams; ++i) {
+        const int frames = (i == burst) ? BURST_FRAMES : WRITE_FRAMES;
+
+        if (!SDL_PutAudioStreamData(streams[i], src_buf, frames * 2 * (int)sizeof(Sint16))) {
+            SDL_Log("SDL_PutAudioStreamData() failed: %s", SDL_GetError());
+            return false;
+        }
+        while (SDL_GetAudioStreamAvailable(streams[i]) > 0) {
+            if (SDL_GetAudioStreamData(streams[i], dst_buf, sizeof(dst_buf)) < 0) {
+                SDL_Log("SDL_GetAudioStreamData() failed: %s", SDL_GetError());
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_AudioSpec src_spec, dst_spec;
+    SDL_AudioChunkPoolStats stats;
+    int num_streams = DEFAULT_STREAMS;
+    int iterations = DEFAULT_ITERATIONS;
+    int allocations;
+    int i;
+    bool result = true;
+
+    /* This has to come first, so every allocation is counted */
+    SDLTest_TrackAllocations();
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcmp(argv[i], "--streams") == 0 && argv[i + 1]) {
+                num_streams = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_STREAMS);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--streams N]", "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(src_buf); ++i) {
+        src_buf[i] = (Sint16)(SDL_sinf((float)i * 0.01f) * 16384.0f);
+    }
+
+    src_spec.format = SDL_AUDIO_S16;
+    src_spec.channels = 2;
+    src_spec.freq = 44100;
+    dst_spec.format = SDL_AUDIO_F32;
+    dst_spec.channels = 2;
+    dst_spec.freq = 48000;
+
+    for (i = 0; i < num_streams; ++i) {
+        streams[i] = SDL_CreateAudioStream(&src_spec, &dst_spec);
+        if (!streams[i]) {
+            SDL_Log("Couldn't create audio stream: %s", SDL_GetError());
+            num_streams = i;
+            result = false;
+            goto done;
+        }
+    }
+
+    /* Warm up: every stream has had a burst starting at each place it can in
+       a chunk, so the pools have grown as big as they need to be */
+    for (i = 0; i < num_streams * 4; ++i) {
+        if (!RunIteration(num_streams, i)) {
+            result = false;
+            goto done;
+        }
+    }
+
+    SDL_GetAudioChunkPoolStats(&stats, true);
+    allocations = SDLTest_GetAllocationCount();
+
+    for (i = 0; i < iterations; ++i) {
+        if (!RunIteration(num_streams, i)) {
+            result = false;
+            goto done;
+        }
+    }
+
+    allocations = SDLTest_GetAllocationCount() - allocations;
+    SDL_GetAudioChunkPoolStats(&stats, false);
+
+    SDL_Log("%d streams, %d iterations: %d allocations", num_streams, iterations, allocations);
+    SDL_Log("Chunk pool: %d of %d %d byte chunks free, %" SDL_PRIu32 " reused, %" SDL_PRIu32 " allocated, %" SDL_PRIu32 " released",
+            stats.free_chunks, stats.max_free_chunks, stats.chunk_size,
+            stats.reused_chunks, stats.allocated_chunks, stats.released_chunks);
+
+    if (stats.max_free_chunks > 0) {
+        if (allocations != 0) {
+            SDL_Log("FAIL: streaming allocated memory");
+            result = false;
+        }
+        if (stats.reused_chunks == 0) {
+            SDL_Log("FAIL: no chunks were reused from the pool");
+            result = false;
+        }
+    }
+
+done:
+    for (i = 0; i < num_streams; ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
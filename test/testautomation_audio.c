@@ -15,6 +15,10 @@
 #include <SDL3/SDL_test.h>
 #include "testautomation_suites.h"
 
+/* The generated channel converters, to check SDL's channel conversion against */
+#define LOG_DEBUG_AUDIO_CONVERT(from, to)
+#include "../src/audio/SDL_audio_channel_converters.h"
+
 /* ================= Test Case Implementation ================== */
 
 /* Fixture */
@@ -1460,6 +1464,1047 @@ cleanup:
 
     return status;
 }
+#define MIX_TEST_STREAMS 3
+
+static float *g_audio_mixBuffer = NULL;
+static int g_audio_mixBufferLength = 0;
+static int g_audio_mixChannels = 0;
+static SDL_AtomicInt g_audio_mixCaptured;
+
+static void SDLCALL audio_mixPostmixCallback(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    /* only keep the first buffer, which is built from the start of each stream's data */
+    if (SDL_GetAtomicInt(&g_audio_mixCaptured) == 0) {
+        g_audio_mixBuffer = (float *)SDL_malloc(buflen);
+        if (g_audio_mixBuffer) {
+            SDL_memcpy(g_audio_mixBuffer, buffer, buflen);
+            g_audio_mixBufferLength = buflen;
+            g_audio_mixChannels = spec->channels;
+        }
+        SDL_SetAtomicInt(&g_audio_mixCaptured, 1);
+    }
+}
+
+/* Every value here is a small multiple of a power of two, so the mixed result is exact regardless of how it's computed */
+static float audio_mixTestSample(int stream, int sample)
+{
+    return (float)((sample % 37) - 18) * (float)(stream + 1) / 128.0f;
+}
+
+static void SDLCALL audio_mixGetCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    /* the data was queued up front, this just makes sure streams with callbacks are mixed too */
+    SDL_AddAtomicInt((SDL_AtomicInt *)userdata, 1);
+}
+
+static int audio_mixStreamsHelper(void)
+{
+    static const float stream_gains[MIX_TEST_STREAMS] = { 0.5f, 1.0f, 2.0f };
+    const float device_gain = 0.5f;
+    SDL_AudioStream *streams[MIX_TEST_STREAMS];
+    SDL_AudioDeviceID devid;
+    SDL_AudioSpec spec;
+    SDL_AtomicInt callbacks;
+    float *data = NULL;
+    const int num_samples = 48000;
+    int status = TEST_ABORTED;
+    int errors = 0;
+    int i, j;
+
+    SDL_zeroa(streams);
+    SDL_SetAtomicInt(&callbacks, 0);
+    SDL_SetAtomicInt(&g_audio_mixCaptured, 0);
+    g_audio_mixBuffer = NULL;
+    g_audio_mixBufferLength = 0;
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL);
+    if (!devid) {
+        SDLTest_Log("Couldn't open an audio device (%s), skipping", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertCheck(SDL_PauseAudioDevice(devid), "Check result of SDL_PauseAudioDevice()");
+    SDLTest_AssertCheck(SDL_GetAudioDeviceFormat(devid, &spec, NULL), "Check result of SDL_GetAudioDeviceFormat()");
+    spec.format = SDL_AUDIO_F32;
+
+    data = (float *)SDL_malloc(num_samples * sizeof(float));
+    if (!SDLTest_AssertCheck(data != NULL, "Expected sample buffer to be allocated")) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < MIX_TEST_STREAMS; ++i) {
+        streams[i] = SDL_CreateAudioStream(&spec, &spec);
+        if (!SDLTest_AssertCheck(streams[i] != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+            goto cleanup;
+        }
+        SDLTest_AssertCheck(SDL_SetAudioStreamGain(streams[i], stream_gains[i]), "Check result of SDL_SetAudioStreamGain()");
+        for (j = 0; j < num_samples; ++j) {
+            data[j] = audio_mixTestSample(i, j);
+        }
+        SDLTest_AssertCheck(SDL_PutAudioStreamData(streams[i], data, num_samples * sizeof(float)), "Check result of SDL_PutAudioStreamData()");
+    }
+    SDLTest_AssertCheck(SDL_SetAudioStreamGetCallback(streams[1], audio_mixGetCallback, &callbacks), "Check result of SDL_SetAudioStreamGetCallback()");
+
+    SDLTest_AssertCheck(SDL_SetAudioDeviceGain(devid, device_gain), "Check result of SDL_SetAudioDeviceGain()");
+    SDLTest_AssertCheck(SDL_SetAudioPostmixCallback(devid, audio_mixPostmixCallback, NULL), "Check result of SDL_SetAudioPostmixCallback()");
+    if (!SDLTest_AssertCheck(SDL_BindAudioStreams(devid, streams, MIX_TEST_STREAMS), "Check result of SDL_BindAudioStreams()")) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(SDL_ResumeAudioDevice(devid), "Check result of SDL_ResumeAudioDevice()");
+
+    for (i = 0; i < 2000 && !SDL_GetAtomicInt(&g_audio_mixCaptured); ++i) {
+        SDL_Delay(1);
+    }
+    SDL_PauseAudioDevice(devid);
+
+    if (!SDLTest_AssertCheck(g_audio_mixBuffer != NULL, "Expected the postmix callback to see a mixed buffer")) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(g_audio_mixChannels == spec.channels, "Expected %d channels in the mix, got %d", spec.channels, g_audio_mixChannels);
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&callbacks) > 0, "Expected the stream's get callback to be called");
+
+    for (j = 0; j < (int)(g_audio_mixBufferLength / sizeof(float)); ++j) {
+        float expected = 0.0f;
+        for (i = 0; i < MIX_TEST_STREAMS; ++i) {
+            expected += audio_mixTestSample(i, j) * stream_gains[i] * device_gain;
+        }
+        if (g_audio_mixBuffer[j] != expected) {
+            if (errors++ < 10) {
+                SDLTest_LogError("Sample %d: expected %f, got %f", j, expected, g_audio_mixBuffer[j]);
+            }
+        }
+    }
+    SDLTest_AssertCheck(errors == 0, "Expected all %d mixed samples to match, %d didn't", (int)(g_audio_mixBufferLength / sizeof(float)), errors);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_CloseAudioDevice(devid);
+    for (i = 0; i < MIX_TEST_STREAMS; ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_free(data);
+    SDL_free(g_audio_mixBuffer);
+    g_audio_mixBuffer = NULL;
+
+    return status;
+}
+
+/**
+ * Mix several streams with different gains through a logical device and check the result.
+ *
+ * \sa SDL_BindAudioStreams
+ * \sa SDL_SetAudioStreamGain
+ * \sa SDL_SetAudioDeviceGain
+ * \sa SDL_SetAudioPostmixCallback
+ */
+static int SDLCALL audio_mixStreams(void *arg)
+{
+    return audio_mixStreamsHelper();
+}
+
+/* The mix threads hint is read when the audio subsystem starts, so really shut it down, and start it again with the hint set.
+   Returns how many times the subsystem had been initialized, for audio_restoreAudio(). */
+static int audio_restartWithMixThreads(const char *threads)
+{
+    int init_count = 0;
+
+    while (SDL_WasInit(SDL_INIT_AUDIO)) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        ++init_count;
+    }
+
+    SDL_SetHint(SDL_HINT_AUDIO_MIX_THREADS, threads);
+    if (!SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_AUDIO), "Check result of SDL_InitSubSystem(SDL_INIT_AUDIO) with mix threads")) {
+        SDL_ResetHint(SDL_HINT_AUDIO_MIX_THREADS);
+        return -1 - init_count;
+    }
+    return init_count;
+}
+
+static void audio_restoreAudio(int init_count)
+{
+    int i;
+
+    if (init_count >= 0) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    } else {
+        init_count = -1 - init_count;
+    }
+    SDL_ResetHint(SDL_HINT_AUDIO_MIX_THREADS);
+
+    for (i = 0; i < init_count; ++i) {
+        SDL_InitSubSystem(SDL_INIT_AUDIO);
+    }
+}
+
+/**
+ * Mix several streams on the audio mix threads and check the result is the same.
+ *
+ * \sa SDL_HINT_AUDIO_MIX_THREADS
+ */
+static int SDLCALL audio_mixStreamsThreaded(void *arg)
+{
+    const int init_count = audio_restartWithMixThreads("2");
+    int status = TEST_ABORTED;
+
+    if (init_count >= 0) {
+        status = audio_mixStreamsHelper();
+    }
+    audio_restoreAudio(init_count);
+    return status;
+}
+
+/* Mix streams that need resampling, with gains that don't scale exactly, and hand back the first mixed buffer */
+static int audio_mixResampledStreamsHelper(float **mixed, int *mixed_len)
+{
+    static const int stream_freqs[2] = { 44100, 22050 };
+    static const float stream_gains[2] = { 0.3f, 0.7f };
+    SDL_AudioStream *streams[2];
+    SDL_AudioDeviceID devid;
+    SDL_AudioSpec spec, src_spec;
+    float *data = NULL;
+    const int num_samples = 48000;
+    int status = TEST_ABORTED;
+    int i, j;
+
+    SDL_zeroa(streams);
+    SDL_SetAtomicInt(&g_audio_mixCaptured, 0);
+    g_audio_mixBuffer = NULL;
+    g_audio_mixBufferLength = 0;
+    *mixed = NULL;
+    *mixed_len = 0;
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL);
+    if (!devid) {
+        SDLTest_Log("Couldn't open an audio device (%s), skipping", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertCheck(SDL_PauseAudioDevice(devid), "Check result of SDL_PauseAudioDevice()");
+    SDLTest_AssertCheck(SDL_GetAudioDeviceFormat(devid, &spec, NULL), "Check result of SDL_GetAudioDeviceFormat()");
+    spec.format = SDL_AUDIO_F32;
+
+    data = (float *)SDL_malloc(num_samples * sizeof(float));
+    if (!SDLTest_AssertCheck(data != NULL, "Expected sample buffer to be allocated")) {
+        goto cleanup;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(streams); ++i) {
+        src_spec = spec;
+        src_spec.freq = stream_freqs[i];
+        streams[i] = SDL_CreateAudioStream(&src_spec, &spec);
+        if (!SDLTest_AssertCheck(streams[i] != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+            goto cleanup;
+        }
+        SDLTest_AssertCheck(SDL_SetAudioStreamGain(streams[i], stream_gains[i]), "Check result of SDL_SetAudioStreamGain()");
+        for (j = 0; j < num_samples; ++j) {
+            data[j] = (float)sine_wave_sample(j / spec.channels, stream_freqs[i], 440 + (i * 110), 0.0) * 0.5f;
+        }
+        SDLTest_AssertCheck(SDL_PutAudioStreamData(streams[i], data, num_samples * sizeof(float)), "Check result of SDL_PutAudioStreamData()");
+    }
+
+    SDLTest_AssertCheck(SDL_SetAudioDeviceGain(devid, 0.9f), "Check result of SDL_SetAudioDeviceGain()");
+    SDLTest_AssertCheck(SDL_SetAudioPostmixCallback(devid, audio_mixPostmixCallback, NULL), "Check result of SDL_SetAudioPostmixCallback()");
+    if (!SDLTest_AssertCheck(SDL_BindAudioStreams(devid, streams, (int)SDL_arraysize(streams)), "Check result of SDL_BindAudioStreams()")) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(SDL_ResumeAudioDevice(devid), "Check result of SDL_ResumeAudioDevice()");
+
+    for (i = 0; i < 2000 && !SDL_GetAtomicInt(&g_audio_mixCaptured); ++i) {
+        SDL_Delay(1);
+    }
+    SDL_PauseAudioDevice(devid);
+
+    if (SDLTest_AssertCheck(g_audio_mixBuffer != NULL, "Expected the postmix callback to see a mixed buffer")) {
+        *mixed = g_audio_mixBuffer;
+        *mixed_len = g_audio_mixBufferLength;
+        g_audio_mixBuffer = NULL;
+        status = TEST_COMPLETED;
+    }
+
+cleanup:
+    SDL_CloseAudioDevice(devid);
+    for (i = 0; i < (int)SDL_arraysize(streams); ++i) {
+        SDL_DestroyAudioStream(streams[i]);
+    }
+    SDL_free(data);
+    SDL_free(g_audio_mixBuffer);
+    g_audio_mixBuffer = NULL;
+
+    return status;
+}
+
+/**
+ * Mix resampled streams with and without the audio mix threads, and check that the results are identical.
+ *
+ * \sa SDL_HINT_AUDIO_MIX_THREADS
+ * \sa SDL_SetAudioStreamGain
+ */
+static int SDLCALL audio_mixStreamsThreadedResampled(void *arg)
+{
+    float *serial = NULL;
+    float *threaded = NULL;
+    int serial_len = 0;
+    int threaded_len = 0;
+    int init_count;
+    int status;
+    int errors = 0;
+    int i;
+
+    status = audio_mixResampledStreamsHelper(&serial, &serial_len);
+    if (status != TEST_COMPLETED) {
+        return status;
+    }
+
+    init_count = audio_restartWithMixThreads("2");
+    if (init_count >= 0) {
+        status = audio_mixResampledStreamsHelper(&threaded, &threaded_len);
+    } else {
+        status = TEST_ABORTED;
+    }
+    audio_restoreAudio(init_count);
+
+    if (status == TEST_COMPLETED) {
+        SDLTest_AssertCheck(threaded_len == serial_len, "Expected %d bytes from the mix threads, got %d", serial_len, threaded_len);
+        for (i = 0; i < (int)(SDL_min(serial_len, threaded_len) / sizeof(float)); ++i) {
+            if (threaded[i] != serial[i]) {
+                if (errors++ < 10) {
+                    SDLTest_LogError("Sample %d: expected %.9g, got %.9g", i, serial[i], threaded[i]);
+                }
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Expected the mix threads to match the serial mix exactly, %d samples didn't", errors);
+    }
+
+    SDL_free(serial);
+    SDL_free(threaded);
+    return status;
+}
+
+/* Sample values that go well past [-1, 1] */
+static float audio_mixLoudSample(int sample)
+{
+    return (float)((sample % 13) - 6) * 0.5f;
+}
+
+/**
+ * Mix a lone stream that goes past [-1, 1] into a device, and check the mix is clamped.
+ *
+ * \sa SDL_BindAudioStream
+ * \sa SDL_SetAudioPostmixCallback
+ */
+static int SDLCALL audio_mixClamp(void *arg)
+{
+    SDL_AudioStream *stream = NULL;
+    SDL_AudioDeviceID devid;
+    SDL_AudioSpec spec;
+    float *data = NULL;
+    const int num_samples = 48000;
+    int status = TEST_ABORTED;
+    int errors = 0;
+    int i;
+
+    SDL_SetAtomicInt(&g_audio_mixCaptured, 0);
+    g_audio_mixBuffer = NULL;
+    g_audio_mixBufferLength = 0;
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL);
+    if (!devid) {
+        SDLTest_Log("Couldn't open an audio device (%s), skipping", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertCheck(SDL_PauseAudioDevice(devid), "Check result of SDL_PauseAudioDevice()");
+    SDLTest_AssertCheck(SDL_GetAudioDeviceFormat(devid, &spec, NULL), "Check result of SDL_GetAudioDeviceFormat()");
+    spec.format = SDL_AUDIO_F32;
+
+    data = (float *)SDL_malloc(num_samples * sizeof(float));
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(data && stream, "Expected the stream and sample buffer to be created")) {
+        goto cleanup;
+    }
+    for (i = 0; i < num_samples; ++i) {
+        data[i] = audio_mixLoudSample(i);
+    }
+    SDLTest_AssertCheck(SDL_PutAudioStreamData(stream, data, num_samples * sizeof(float)), "Check result of SDL_PutAudioStreamData()");
+
+    /* The postmix callback sees the stream's data after it has been mixed into an empty buffer */
+    SDLTest_AssertCheck(SDL_SetAudioPostmixCallback(devid, audio_mixPostmixCallback, NULL), "Check result of SDL_SetAudioPostmixCallback()");
+    if (!SDLTest_AssertCheck(SDL_BindAudioStream(devid, stream), "Check result of SDL_BindAudioStream()")) {
+        goto cleanup;
+    }
+    SDLTest_AssertCheck(SDL_ResumeAudioDevice(devid), "Check result of SDL_ResumeAudioDevice()");
+
+    for (i = 0; i < 2000 && !SDL_GetAtomicInt(&g_audio_mixCaptured); ++i) {
+        SDL_Delay(1);
+    }
+    SDL_PauseAudioDevice(devid);
+
+    if (!SDLTest_AssertCheck(g_audio_mixBuffer != NULL, "Expected the postmix callback to see a mixed buffer")) {
+        goto cleanup;
+    }
+    for (i = 0; i < (int)(g_audio_mixBufferLength / sizeof(float)); ++i) {
+        const float expected = SDL_clamp(audio_mixLoudSample(i), -1.0f, 1.0f);
+        if (g_audio_mixBuffer[i] != expected) {
+            if (errors++ < 10) {
+                SDLTest_LogError("Sample %d: expected %f, got %f", i, expected, g_audio_mixBuffer[i]);
+            }
+        }
+    }
+    SDLTest_AssertCheck(errors == 0, "Expected all %d mixed samples to be clamped, %d weren't", (int)(g_audio_mixBufferLength / sizeof(float)), errors);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_CloseAudioDevice(devid);
+    SDL_DestroyAudioStream(stream);
+    SDL_free(data);
+    SDL_free(g_audio_mixBuffer);
+    g_audio_mixBuffer = NULL;
+
+    return status;
+}
+
+/**
+ * Check resampling with every channel count, using a different tone in each channel,
+ * so a SIMD path that mixes up channels or filter taps won't go unnoticed.
+ *
+ * \sa SDL_CreateAudioStream
+ * \sa SDL_GetAudioStreamData
+ */
+static int SDLCALL audio_resampleChannels(void *arg)
+{
+  static const int rates[][2] = { { 44100, 48000 }, { 48000, 44100 }, { 22050, 48000 } };
+  const int time = 1;
+  int r, num_channels;
+
+  for (r = 0; r < (int)SDL_arraysize(rates); ++r) {
+    for (num_channels = 1; num_channels <= 8; ++num_channels) {
+      const int rate_in = rates[r][0];
+      const int rate_out = rates[r][1];
+      const int frames_in = time * rate_in;
+      const int frames_target = time * rate_out;
+      const int len_in = frames_in * num_channels * (int)sizeof(float);
+      const int len_target = frames_target * num_channels * (int)sizeof(float);
+      SDL_AudioSpec spec_in, spec_out;
+      SDL_AudioStream *stream;
+      float *buf_in = NULL;
+      float *buf_out = NULL;
+      int len_out;
+      int i, j;
+
+      SDL_zero(spec_in);
+      SDL_zero(spec_out);
+      spec_in.format = spec_out.format = SDL_AUDIO_F32;
+      spec_in.channels = spec_out.channels = num_channels;
+      spec_in.freq = rate_in;
+      spec_out.freq = rate_out;
+
+      stream = SDL_CreateAudioStream(&spec_in, &spec_out);
+      buf_in = (float *)SDL_malloc(len_in);
+      buf_out = (float *)SDL_malloc(len_target * 2);
+      if (!SDLTest_AssertCheck(stream && buf_in && buf_out, "Expected stream and buffers to be created.")) {
+        SDL_DestroyAudioStream(stream);
+        SDL_free(buf_in);
+        SDL_free(buf_out);
+        return TEST_ABORTED;
+      }
+
+      for (i = 0; i < frames_in; ++i) {
+        for (j = 0; j < num_channels; ++j) {
+          buf_in[(i * num_channels) + j] = (float)sine_wave_sample(i, rate_in, 300 + (j * 250), j * 0.5);
+        }
+      }
+
+      len_out = convert_audio_chunks(stream, buf_in, len_in, buf_out, len_target * 2);
+      SDLTest_AssertCheck(len_out == len_target, "Expected output length to be %i, got %i.", len_target, len_out);
+
+      if (len_out == len_target) {
+        for (j = 0; j < num_channels; ++j) {
+          double max_error = 0;
+          double sum_squared_error = 0;
+          double sum_squared_value = 0;
+          double signal_to_noise;
+
+          /* Skip both ends, where the resampler's window runs into silence */
+          for (i = 64; i < frames_target - 64; ++i) {
+            const double target = sine_wave_sample(i, rate_out, 300 + (j * 250), j * 0.5);
+            const double error = SDL_fabs(target - buf_out[(i * num_channels) + j]);
+            max_error = SDL_max(max_error, error);
+            sum_squared_error += error * error;
+            sum_squared_value += target * target;
+          }
+
+          signal_to_noise = 10 * SDL_log10(sum_squared_value / sum_squared_error);
+          SDLTest_AssertCheck(signal_to_noise >= 70.0 && max_error <= 0.005,
+                              "%i Hz -> %i Hz, channel %i of %i: signal-to-noise %f dB (expected >= 70), max error %f (expected <= 0.005)",
+                              rate_in, rate_out, j, num_channels, signal_to_noise, max_error);
+        }
+      }
+
+      SDL_DestroyAudioStream(stream);
+      SDL_free(buf_in);
+      SDL_free(buf_out);
+    }
+  }
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * Check that each resampler quality setting works, and that the higher settings are more accurate.
+ *
+ * \sa SDL_SetAudioStreamResamplerQuality
+ * \sa SDL_GetAudioStreamResamplerQuality
+ * \sa SDL_GetAudioStreamData
+ */
+static int SDLCALL audio_resamplerQuality(void *arg)
+{
+  static const SDL_AudioResamplerQuality qualities[] = {
+    SDL_AUDIO_RESAMPLER_QUALITY_FAST,
+    SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM,
+    SDL_AUDIO_RESAMPLER_QUALITY_HIGH,
+    (SDL_AudioResamplerQuality)1000  /* invalid, should be rejected, leaving SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM */
+  };
+  static const int rates[][2] = { { 44100, 48000 }, { 48000, 22050 } };
+  const int freq = 1000;
+  int r, q;
+
+  SDLTest_AssertCheck(SDL_GetAudioStreamResamplerQuality(NULL) == SDL_AUDIO_RESAMPLER_QUALITY_INVALID,
+                      "Expected SDL_GetAudioStreamResamplerQuality(NULL) to return SDL_AUDIO_RESAMPLER_QUALITY_INVALID.");
+
+  for (r = 0; r < (int)SDL_arraysize(rates); ++r) {
+    const int rate_in = rates[r][0];
+    const int rate_out = rates[r][1];
+    const int frames_in = rate_in;
+    const int frames_target = rate_out;
+    const int len_in = frames_in * (int)sizeof(float);
+    const int len_target = frames_target * (int)sizeof(float);
+    double signal_to_noise[SDL_arraysize(qualities)];
+    SDL_AudioSpec spec_in, spec_out;
+    float *buf_in;
+    float *buf_out;
+    int i;
+
+    SDL_zero(spec_in);
+    spec_in.format = SDL_AUDIO_F32;
+    spec_in.channels = 1;
+    spec_in.freq = rate_in;
+    spec_out = spec_in;
+    spec_out.freq = rate_out;
+
+    buf_in = (float *)SDL_malloc(len_in);
+    buf_out = (float *)SDL_malloc(len_target * 2);
+    if (!SDLTest_AssertCheck(buf_in && buf_out, "Expected buffers to be allocated.")) {
+      SDL_free(buf_in);
+      SDL_free(buf_out);
+      return TEST_ABORTED;
+    }
+
+    for (i = 0; i < frames_in; ++i) {
+      buf_in[i] = (float)sine_wave_sample(i, rate_in, freq, 0.0);
+    }
+
+    for (q = 0; q < (int)SDL_arraysize(qualities); ++q) {
+      SDL_AudioStream *stream = SDL_CreateAudioStream(&spec_in, &spec_out);
+      double sum_squared_error = 0;
+      double sum_squared_value = 0;
+      int len_out;
+
+      if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.")) {
+        SDL_free(buf_in);
+        SDL_free(buf_out);
+        return TEST_ABORTED;
+      }
+
+      SDLTest_AssertCheck(SDL_GetAudioStreamResamplerQuality(stream) == SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM,
+                          "Expected the default resampler quality to be medium.");
+      if (qualities[q] <= SDL_AUDIO_RESAMPLER_QUALITY_HIGH) {
+        SDLTest_AssertCheck(SDL_SetAudioStreamResamplerQuality(stream, qualities[q]),
+                            "Expected SDL_SetAudioStreamResamplerQuality to succeed.");
+        SDLTest_AssertCheck(SDL_GetAudioStreamResamplerQuality(stream) == qualities[q],
+                            "Expected SDL_GetAudioStreamResamplerQuality to return the new quality.");
+      } else {
+        SDLTest_AssertCheck(!SDL_SetAudioStreamResamplerQuality(stream, qualities[q]),
+                            "Expected SDL_SetAudioStreamResamplerQuality to reject an invalid quality.");
+        SDLTest_AssertCheck(SDL_GetAudioStreamResamplerQuality(stream) == SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM,
+                            "Expected the resampler quality to stay medium.");
+      }
+
+      len_out = convert_audio_chunks(stream, buf_in, len_in, buf_out, len_target * 2);
+      SDLTest_AssertCheck(len_out == len_target, "Quality %d, %i Hz -> %i Hz: expected output length to be %i, got %i.",
+                          (int)qualities[q], rate_in, rate_out, len_target, len_out);
+      SDL_DestroyAudioStream(stream);
+
+      /* Skip both ends, where the resampler's window runs into silence */
+      for (i = 64; i < frames_target - 64; ++i) {
+        const double target = sine_wave_sample(i, rate_out, freq, 0.0);
+        const double error = target - buf_out[i];
+        sum_squared_error += error * error;
+        sum_squared_value += target * target;
+      }
+      signal_to_noise[q] = 10 * SDL_log10(sum_squared_value / sum_squared_error);
+      SDLTest_Log("Quality %d, %i Hz -> %i Hz: signal-to-noise %f dB", (int)qualities[q], rate_in, rate_out, signal_to_noise[q]);
+    }
+
+    SDLTest_AssertCheck(signal_to_noise[0] >= 40.0, "Expected fast resampling to have a signal-to-noise ratio >= 40 dB, got %f.", signal_to_noise[0]);
+    SDLTest_AssertCheck(signal_to_noise[1] >= 70.0, "Expected medium resampling to have a signal-to-noise ratio >= 70 dB, got %f.", signal_to_noise[1]);
+    SDLTest_AssertCheck(signal_to_noise[1] > signal_to_noise[0], "Expected medium resampling to be more accurate than fast.");
+    SDLTest_AssertCheck(signal_to_noise[2] > signal_to_noise[1], "Expected high resampling to be more accurate than medium.");
+    SDLTest_AssertCheck(signal_to_noise[3] == signal_to_noise[1], "Expected a stream with an invalid quality rejected to resample like medium.");
+
+    SDL_free(buf_in);
+    SDL_free(buf_out);
+  }
+
+  return TEST_COMPLETED;
+}
+
+typedef struct NoCopyReleaseState
+{
+  int calls;
+  const void *buf;
+  int len;
+} NoCopyReleaseState;
+
+static void SDLCALL audio_noCopyReleaseCallback(void *userdata, const void *buf, int buflen)
+{
+  NoCopyReleaseState *state = (NoCopyReleaseState *)userdata;
+  state->calls++;
+  state->buf = buf;
+  state->len = buflen;
+}
+
+/**
+ * Check that SDL_PutAudioStreamDataNoCopy reads from the app's buffer, and hands it back exactly once.
+ *
+ * \sa SDL_PutAudioStreamDataNoCopy
+ */
+static int SDLCALL audio_putNoCopy(void *arg)
+{
+  const int num_frames = 4096;
+  const int len = num_frames * 2 * (int)sizeof(Sint16);
+  SDL_AudioSpec spec, resampled_spec;
+  NoCopyReleaseState state;
+  SDL_AudioStream *stream;
+  SDL_AudioStream *copied;
+  Sint16 *buf = (Sint16 *)SDL_malloc(len);
+  Sint16 *out = (Sint16 *)SDL_malloc(len * 2);
+  Sint16 *out_copied = (Sint16 *)SDL_malloc(len * 2);
+  int i, got, got_copied, pass;
+
+  if (!SDLTest_AssertCheck(buf && out && out_copied, "Expected buffers to be allocated.")) {
+    SDL_free(buf);
+    SDL_free(out);
+    SDL_free(out_copied);
+    return TEST_ABORTED;
+  }
+
+  spec.format = SDL_AUDIO_S16;
+  spec.channels = 2;
+  spec.freq = 48000;
+  for (i = 0; i < num_frames * 2; ++i) {
+    buf[i] = (Sint16)(i * 3);
+  }
+
+  /* The stream should read the app's buffer, not a copy of it */
+  stream = SDL_CreateAudioStream(&spec, &spec);
+  SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed.");
+  SDL_zero(state);
+  SDLTest_AssertCheck(SDL_PutAudioStreamDataNoCopy(stream, buf, len, audio_noCopyReleaseCallback, &state), "Expected SDL_PutAudioStreamDataNoCopy to succeed.");
+  for (i = 0; i < num_frames * 2; ++i) {
+    buf[i] = (Sint16)(i * 5);
+  }
+  got = SDL_GetAudioStreamData(stream, out, len / 2);
+  SDLTest_AssertCheck(got == len / 2, "Expected to read %d bytes, got %d.", len / 2, got);
+  SDLTest_AssertCheck(state.calls == 0, "Expected the buffer to still be in use after a partial read.");
+  got += SDL_GetAudioStreamData(stream, (Uint8 *)out + got, len);
+  SDLTest_AssertCheck(got == len, "Expected to read %d bytes, got %d.", len, got);
+  SDLTest_AssertCheck(SDL_memcmp(out, buf, len) == 0, "Expected the stream to read the buffer in place.");
+  SDLTest_AssertCheck(state.calls == 1 && state.buf == buf && state.len == len,
+                      "Expected one release of the buffer once it was read, got %d calls.", state.calls);
+
+  /* Flushed data is released once read, too */
+  SDL_zero(state);
+  SDL_PutAudioStreamDataNoCopy(stream, buf, len, audio_noCopyReleaseCallback, &state);
+  SDL_FlushAudioStream(stream);
+  got = SDL_GetAudioStreamData(stream, out, len);
+  SDLTest_AssertCheck(got == len && state.calls == 1, "Expected flushed data to be released once read, got %d bytes and %d calls.", got, state.calls);
+
+  /* Clearing and destroying the stream release the buffer */
+  SDL_zero(state);
+  SDL_PutAudioStreamDataNoCopy(stream, buf, len, audio_noCopyReleaseCallback, &state);
+  SDL_ClearAudioStream(stream);
+  SDLTest_AssertCheck(state.calls == 1, "Expected SDL_ClearAudioStream to release the buffer, got %d calls.", state.calls);
+  SDL_zero(state);
+  SDL_PutAudioStreamDataNoCopy(stream, buf, len, audio_noCopyReleaseCallback, &state);
+  SDL_DestroyAudioStream(stream);
+  SDLTest_AssertCheck(state.calls == 1, "Expected SDL_DestroyAudioStream to release the buffer, got %d calls.", state.calls);
+
+  /* Empty buffers are released right away */
+  stream = SDL_CreateAudioStream(&spec, &spec);
+  SDL_zero(state);
+  SDLTest_AssertCheck(SDL_PutAudioStreamDataNoCopy(stream, buf, 0, audio_noCopyReleaseCallback, &state) && state.calls == 1,
+                      "Expected an empty buffer to be released immediately.");
+  SDLTest_AssertCheck(SDL_PutAudioStreamDataNoCopy(stream, buf, len, NULL, NULL), "Expected a NULL callback to be allowed.");
+  SDL_DestroyAudioStream(stream);
+
+  /* Resampled output must match copied input, even when buffers are released between reads */
+  resampled_spec = spec;
+  resampled_spec.freq = 44100;
+  stream = SDL_CreateAudioStream(&spec, &resampled_spec);
+  copied = SDL_CreateAudioStream(&spec, &resampled_spec);
+  SDL_zero(state);
+  got = got_copied = 0;
+  for (pass = 0; pass < 4; ++pass) {
+    const int chunk = len / 4;
+    SDL_PutAudioStreamDataNoCopy(stream, (Uint8 *)buf + (pass * chunk), chunk, audio_noCopyReleaseCallback, &state);
+    SDL_PutAudioStreamData(copied, (Uint8 *)buf + (pass * chunk), chunk);
+    if (pass == 3) {
+      SDL_FlushAudioStream(stream);
+      SDL_FlushAudioStream(copied);
+    }
+    got += SDL_GetAudioStreamData(stream, (Uint8 *)out + got, len * 2 - got);
+    got_copied += SDL_GetAudioStreamData(copied, (Uint8 *)out_copied + got_copied, len * 2 - got_copied);
+  }
+  SDLTest_AssertCheck(got == got_copied && got > 0, "Expected both streams to produce the same amount of data, got %d and %d bytes.", got, got_copied);
+  SDLTest_AssertCheck(SDL_memcmp(out, out_copied, SDL_min(got, got_copied)) == 0, "Expected both streams to produce the same data.");
+  SDLTest_AssertCheck(state.calls == 4, "Expected all 4 buffers to be released, got %d calls.", state.calls);
+  SDL_DestroyAudioStream(stream);
+  SDL_DestroyAudioStream(copied);
+
+  SDL_free(buf);
+  SDL_free(out);
+  SDL_free(out_copied);
+  return TEST_COMPLETED;
+}
+
+/**
+ * Check that stream gain is applied exactly, including buffer tails that SIMD code handles separately.
+ *
+ * \sa SDL_SetAudioStreamGain
+ * \sa SDL_GetAudioStreamData
+ */
+static int SDLCALL audio_streamGain(void *arg)
+{
+    static const int lengths[] = { 1, 3, 15, 16, 17, 31, 33, 1000, 1027 };
+    SDL_AudioSpec spec;
+    SDL_AudioStream *stream;
+    float input[1027 + 1];
+    float output[1027 + 1];
+    int i, j;
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 1;
+    spec.freq = 48000;
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(stream, 0.25f), "Check result of SDL_SetAudioStreamGain()");
+
+    for (i = 0; i < (int)SDL_arraysize(lengths); ++i) {
+        const int len = lengths[i];
+        int errors = 0;
+        int got;
+
+        for (j = 0; j < len; ++j) {
+            input[j] = audio_mixTestSample(0, j + i);
+        }
+        SDLTest_AssertCheck(SDL_PutAudioStreamData(stream, input, len * sizeof(float)), "Check result of SDL_PutAudioStreamData()");
+
+        /* read into an offset buffer too, to make sure unaligned destinations are handled */
+        got = SDL_GetAudioStreamData(stream, &output[i & 1], len * sizeof(float));
+        SDLTest_AssertCheck(got == (int)(len * sizeof(float)), "Expected %d bytes, got %d", (int)(len * sizeof(float)), got);
+
+        for (j = 0; j < len; ++j) {
+            if (output[j + (i & 1)] != input[j] * 0.25f) {
+                ++errors;
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Expected all %d samples to be scaled exactly, %d weren't", len, errors);
+    }
+
+    SDL_DestroyAudioStream(stream);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that converting between channel layouts matches the generated converters, and their matrices.
+ *
+ * SDL can use a SIMD version of the matrix instead of the generated converter, so this
+ * checks every layout pair, with frame counts that leave different numbers of frames over.
+ *
+ * \sa SDL_ConvertAudioSamples
+ */
+static int SDLCALL audio_convertChannels(void *arg)
+{
+    static const int frame_counts[] = { 1, 2, 3, 4, 5, 7, 8, 1001 };
+    const int max_frames = 1001;
+    float *src = (float *)SDL_malloc(max_frames * 8 * sizeof(float));
+    float *expected = (float *)SDL_malloc(max_frames * 8 * sizeof(float));
+    int src_channels, dst_channels;
+    int i, j, k, c;
+
+    SDLTest_AssertCheck(src && expected, "Check buffer allocation");
+    if (!src || !expected) {
+        SDL_free(src);
+        SDL_free(expected);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < max_frames * 8; ++i) {
+        src[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+    }
+
+    for (src_channels = 1; src_channels <= 8; ++src_channels) {
+        for (dst_channels = 1; dst_channels <= 8; ++dst_channels) {
+            const SDL_AudioChannelConverter converter = channel_converters[src_channels - 1][dst_channels - 1];
+            const float *matrix = channel_conversion_matrices[src_channels - 1][dst_channels - 1];
+            SDL_AudioSpec src_spec, dst_spec;
+            float max_converter_error = 0.0f;
+            float max_matrix_error = 0.0f;
+            bool converted = true;
+
+            if (src_channels == dst_channels) {
+                continue;
+            }
+
+            src_spec.format = SDL_AUDIO_F32;
+            src_spec.channels = src_channels;
+            src_spec.freq = 48000;
+            SDL_copyp(&dst_spec, &src_spec);
+            dst_spec.channels = dst_channels;
+
+            for (i = 0; i < (int)SDL_arraysize(frame_counts); ++i) {
+                const int num_frames = frame_counts[i];
+                float *output = NULL;
+                int output_len = 0;
+
+                if (!SDL_ConvertAudioSamples(&src_spec, (const Uint8 *)src, num_frames * src_channels * (int)sizeof(float),
+                                             &dst_spec, (Uint8 **)&output, &output_len) ||
+                    output_len != num_frames * dst_channels * (int)sizeof(float)) {
+                    converted = false;
+                    SDL_free(output);
+                    break;
+                }
+
+                converter(expected, src, num_frames);
+
+                for (j = 0; j < num_frames; ++j) {
+                    for (k = 0; k < dst_channels; ++k) {
+                        const float actual = output[j * dst_channels + k];
+                        float sum = 0.0f;
+
+                        for (c = 0; c < src_channels; ++c) {
+                            sum += src[j * src_channels + c] * matrix[k * src_channels + c];
+                        }
+                        max_converter_error = SDL_max(max_converter_error, SDL_fabsf(actual - expected[j * dst_channels + k]));
+                        max_matrix_error = SDL_max(max_matrix_error, SDL_fabsf(actual - sum));
+                    }
+                }
+                SDL_free(output);
+            }
+
+            SDLTest_AssertCheck(converted, "Expected converting %d to %d channels to succeed", src_channels, dst_channels);
+            SDLTest_AssertCheck(max_converter_error <= 1e-6f && max_matrix_error <= 1e-6f,
+                                "Converting %d to %d channels: expected output to match the generated converter and matrix, max errors %g and %g",
+                                src_channels, dst_channels, max_converter_error, max_matrix_error);
+        }
+    }
+
+    SDL_free(src);
+    SDL_free(expected);
+    return TEST_COMPLETED;
+}
+
+/* Writes a WAVE file with random audio data. Only `written` bytes of the
+   `datalength` byte data chunk are actually written, to test truncated files. */
+static SDL_IOStream *CreateTestWAV(Uint16 encoding, Uint16 channels, Uint16 bits, Uint16 blockalign, Uint32 datalength, Uint32 written)
+{
+    static const Sint16 ms_adpcm_coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+    SDL_IOStream *io = SDL_IOFromDynamicMem();
+    Uint16 extsize = 0;
+    Uint16 samplesperblock = 0;
+    Uint32 i;
+
+    if (!io) {
+        return NULL;
+    }
+
+    if (encoding == 0x0002) { /* MS ADPCM */
+        extsize = 4 + 7 * 4;
+        samplesperblock = (Uint16)((blockalign - channels * 7) * 8 / (4 * channels) + 2);
+    } else if (encoding == 0x0011) { /* IMA ADPCM */
+        extsize = 2;
+        samplesperblock = (Uint16)((blockalign - channels * 4) * 8 / (4 * channels) + 1);
+    }
+
+    SDL_WriteU32LE(io, 0x46464952); /* RIFF */
+    SDL_WriteU32LE(io, 4 + 8 + 18 + extsize + 8 + datalength);
+    SDL_WriteU32LE(io, 0x45564157); /* WAVE */
+    SDL_WriteU32LE(io, 0x20746D66); /* fmt */
+    SDL_WriteU32LE(io, 18 + extsize);
+    SDL_WriteU16LE(io, encoding);
+    SDL_WriteU16LE(io, channels);
+    SDL_WriteU32LE(io, 22050);
+    SDL_WriteU32LE(io, 22050 * blockalign);
+    SDL_WriteU16LE(io, blockalign);
+    SDL_WriteU16LE(io, bits);
+    SDL_WriteU16LE(io, extsize);
+    if (encoding == 0x0002) {
+        SDL_WriteU16LE(io, samplesperblock);
+        SDL_WriteU16LE(io, 7);
+        for (i = 0; i < SDL_arraysize(ms_adpcm_coeffs); ++i) {
+            SDL_WriteS16LE(io, ms_adpcm_coeffs[i]);
+        }
+    } else if (encoding == 0x0011) {
+        SDL_WriteU16LE(io, samplesperblock);
+    }
+    SDL_WriteU32LE(io, 0x61746164); /* data */
+    SDL_WriteU32LE(io, datalength);
+
+    for (i = 0; i < written; ++i) {
+        Uint8 value = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+        const Uint32 headerpos = i % blockalign;
+
+        if (encoding == 0x0002 && headerpos < channels) {
+            value %= 7; /* The predictor has to be one of the coefficient pairs */
+        } else if (encoding == 0x0011 && headerpos < channels * 4u && headerpos % 4 == 3) {
+            value = 0; /* Reserved byte */
+        }
+        SDL_WriteU8(io, value);
+    }
+
+    SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+    return io;
+}
+
+/**
+ * Check that the streaming WAVE decoder matches SDL_LoadWAV_IO, including after seeking.
+ *
+ * \sa SDL_CreateWAVDecoder
+ * \sa SDL_ReadWAVDecoder
+ * \sa SDL_PutWAVDecoderData
+ * \sa SDL_SeekWAVDecoder
+ */
+static int SDLCALL audio_wavDecoder(void *arg)
+{
+    static const struct
+    {
+        const char *name;
+        Uint16 encoding;
+        Uint16 channels;
+        Uint16 bits;
+        Uint16 blockalign;
+    } formats[] = {
+        { "8-bit PCM", 0x0001, 1, 8, 1 },
+        { "16-bit PCM", 0x0001, 2, 16, 4 },
+        { "24-bit PCM", 0x0001, 2, 24, 6 },
+        { "32-bit PCM", 0x0001, 1, 32, 4 },
+        { "float", 0x0003, 6, 32, 24 },
+        { "A-law", 0x0006, 2, 8, 2 },
+        { "mu-law", 0x0007, 1, 8, 1 },
+        { "MS ADPCM mono", 0x0002, 1, 4, 256 },
+        { "MS ADPCM stereo", 0x0002, 2, 4, 512 },
+        { "IMA ADPCM mono", 0x0011, 1, 4, 256 },
+        { "IMA ADPCM stereo", 0x0011, 2, 4, 1024 },
+    };
+    const Uint32 datalength = 100000;
+    Uint8 *decoded = (Uint8 *)SDL_malloc(200000 * 4);
+    int i, truncated;
+
+    SDLTest_AssertCheck(decoded != NULL, "Check buffer allocation");
+    if (!decoded) {
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        for (truncated = 0; truncated <= 1; ++truncated) {
+            /* Cut the data off in the middle of a block */
+            const Uint32 written = truncated ? datalength - formats[i].blockalign * 3 - formats[i].blockalign / 2 - 1 : datalength;
+            const Uint32 declared = datalength - (datalength % formats[i].blockalign);
+            SDL_IOStream *io = CreateTestWAV(formats[i].encoding, formats[i].channels, formats[i].bits, formats[i].blockalign, declared, SDL_min(written, declared));
+            SDL_WAVDecoder *decoder = NULL;
+            SDL_AudioStream *stream = NULL;
+            SDL_AudioSpec spec, decoder_spec;
+            Uint8 *audio_buf = NULL;
+            Uint32 audio_len = 0;
+            Sint64 frames;
+            int framesize, total, amount, seek;
+
+            SDLTest_AssertCheck(io != NULL, "Create %s%s test file", truncated ? "truncated " : "", formats[i].name);
+            if (!io) {
+                continue;
+            }
+
+            if (!SDL_LoadWAV_IO(io, false, &spec, &audio_buf, &audio_len)) {
+                SDLTest_AssertCheck(false, "SDL_LoadWAV_IO() of %s failed: %s", formats[i].name, SDL_GetError());
+                SDL_CloseIO(io);
+                continue;
+            }
+            SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+
+            decoder = SDL_CreateWAVDecoder(io, true, &decoder_spec);
+            SDLTest_AssertCheck(decoder != NULL, "Call to SDL_CreateWAVDecoder() with %s%s", truncated ? "truncated " : "", formats[i].name);
+            if (!decoder) {
+                SDL_free(audio_buf);
+                continue;
+            }
+            SDLTest_AssertCheck(SDL_memcmp(&spec, &decoder_spec, sizeof(spec)) == 0, "Check decoder spec matches SDL_LoadWAV_IO()");
+
+            framesize = SDL_AUDIO_FRAMESIZE(spec);
+            frames = SDL_GetWAVDecoderLength(decoder);
+            SDLTest_AssertCheck(frames * framesize == audio_len, "Check decoder length, expected %d, got %d frames", (int)(audio_len / framesize), (int)frames);
+
+            /* Read the whole file in odd amounts */
+            total = 0;
+            while ((amount = SDL_ReadWAVDecoder(decoder, decoded + total, 997 * framesize + 1)) > 0) {
+                total += amount;
+            }
+            SDLTest_AssertCheck(amount == 0, "Check SDL_ReadWAVDecoder() reached the end");
+            SDLTest_AssertCheck(total == (int)audio_len && SDL_memcmp(decoded, audio_buf, audio_len) == 0,
+                                "Check decoded %s data matches SDL_LoadWAV_IO(), expected %d bytes, got %d", formats[i].name, (int)audio_len, total);
+            SDLTest_AssertCheck(SDL_TellWAVDecoder(decoder) == frames, "Check position is at the end");
+
+            /* Seek around and check the data after each seek */
+            for (seek = 0; seek < 20 && frames > 0; ++seek) {
+                const Sint64 frame = SDLTest_RandomIntegerInRange(0, (Sint32)frames);
+                const int expected = (int)SDL_min((frames - frame) * framesize, 3000 * framesize);
+
+                SDL_SeekWAVDecoder(decoder, frame);
+                SDLTest_AssertCheck(SDL_TellWAVDecoder(decoder) == frame, "Check position after seek");
+                amount = SDL_ReadWAVDecoder(decoder, decoded, 3000 * framesize);
+                if (amount != expected || SDL_memcmp(decoded, audio_buf + frame * framesize, expected) != 0) {
+                    SDLTest_AssertCheck(false, "Check %s data after seeking to frame %d", formats[i].name, (int)frame);
+                    break;
+                }
+            }
+
+            /* Feed an audio stream from the start */
+            stream = SDL_CreateAudioStream(&spec, &spec);
+            SDLTest_AssertCheck(stream != NULL, "Call to SDL_CreateAudioStream()");
+            if (stream) {
+                SDL_SeekWAVDecoder(decoder, 0);
+                total = 0;
+                while ((amount = SDL_PutWAVDecoderData(decoder, stream, 4000)) > 0) {
+                    total += amount;
+                }
+                SDLTest_AssertCheck(amount == 0 && total == frames, "Check SDL_PutWAVDecoderData() put %d frames, got %d", (int)frames, total);
+                SDL_FlushAudioStream(stream);
+                amount = SDL_GetAudioStreamData(stream, decoded, audio_len + framesize);
+                SDLTest_AssertCheck(amount == (int)audio_len && SDL_memcmp(decoded, audio_buf, audio_len) == 0, "Check audio stream data matches SDL_LoadWAV_IO()");
+                SDL_DestroyAudioStream(stream);
+            }
+
+            SDL_DestroyWAVDecoder(decoder);
+            SDL_free(audio_buf);
+        }
+    }
+
+    SDL_free(decoded);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1541,13 +2586,53 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_mixStreams, "audio_mixStreams", "Mix several streams with different gains through a device.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_streamGain, "audio_streamGain", "Check stream gain on buffers of various lengths.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_mixStreamsThreaded, "audio_mixStreamsThreaded", "Mix several streams on the audio mix threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_resampleChannels, "audio_resampleChannels", "Check resampling with every channel count.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest23 = {
+    audio_resamplerQuality, "audio_resamplerQuality", "Check each resampler quality setting.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest24 = {
+    audio_putNoCopy, "audio_putNoCopy", "Queue data without copying it.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest25 = {
+    audio_convertChannels, "audio_convertChannels", "Check channel conversion against the generated converters.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest26 = {
+    audio_wavDecoder, "audio_wavDecoder", "Check the streaming WAVE decoder against SDL_LoadWAV_IO.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest27 = {
+    audio_mixStreamsThreadedResampled, "audio_mixStreamsThreadedResampled", "Check the audio mix threads match the serial mix for resampled streams.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest28 = {
+    audio_mixClamp, "audio_mixClamp", "Check a lone stream is clamped when it's mixed.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTestGetAudioFormatName,
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22, &audioTest23, &audioTest24, &audioTest25, &audioTest26, &audioTest27, &audioTest28, NULL
 };
 
 /* Audio test suite (global) */
@@ -304,6 +304,82 @@ static int SDLCALL events_mainThreadCallbacks(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Test retrieving and flushing events by type while other events are queued.
+ *
+ * \sa SDL_HasEvent
+ * \sa SDL_PeepEvents
+ * \sa SDL_GetEventsByType
+ * \sa SDL_FlushEvent
+ */
+static int SDLCALL events_filteredRetrieval(void *arg)
+{
+    static const Uint32 pushed_types[] = {
+        SDL_EVENT_USER, SDL_EVENT_KEY_DOWN, SDL_EVENT_USER + 1, SDL_EVENT_USER + 2,
+        SDL_EVENT_USER, SDL_EVENT_KEY_DOWN, SDL_EVENT_USER + 2, SDL_EVENT_USER + 1
+    };
+    const Uint32 drained_types[] = { SDL_EVENT_USER + 2, SDL_EVENT_KEY_DOWN };
+    SDL_Event events[SDL_arraysize(pushed_types)];
+    int result;
+    int i;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    for (i = 0; i < SDL_arraysize(pushed_types); ++i) {
+        SDL_Event event;
+
+        SDL_zero(event);
+        event.type = pushed_types[i];
+        if (event.type == SDL_EVENT_KEY_DOWN) {
+            event.key.which = (SDL_KeyboardID)i;
+        } else {
+            event.user.code = i;
+        }
+        SDLTest_AssertCheck(SDL_PushEvent(&event), "Call to SDL_PushEvent(), event %d", i);
+    }
+
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_USER + 1), "Check SDL_HasEvent(SDL_EVENT_USER + 1) returns true");
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER + 3), "Check SDL_HasEvent(SDL_EVENT_USER + 3) returns false");
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_KEY_UP), "Check SDL_HasEvent(SDL_EVENT_KEY_UP) returns false");
+
+    result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_EVENT_USER, SDL_EVENT_USER + 1);
+    SDLTest_AssertCheck(result == 4, "Check SDL_PeepEvents() counts matching events, expected: 4, got: %d", result);
+
+    result = SDL_PeepEvents(events, 1, SDL_PEEKEVENT, SDL_EVENT_USER + 1, SDL_EVENT_USER + 1);
+    SDLTest_AssertCheck(result == 1 && events[0].user.code == 2, "Check SDL_PeepEvents() peeks the oldest matching event, expected code 2, got: %d", result == 1 ? events[0].user.code : -1);
+
+    /* Drain events from two categories, they should come back in the order they were pushed */
+    result = SDL_GetEventsByType(events, SDL_arraysize(events), drained_types, SDL_arraysize(drained_types));
+    SDLTest_AssertCheck(result == 4, "Check SDL_GetEventsByType() result, expected: 4, got: %d", result);
+    if (result == 4) {
+        SDLTest_AssertCheck(events[0].type == SDL_EVENT_KEY_DOWN && events[0].key.which == 1, "Check event 0 is the first key event");
+        SDLTest_AssertCheck(events[1].type == SDL_EVENT_USER + 2 && events[1].user.code == 3, "Check event 1 is user event 3");
+        SDLTest_AssertCheck(events[2].type == SDL_EVENT_KEY_DOWN && events[2].key.which == 5, "Check event 2 is the second key event");
+        SDLTest_AssertCheck(events[3].type == SDL_EVENT_USER + 2 && events[3].user.code == 6, "Check event 3 is user event 6");
+    }
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_KEY_DOWN), "Check SDL_HasEvent(SDL_EVENT_KEY_DOWN) returns false after draining");
+
+    result = SDL_GetEventsByType(events, SDL_arraysize(events), drained_types, SDL_arraysize(drained_types));
+    SDLTest_AssertCheck(result == 0, "Check SDL_GetEventsByType() on drained types, expected: 0, got: %d", result);
+
+    SDL_FlushEvent(SDL_EVENT_USER + 1);
+    SDLTest_AssertCheck(!SDL_HasEvent(SDL_EVENT_USER + 1), "Check SDL_HasEvent(SDL_EVENT_USER + 1) returns false after flushing");
+
+    /* Only the two SDL_EVENT_USER events should be left */
+    result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_LAST);
+    SDLTest_AssertCheck(result == 2, "Check remaining user events, expected: 2, got: %d", result);
+    if (result == 2) {
+        SDLTest_AssertCheck(events[0].user.code == 0 && events[1].user.code == 4, "Check remaining user events are in order, expected: 0 4, got: %d %d", events[0].user.code, events[1].user.code);
+    }
+
+    result = SDL_GetEventsByType(events, SDL_arraysize(events), NULL, 0);
+    SDLTest_AssertCheck(result == -1, "Check SDL_GetEventsByType() with no types fails, expected: -1, got: %d", result);
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -323,12 +399,17 @@ static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
     events_mainThreadCallbacks, "events_mainThreadCallbacks", "Run callbacks on the main thread", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_filteredRetrieval = {
+    events_filteredRetrieval, "events_filteredRetrieval", "Retrieves and flushes events by type while other events are queued", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
     &eventsTest_mainThreadCallbacks,
+    &eventsTest_filteredRetrieval,
     NULL
 };
 
@@ -271,6 +271,69 @@ static int SDLCALL hints_setHint(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Checks that cached hint values follow changes to the hint and the environment
+ */
+static int SDLCALL hints_cachedHint(void *arg)
+{
+    const char *testHint = "SDL_AUTOMATED_TEST_CACHED_HINT";
+    SDL_HintCache cache;
+    Uint32 generation;
+    Uint64 start, uncached, cached;
+    bool value;
+    int i, count;
+
+    SDL_zero(cache);
+    SDL_ResetHint(testHint);
+
+    generation = SDL_GetHintGeneration();
+    SDLTest_AssertCheck(generation != 0 && (generation & 1) == 0, "Hint generation should be even and nonzero, was %" SDL_PRIu32, generation);
+
+    value = SDL_GetCachedHintBoolean(testHint, true, &cache);
+    SDLTest_AssertCheck(value, "Unset hint should return the default value");
+    value = SDL_GetCachedHintBoolean(testHint, false, &cache);
+    SDLTest_AssertCheck(value, "Unchanged hint should return the cached value");
+
+    SDL_SetHint(testHint, "0");
+    SDLTest_AssertCheck(SDL_GetHintGeneration() != generation, "Setting a hint should change the hint generation");
+    value = SDL_GetCachedHintBoolean(testHint, true, &cache);
+    SDLTest_AssertCheck(!value, "Cached hint should follow SDL_SetHint()");
+
+    SDL_ResetHint(testHint);
+    value = SDL_GetCachedHintBoolean(testHint, true, &cache);
+    SDLTest_AssertCheck(value, "Cached hint should follow SDL_ResetHint()");
+
+    SDL_SetEnvironmentVariable(SDL_GetEnvironment(), testHint, "0", true);
+    value = SDL_GetCachedHintBoolean(testHint, true, &cache);
+    SDLTest_AssertCheck(!value, "Cached hint should follow SDL_SetEnvironmentVariable()");
+
+    SDL_UnsetEnvironmentVariable(SDL_GetEnvironment(), testHint);
+    value = SDL_GetCachedHintBoolean(testHint, true, &cache);
+    SDLTest_AssertCheck(value, "Cached hint should follow SDL_UnsetEnvironmentVariable()");
+
+    value = SDL_GetCachedHintBoolean(testHint, false, NULL);
+    SDLTest_AssertCheck(!value, "Hint without a cache should return the default value");
+
+    /* Compare the cost of looking up a hint with using the cache */
+    SDL_SetHint(testHint, "1");
+    count = 0;
+    start = SDL_GetTicksNS();
+    for (i = 0; i < 100000; ++i) {
+        count += SDL_GetHintBoolean(testHint, false);
+    }
+    uncached = SDL_GetTicksNS() - start;
+    start = SDL_GetTicksNS();
+    for (i = 0; i < 100000; ++i) {
+        count += SDL_GetCachedHintBoolean(testHint, false, &cache);
+    }
+    cached = SDL_GetTicksNS() - start;
+    SDLTest_AssertCheck(count == 200000, "Hint should always be true, was true %d times", count);
+    SDLTest_Log("Hint lookup: %.2f ns uncached, %.2f ns cached", (double)uncached / 100000, (double)cached / 100000);
+    SDL_ResetHint(testHint);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Hints test cases */
@@ -282,10 +345,15 @@ static const SDLTest_TestCaseReference hintsSetHint = {
     hints_setHint, "hints_setHint", "Call to SDL_SetHint", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference hintsCachedHint = {
+    hints_cachedHint, "hints_cachedHint", "Call to SDL_GetCachedHintBoolean", TEST_ENABLED
+};
+
 /* Sequence of Hints test cases */
 static const SDLTest_TestCaseReference *hintsTests[] = {
     &hintsGetHint,
     &hintsSetHint,
+    &hintsCachedHint,
     NULL
 };
 
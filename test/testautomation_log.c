@@ -26,6 +26,141 @@ static void DisableTestLog(void)
     SDL_SetLogOutputFunction(original_function, original_userdata);
 }
 
+typedef struct AsyncLogState
+{
+    SDL_ThreadID thread;
+    SDL_AtomicInt gate;
+    int count;
+    int last;
+    bool in_order;
+    bool on_writer_thread;
+    bool long_messages_intact;
+} AsyncLogState;
+
+#define ASYNC_LONG_MESSAGE_LENGTH 1000
+
+static void SDLCALL AsyncTestLogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+    AsyncLogState *state = (AsyncLogState *)userdata;
+    const int sequence = SDL_atoi(message);
+
+    /* Hold up the writer thread until the test lets it go */
+    while (!SDL_GetAtomicInt(&state->gate)) {
+        SDL_Delay(1);
+    }
+
+    if (sequence <= state->last) {
+        state->in_order = false;
+    }
+    if (SDL_GetCurrentThreadID() == state->thread) {
+        state->on_writer_thread = false;
+    }
+    if ((sequence % 100) == 0 && SDL_strlen(message) != ASYNC_LONG_MESSAGE_LENGTH) {
+        state->long_messages_intact = false;
+    }
+    state->last = sequence;
+    ++state->count;
+}
+
+static void EnableAsyncTestLog(AsyncLogState *state, bool gate)
+{
+    state->thread = SDL_GetCurrentThreadID();
+    SDL_SetAtomicInt(&state->gate, gate);
+    state->count = 0;
+    state->last = 0;
+    state->in_order = true;
+    state->on_writer_thread = true;
+    state->long_messages_intact = true;
+    SDL_GetLogOutputFunction(&original_function, &original_userdata);
+    SDL_SetLogOutputFunction(AsyncTestLogOutput, state);
+}
+
+/* Every 100th message is longer than SDL formats on the stack */
+static void LogAsyncTestMessage(int sequence)
+{
+    if ((sequence % 100) == 0) {
+        SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO, "%-*d", ASYNC_LONG_MESSAGE_LENGTH, sequence);
+    } else {
+        SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO, "%d", sequence);
+    }
+}
+
+#define DEFERRED_CATEGORY (SDL_LOG_CATEGORY_CUSTOM + 7)
+
+typedef struct DeferredLogState
+{
+    char text[2048];
+    int count;
+    SDL_LogRecord record;
+} DeferredLogState;
+
+static void SDLCALL DeferredTestLogRecord(void *userdata, const SDL_LogRecord *record)
+{
+    DeferredLogState *state = (DeferredLogState *)userdata;
+
+    if (record->category != DEFERRED_CATEGORY) {
+        /* Messages from the test harness */
+        char text[1024];
+        if (SDL_FormatLogRecord(record, text, sizeof(text)) >= 0) {
+            original_function(original_userdata, record->category, record->priority, text);
+        }
+        return;
+    }
+
+    if (SDL_FormatLogRecord(record, state->text, sizeof(state->text)) < 0) {
+        SDL_strlcpy(state->text, "(damaged)", sizeof(state->text));
+    }
+    state->record = *record;
+    state->record.args = NULL;
+    ++state->count;
+}
+
+/* Logs a message in deferred mode, and checks that formatting the record gives
+   the same text as formatting the message right away */
+static void CheckDeferredLog(DeferredLogState *state, SDL_PRINTF_FORMAT_STRING const char *fmt, ...) SDL_PRINTF_VARARG_FUNC(2);
+static void CheckDeferredLog(DeferredLogState *state, SDL_PRINTF_FORMAT_STRING const char *fmt, ...)
+{
+    char expected[2048];
+    Uint64 start = SDL_GetTicksNS();
+    va_list ap;
+
+    va_start(ap, fmt);
+    (void)SDL_vsnprintf(expected, sizeof(expected), fmt, ap);
+    va_end(ap);
+
+    state->count = 0;
+    va_start(ap, fmt);
+    SDL_LogMessageV(DEFERRED_CATEGORY, SDL_LOG_PRIORITY_INFO, fmt, ap);
+    va_end(ap);
+    SDL_ReadLogRecords(DeferredTestLogRecord, state);
+
+    SDLTest_AssertCheck(state->count == 1, "Check record count for \"%s\", expected: 1, got: %d", fmt, state->count);
+    SDLTest_AssertCheck(SDL_strcmp(state->text, expected) == 0, "Check formatted record for \"%s\", expected: \"%s\", got: \"%s\"", fmt, expected, state->text);
+    SDLTest_AssertCheck(state->record.priority == SDL_LOG_PRIORITY_INFO && state->record.thread == SDL_GetCurrentThreadID(),
+                        "Check record priority and thread");
+    SDLTest_AssertCheck(state->record.timestamp >= start && state->record.timestamp <= SDL_GetTicksNS(), "Check record timestamp");
+}
+
+/* SDL_LogMessage() can't be given a NULL format without a warning, but it's allowed */
+static void LogDeferredFormat(const char *fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    SDL_LogMessageV(DEFERRED_CATEGORY, SDL_LOG_PRIORITY_INFO, fmt, ap);
+    va_end(ap);
+}
+
+static int SDLCALL DeferredLogThread(void *data)
+{
+    int i;
+
+    for (i = 0; i < 10000; ++i) {
+        SDL_LogMessage(DEFERRED_CATEGORY, SDL_LOG_PRIORITY_INFO, "Thread message %d", i);
+    }
+    return 0;
+}
+
 /* Fixture */
 
 /* Test case functions */
@@ -188,6 +323,196 @@ static int SDLCALL log_testHint(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check that priorities read back as they were set, with more custom
+ * categories than SDL_GetLogPriority() looks up without locking
+ */
+static int SDLCALL log_testPriorities(void *arg)
+{
+    const int num_categories = 100;
+    int i, mismatches = 0;
+
+    SDL_SetHint(SDL_HINT_LOGGING, NULL);
+    SDL_SetLogPriorities(SDL_LOG_PRIORITY_WARN);
+    SDLTest_AssertPass("SDL_SetLogPriorities(SDL_LOG_PRIORITY_WARN)");
+    SDLTest_AssertCheck(SDL_GetLogPriority(SDL_LOG_CATEGORY_CUSTOM + 1000) == SDL_LOG_PRIORITY_WARN, "Check default priority for a custom category");
+
+    for (i = 0; i < num_categories; ++i) {
+        SDL_SetLogPriority(SDL_LOG_CATEGORY_CUSTOM + i, (SDL_LogPriority)(SDL_LOG_PRIORITY_TRACE + i % (SDL_LOG_PRIORITY_CRITICAL - SDL_LOG_PRIORITY_TRACE + 1)));
+        if (SDL_GetLogPriority(SDL_LOG_CATEGORY_CUSTOM) != SDL_LOG_PRIORITY_TRACE) {
+            ++mismatches;
+        }
+    }
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_SYSTEM, SDL_LOG_PRIORITY_DEBUG);
+    for (i = 0; i < num_categories; ++i) {
+        if (SDL_GetLogPriority(SDL_LOG_CATEGORY_CUSTOM + i) != (SDL_LogPriority)(SDL_LOG_PRIORITY_TRACE + i % (SDL_LOG_PRIORITY_CRITICAL - SDL_LOG_PRIORITY_TRACE + 1))) {
+            ++mismatches;
+        }
+    }
+    SDLTest_AssertPass("SDL_SetLogPriority() for %d custom categories", num_categories);
+    SDLTest_AssertCheck(mismatches == 0, "Check custom category priorities, expected: 0 mismatches, got: %d", mismatches);
+    SDLTest_AssertCheck(SDL_GetLogPriority(SDL_LOG_CATEGORY_SYSTEM) == SDL_LOG_PRIORITY_DEBUG, "Check built-in category priority");
+    SDLTest_AssertCheck(SDL_GetLogPriority(SDL_LOG_CATEGORY_CUSTOM + num_categories) == SDL_LOG_PRIORITY_WARN, "Check default priority with many custom categories");
+
+    SDL_ResetLogPriorities();
+    SDLTest_AssertPass("SDL_ResetLogPriorities()");
+    SDLTest_AssertCheck(SDL_GetLogPriority(SDL_LOG_CATEGORY_CUSTOM + 1) == SDL_LOG_PRIORITY_ERROR, "Check custom category priority after reset");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that asynchronous logging writes every message in order, or counts
+ * the ones it drops
+ */
+static int SDLCALL log_testAsync(void *arg)
+{
+    const int num_messages = 2000;
+    AsyncLogState state;
+    SDL_LogAsyncStats stats;
+    bool result;
+    int i;
+
+    SDL_SetHint(SDL_HINT_LOGGING, NULL);
+    SDL_GetLogAsyncStats(&stats, true);
+
+    result = SDL_SetLogAsync(true, (SDL_LogOverflowPolicy)-1);
+    SDLTest_AssertPass("SDL_SetLogAsync(true, -1)");
+    SDLTest_AssertCheck(!result, "Check result value, expected: false, got: %s", result ? "true" : "false");
+
+    /* Nothing can be logged by the test harness while the test output function
+       is set, so the checks come after each part */
+
+    /* Block on a full queue: everything must come out, in order, on the writer thread */
+    EnableAsyncTestLog(&state, true);
+    result = SDL_SetLogAsync(true, SDL_LOG_OVERFLOW_BLOCK);
+    SDL_GetLogAsyncStats(&stats, false);
+    for (i = 1; i <= num_messages; ++i) {
+        LogAsyncTestMessage(i);
+    }
+    SDL_SetLogAsync(false, SDL_LOG_OVERFLOW_BLOCK);
+    DisableTestLog();
+    SDLTest_AssertPass("SDL_SetLogAsync(true, SDL_LOG_OVERFLOW_BLOCK)");
+    SDLTest_AssertCheck(result, "Check result value, expected: true, got: %s", result ? "true" : "false");
+    SDLTest_AssertCheck(stats.capacity > 0, "Check queue capacity, expected: > 0, got: %d", stats.capacity);
+
+    SDLTest_AssertCheck(state.count == num_messages, "Check message count, expected: %d, got: %d", num_messages, state.count);
+    SDLTest_AssertCheck(state.in_order, "Check that messages were written in order");
+    SDLTest_AssertCheck(state.on_writer_thread, "Check that messages were written by another thread");
+    SDLTest_AssertCheck(state.long_messages_intact, "Check that long messages were written whole");
+
+    SDL_GetLogAsyncStats(&stats, true);
+    SDLTest_AssertCheck(stats.capacity == 0, "Check queue capacity after disabling, expected: 0, got: %d", stats.capacity);
+    SDLTest_AssertCheck(stats.written == (Uint32)num_messages, "Check written count, expected: %d, got: %" SDL_PRIu32, num_messages, stats.written);
+    SDLTest_AssertCheck(stats.dropped == 0, "Check dropped count, expected: 0, got: %" SDL_PRIu32, stats.dropped);
+
+    /* Drop on a full queue: hold up the writer so the queue fills */
+    EnableAsyncTestLog(&state, false);
+    result = SDL_SetLogAsync(true, SDL_LOG_OVERFLOW_DROP);
+    for (i = 1; i <= num_messages; ++i) {
+        LogAsyncTestMessage(i);
+    }
+    SDL_SetAtomicInt(&state.gate, 1);
+    SDL_SetLogAsync(false, SDL_LOG_OVERFLOW_DROP);
+    DisableTestLog();
+    SDLTest_AssertPass("SDL_SetLogAsync(true, SDL_LOG_OVERFLOW_DROP)");
+    SDLTest_AssertCheck(result, "Check result value, expected: true, got: %s", result ? "true" : "false");
+
+    SDL_GetLogAsyncStats(&stats, true);
+    SDLTest_AssertCheck(stats.dropped > 0, "Check dropped count, expected: > 0, got: %" SDL_PRIu32, stats.dropped);
+    SDLTest_AssertCheck(state.count == (int)stats.written, "Check message count, expected: %" SDL_PRIu32 ", got: %d", stats.written, state.count);
+    SDLTest_AssertCheck(stats.written + stats.dropped == (Uint32)num_messages,
+                        "Check written and dropped count, expected: %d, got: %" SDL_PRIu32, num_messages, stats.written + stats.dropped);
+    SDLTest_AssertCheck(state.in_order, "Check that messages were written in order");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that log records captured in deferred mode format to the same text
+ */
+static int SDLCALL log_testDeferred(void *arg)
+{
+    static DeferredLogState state;
+    static char long_string[1500];
+    static char unterminated[1500];
+    SDL_LogAsyncStats stats;
+    SDL_Thread *thread;
+    int count, total;
+
+    SDL_SetHint(SDL_HINT_LOGGING, NULL);
+    SDL_GetLogOutputFunction(&original_function, &original_userdata);
+    SDL_memset(long_string, 'x', sizeof(long_string) - 1);
+
+    SDL_SetLogPriority(DEFERRED_CATEGORY, SDL_LOG_PRIORITY_INFO);
+    SDL_SetLogDeferred(true);
+    SDLTest_AssertPass("SDL_SetLogDeferred(true)");
+
+    CheckDeferredLog(&state, "No arguments");
+    CheckDeferredLog(&state, "100%% literal");
+    CheckDeferredLog(&state, "%d %i %5d %-5d| %05d %+d % d", -1, 42, 7, 7, -7, 7, 7);
+    CheckDeferredLog(&state, "%hhd %hhu %hd %hu", 300, 300, 70000, 70000);
+    CheckDeferredLog(&state, "%ld %lu %lld %llu", -123456789L, 123456789UL, -1234567890123LL, 12345678901234ULL);
+    CheckDeferredLog(&state, "%" SDL_PRIs64 " %" SDL_PRIu64 " %" SDL_PRIx64 " %" SDL_PRIX64, SDL_MIN_SINT64, SDL_MAX_UINT64, SDL_MAX_UINT64, (Uint64)0xABCDEF);
+    CheckDeferredLog(&state, "%zu %x %X %o %#x %#o", (size_t)12345, 0xbeef, 0xBEEF, 8, 255, 8);
+    CheckDeferredLog(&state, "%*d|%-*d|%.*d|%*.*d", 6, 1, 6, 2, 4, 3, -8, 3, 4);
+    CheckDeferredLog(&state, "%f %.2f %10.3f %g %e %E %G", 3.14159, 2.71828, -1.5, 0.0001, 12345.678, 0.5, 1e20);
+    CheckDeferredLog(&state, "%c%c%c %5c", 'S', 'D', 'L', '!');
+    CheckDeferredLog(&state, "%s, %10s, %-10s|, %.3s", "hello", "right", "left", "truncated");
+
+    /* Only as much of a string as the precision allows may be read, it needn't be terminated */
+    SDL_memset(unterminated, 'y', sizeof(unterminated));
+    CheckDeferredLog(&state, "%.*s|%.3s|%-6.2s|", 5, unterminated, unterminated, unterminated);
+    SDLTest_AssertCheck(state.record.fmt && SDL_strcmp(state.record.fmt, "%.*s|%.3s|%-6.2s|") == 0,
+                        "Check that precision limited strings were captured as arguments, got format \"%s\"", state.record.fmt ? state.record.fmt : "(null)");
+    CheckDeferredLog(&state, "%p %p", (void *)&state, (void *)NULL);
+    CheckDeferredLog(&state, "%d %s %f %s %d", 1, "two", 3.0, "four", 5);
+    CheckDeferredLog(&state, "Short %s", long_string + sizeof(long_string) - 100);
+
+    /* A NULL format is logged as an empty message, like SDL_vsnprintf() */
+    state.count = 0;
+    LogDeferredFormat(NULL);
+    SDL_ReadLogRecords(DeferredTestLogRecord, &state);
+    SDLTest_AssertCheck(state.count == 1, "Check record count for a NULL format, expected: 1, got: %d", state.count);
+    SDLTest_AssertCheck(state.count == 1 && state.text[0] == '\0', "Check formatted record for a NULL format, expected: \"\", got: \"%s\"", state.text);
+
+    /* Too long to capture, so it's captured as text, cut short */
+    state.count = 0;
+    SDL_LogMessage(DEFERRED_CATEGORY, SDL_LOG_PRIORITY_INFO, "%s", long_string);
+    SDL_ReadLogRecords(DeferredTestLogRecord, &state);
+    SDLTest_AssertCheck(state.count == 1, "Check record count for a long message, expected: 1, got: %d", state.count);
+    SDLTest_AssertCheck(SDL_strlen(state.text) > 0 && SDL_strncmp(state.text, long_string, SDL_strlen(state.text)) == 0,
+                        "Check that a long message was captured as text, got %d characters", (int)SDL_strlen(state.text));
+
+    /* A thread that logs more than its buffer holds, with records read as it goes */
+    SDL_GetLogAsyncStats(&stats, true);
+    state.count = 0;
+    total = 0;
+    thread = SDL_CreateThread(DeferredLogThread, "DeferredLogThread", NULL);
+    SDLTest_AssertCheck(thread != NULL, "Check SDL_CreateThread() result");
+    if (thread) {
+        int status = 0;
+        while (SDL_GetThreadState(thread) == SDL_THREAD_ALIVE) {
+            count = SDL_ReadLogRecords(DeferredTestLogRecord, &state);
+            total += SDL_max(count, 0);
+            SDL_Delay(1);
+        }
+        SDL_WaitThread(thread, &status);
+        count = SDL_ReadLogRecords(DeferredTestLogRecord, &state);
+        total += SDL_max(count, 0);
+        SDL_GetLogAsyncStats(&stats, true);
+        SDLTest_AssertCheck(state.count + (int)stats.dropped == 10000,
+                            "Check records read and dropped, expected: 10000, got: %d + %d", state.count, (int)stats.dropped);
+        SDLTest_AssertCheck(SDL_strcmp(state.text, "Thread message 9999") == 0 || stats.dropped > 0,
+                            "Check last record from thread, got: \"%s\"", state.text);
+    }
+
+    SDL_SetLogDeferred(false);
+    SDLTest_AssertPass("SDL_SetLogDeferred(false)");
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Log test cases */
@@ -195,9 +520,21 @@ static const SDLTest_TestCaseReference logTestHint = {
     log_testHint, "log_testHint", "Check SDL_HINT_LOGGING functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference logTestPriorities = {
+    log_testPriorities, "log_testPriorities", "Check setting and getting log priorities", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference logTestAsync = {
+    log_testAsync, "log_testAsync", "Check asynchronous logging", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference logTestDeferred = {
+    log_testDeferred, "log_testDeferred", "Check log records captured in deferred mode", TEST_ENABLED
+};
+
 /* Sequence of Log test cases */
 static const SDLTest_TestCaseReference *logTests[] = {
-    &logTestHint, NULL
+    &logTestHint, &logTestPriorities, &logTestAsync, &logTestDeferred, NULL
 };
 
 /* Timer test suite (global) */
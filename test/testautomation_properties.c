@@ -382,6 +382,237 @@ static int SDLCALL properties_testLocking(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Test getting and setting properties by key
+ */
+#define KEY_BENCHMARK_GETS 1000000
+static int SDLCALL properties_testKeys(void *arg)
+{
+    SDL_PropertiesID props, copy;
+    SDL_PropertyKey key, number_key, other_key;
+    const char *name;
+    Sint64 value_number;
+    Uint64 start, by_name, by_key;
+    int i, count;
+
+    props = SDL_CreateProperties();
+    SDLTest_AssertPass("Call to SDL_CreateProperties()");
+    SDLTest_AssertCheck(props != 0,
+        "Verify props were created, got: %" SDL_PRIu32, props);
+
+    key = SDL_GetPropertyKey("SDL.test.key");
+    SDLTest_AssertPass("Call to SDL_GetPropertyKey()");
+    SDLTest_AssertCheck(key != 0,
+        "Verify key was created, got: %" SDL_PRIu32, key);
+    SDLTest_AssertCheck(SDL_GetPropertyKey("SDL.test.key") == key,
+        "Verify the same name returns the same key");
+    other_key = SDL_GetPropertyKey("SDL.test.other");
+    SDLTest_AssertCheck(other_key != 0 && other_key != key,
+        "Verify a different name returns a different key, got: %" SDL_PRIu32, other_key);
+    name = SDL_GetPropertyKeyName(key);
+    SDLTest_AssertCheck(name && SDL_strcmp(name, "SDL.test.key") == 0,
+        "Verify key name, got: %s", name ? name : "NULL");
+    SDLTest_AssertCheck(SDL_GetPropertyKey(NULL) == 0 && SDL_GetPropertyKey("") == 0,
+        "Verify invalid names don't get a key");
+    SDLTest_AssertCheck(SDL_GetPropertyKeyName(0) == NULL,
+        "Verify invalid keys don't have a name");
+
+    /* Properties set by key can be found by name, and the other way around */
+    SDL_SetStringPropertyByKey(props, key, "by key");
+    name = SDL_GetStringProperty(props, "SDL.test.key", NULL);
+    SDLTest_AssertCheck(name && SDL_strcmp(name, "by key") == 0,
+        "Verify string set by key, got: %s", name ? name : "NULL");
+    SDL_SetStringProperty(props, "SDL.test.key", "by name");
+    name = SDL_GetStringPropertyByKey(props, key, NULL);
+    SDLTest_AssertCheck(name && SDL_strcmp(name, "by name") == 0,
+        "Verify string set by name, got: %s", name ? name : "NULL");
+
+    SDL_SetPointerPropertyByKey(props, key, &count);
+    SDLTest_AssertCheck(SDL_GetPropertyTypeByKey(props, key) == SDL_PROPERTY_TYPE_POINTER,
+        "Verify property type is pointer");
+    SDLTest_AssertCheck(SDL_GetPointerPropertyByKey(props, key, NULL) == &count,
+        "Verify pointer set by key");
+    SDL_SetNumberPropertyByKey(props, key, 42);
+    SDLTest_AssertCheck(SDL_GetNumberPropertyByKey(props, key, 0) == 42,
+        "Verify number set by key");
+    SDL_SetFloatPropertyByKey(props, key, 0.5f);
+    SDLTest_AssertCheck(SDL_GetFloatPropertyByKey(props, key, 0.0f) == 0.5f,
+        "Verify float set by key");
+    SDL_SetBooleanPropertyByKey(props, key, true);
+    SDLTest_AssertCheck(SDL_GetBooleanPropertyByKey(props, key, false) == true,
+        "Verify boolean set by key");
+    SDLTest_AssertCheck(SDL_HasPropertyByKey(props, key) && !SDL_HasPropertyByKey(props, other_key),
+        "Verify SDL_HasPropertyByKey()");
+
+    /* Copies share the key names */
+    copy = SDL_CreateProperties();
+    SDL_CopyProperties(props, copy);
+    SDLTest_AssertCheck(SDL_GetBooleanPropertyByKey(copy, key, false) == true,
+        "Verify copied property can be found by key");
+    SDL_DestroyProperties(copy);
+
+    SDL_ClearPropertyByKey(props, key);
+    SDLTest_AssertCheck(!SDL_HasProperty(props, "SDL.test.key"),
+        "Verify property cleared by key");
+    SDLTest_AssertCheck(SDL_GetNumberPropertyByKey(props, 0, -1) == -1,
+        "Verify invalid key returns the default value");
+    SDLTest_AssertCheck(!SDL_SetNumberPropertyByKey(props, 0, 1),
+        "Verify setting an invalid key fails");
+
+    number_key = SDL_GetPropertyKey(SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 16384);
+    for (i = 0; i < 20; ++i) {
+        char other[32];
+        SDL_snprintf(other, sizeof(other), "SDL.test.property.%d", i);
+        SDL_SetNumberProperty(props, other, i);
+    }
+
+    value_number = 0;
+    start = SDL_GetTicksNS();
+    for (i = 0; i < KEY_BENCHMARK_GETS; ++i) {
+        value_number += SDL_GetNumberProperty(props, SDL_PROP_RENDERER_MAX_TEXTURE_SIZE_NUMBER, 0);
+    }
+    by_name = SDL_GetTicksNS() - start;
+    start = SDL_GetTicksNS();
+    for (i = 0; i < KEY_BENCHMARK_GETS; ++i) {
+        value_number += SDL_GetNumberPropertyByKey(props, number_key, 0);
+    }
+    by_key = SDL_GetTicksNS() - start;
+    SDLTest_AssertCheck(value_number == (Sint64)KEY_BENCHMARK_GETS * 2 * 16384,
+        "Verify every get found the property");
+    SDLTest_Log("Getting a number property: %.1f ns by name, %.1f ns by key",
+        (double)by_name / KEY_BENCHMARK_GETS, (double)by_key / KEY_BENCHMARK_GETS);
+
+    SDL_DestroyProperties(props);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Test many threads getting properties while another thread sets them
+ */
+#define CONTENTION_THREADS 4
+#define CONTENTION_GETS    100000
+
+struct properties_contention_data
+{
+    SDL_PropertiesID props;
+    SDL_AtomicInt *start;
+    Uint64 elapsed;
+    int errors;
+};
+static char properties_pointer_value;
+static int SDLCALL properties_reader(void *arg)
+{
+    struct properties_contention_data *data = (struct properties_contention_data *)arg;
+    Sint64 last_counter = 0;
+    Uint64 start;
+    int i;
+
+    while (!SDL_GetAtomicInt(data->start)) {
+        SDL_Delay(0);
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < CONTENTION_GETS; ++i) {
+        const char *value_string = SDL_GetStringProperty(data->props, "number", NULL);
+        const Sint64 counter = SDL_GetNumberProperty(data->props, "counter", 0);
+
+        if (!value_string || SDL_strcmp(value_string, "42") != 0) {
+            ++data->errors;
+        }
+        if (counter < last_counter) {
+            ++data->errors;
+        }
+        last_counter = counter;
+        if (SDL_GetPointerProperty(data->props, "pointer", NULL) != &properties_pointer_value ||
+            SDL_GetFloatProperty(data->props, "float", 0.0f) != 0.5f ||
+            !SDL_GetBooleanProperty(data->props, "boolean", false)) {
+            ++data->errors;
+        }
+    }
+    data->elapsed = SDL_GetTicksNS() - start;
+    return 0;
+}
+struct properties_writer_data
+{
+    SDL_PropertiesID props;
+    SDL_AtomicInt done;
+};
+static int SDLCALL properties_writer(void *arg)
+{
+    struct properties_writer_data *data = (struct properties_writer_data *)arg;
+    Sint64 counter = 0;
+
+    while (!SDL_GetAtomicInt(&data->done)) {
+        ++counter;
+        SDL_SetNumberProperty(data->props, "counter", counter);
+        SDL_SetStringProperty(data->props, "unrelated", (counter & 1) ? "odd" : "even");
+        SDL_Delay(1);
+    }
+    return (int)counter;
+}
+static int SDLCALL properties_testContention(void *arg)
+{
+    struct properties_contention_data data[CONTENTION_THREADS];
+    struct properties_writer_data writer_data;
+    SDL_Thread *readers[CONTENTION_THREADS];
+    SDL_Thread *writer;
+    SDL_AtomicInt start;
+    SDL_PropertiesID props;
+    Uint64 slowest = 0;
+    int i, errors = 0, writes = 0;
+
+    props = SDL_CreateProperties();
+    SDLTest_AssertPass("Call to SDL_CreateProperties()");
+    SDLTest_AssertCheck(props != 0,
+        "Verify props were created, got: %" SDL_PRIu32, props);
+
+    /* The number is converted to a string by the first reader to get it */
+    SDL_SetNumberProperty(props, "number", 42);
+    SDL_SetPointerProperty(props, "pointer", &properties_pointer_value);
+    SDL_SetFloatProperty(props, "float", 0.5f);
+    SDL_SetBooleanProperty(props, "boolean", true);
+
+    SDL_SetAtomicInt(&start, 0);
+    SDL_zeroa(data);
+    for (i = 0; i < CONTENTION_THREADS; ++i) {
+        char name[64];
+
+        data[i].props = props;
+        data[i].start = &start;
+        SDL_snprintf(name, sizeof(name), "properties_reader%d", i);
+        readers[i] = SDL_CreateThread(properties_reader, name, &data[i]);
+        SDLTest_AssertCheck(readers[i] != NULL,
+            "Verify reader thread %d was created", i);
+    }
+
+    writer_data.props = props;
+    SDL_SetAtomicInt(&writer_data.done, 0);
+    writer = SDL_CreateThread(properties_writer, "properties_writer", &writer_data);
+    SDLTest_AssertCheck(writer != NULL,
+        "Verify writer thread was created");
+
+    SDL_SetAtomicInt(&start, 1);
+    for (i = 0; i < CONTENTION_THREADS; ++i) {
+        SDL_WaitThread(readers[i], NULL);
+        errors += data[i].errors;
+        slowest = SDL_max(slowest, data[i].elapsed);
+    }
+    SDL_SetAtomicInt(&writer_data.done, 1);
+    SDL_WaitThread(writer, &writes);
+
+    SDLTest_AssertCheck(errors == 0,
+        "Verify readers always got the expected values, got %d errors", errors);
+    SDLTest_Log("%d threads getting properties during %d sets: %.1f ns per get, %.2f million gets/sec in total",
+        CONTENTION_THREADS, writes, (double)slowest / (CONTENTION_GETS * 5),
+        ((double)CONTENTION_THREADS * CONTENTION_GETS * 5 * SDL_NS_PER_SECOND / SDL_max(slowest, 1)) / 1000000.0);
+
+    SDL_DestroyProperties(props);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Properties test cases */
@@ -401,12 +632,22 @@ static const SDLTest_TestCaseReference propertiesTestLocking = {
     properties_testLocking, "properties_testLocking", "Test property locking functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference propertiesTestKeys = {
+    properties_testKeys, "properties_testKeys", "Test getting and setting properties by key", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference propertiesTestContention = {
+    properties_testContention, "properties_testContention", "Test getting properties from many threads at once", TEST_ENABLED
+};
+
 /* Sequence of Properties test cases */
 static const SDLTest_TestCaseReference *propertiesTests[] = {
     &propertiesTestBasic,
     &propertiesTestCopy,
     &propertiesTestCleanup,
     &propertiesTestLocking,
+    &propertiesTestKeys,
+    &propertiesTestContention,
     NULL
 };
 
@@ -961,6 +961,78 @@ static int SDLCALL stdlib_aligned_alloc(void *arg)
     return TEST_COMPLETED;
 }
 
+static int SDLCALL stdlib_memory_arena(void *arg)
+{
+    SDL_MemoryArena *arena;
+    Uint8 *first, *ptr, *big;
+    void *ptrs[1000];
+    Uint64 start, heap, bump;
+    int i, pass;
+
+    arena = SDL_CreateMemoryArena(256);
+    SDLTest_AssertCheck(arena != NULL, "SDL_CreateMemoryArena(256) should succeed");
+    if (!arena) {
+        return TEST_ABORTED;
+    }
+
+    first = (Uint8 *)SDL_AllocateArenaMemory(arena, 1);
+    ptr = (Uint8 *)SDL_AllocateArenaMemory(arena, 0);
+    SDLTest_AssertCheck(first && ptr && ptr != first, "Allocations should be distinct");
+    SDLTest_AssertCheck(((size_t)first % 8) == 0 && ((size_t)ptr % 8) == 0, "Allocations should be aligned");
+
+    /* Allocations bigger than a block get a block of their own */
+    big = (Uint8 *)SDL_AllocateArenaMemory(arena, 1000);
+    SDLTest_AssertCheck(big != NULL, "Allocation bigger than a block should succeed");
+    if (big) {
+        SDL_memset(big, 0xAA, 1000);
+    }
+    for (i = 0; i < 100; ++i) {
+        ptr = (Uint8 *)SDL_AllocateArenaMemory(arena, 24);
+        if (!ptr) {
+            break;
+        }
+        SDL_memset(ptr, i, 24);
+    }
+    SDLTest_AssertCheck(i == 100, "Allocations filling several blocks should succeed");
+    SDLTest_AssertCheck(big && big[0] == 0xAA && big[999] == 0xAA, "Allocations shouldn't overlap");
+
+    SDL_ResetMemoryArena(arena);
+    ptr = (Uint8 *)SDL_AllocateArenaMemory(arena, 1);
+    SDLTest_AssertCheck(ptr == first, "Reset arena should reuse its memory from the start");
+
+    SDLTest_AssertCheck(SDL_AllocateArenaMemory(NULL, 1) == NULL, "Allocating from a NULL arena should fail");
+    SDLTest_AssertCheck(SDL_AllocateArenaMemory(arena, SDL_SIZE_MAX) == NULL, "Huge allocation should fail");
+
+    SDL_DestroyMemoryArena(arena);
+    SDL_DestroyMemoryArena(NULL);
+
+    /* Compare the cost of short lived strings from the heap and from an arena */
+    arena = SDL_CreateMemoryArena(0);
+    heap = bump = 0;
+    for (pass = 0; pass < 10; ++pass) {
+        start = SDL_GetTicksNS();
+        for (i = 0; i < (int)SDL_arraysize(ptrs); ++i) {
+            ptrs[i] = SDL_malloc(16 + (i % 32));
+        }
+        for (i = 0; i < (int)SDL_arraysize(ptrs); ++i) {
+            SDL_free(ptrs[i]);
+        }
+        heap += SDL_GetTicksNS() - start;
+
+        start = SDL_GetTicksNS();
+        for (i = 0; i < (int)SDL_arraysize(ptrs); ++i) {
+            ptrs[i] = SDL_AllocateArenaMemory(arena, 16 + (i % 32));
+        }
+        SDL_ResetMemoryArena(arena);
+        bump += SDL_GetTicksNS() - start;
+    }
+    SDL_DestroyMemoryArena(arena);
+    SDLTest_Log("Short lived allocations: %.2f ns from the heap, %.2f ns from an arena",
+                (double)heap / (10 * SDL_arraysize(ptrs)), (double)bump / (10 * SDL_arraysize(ptrs)));
+
+    return TEST_COMPLETED;
+}
+
 typedef struct
 {
     size_t a;
@@ -1468,6 +1540,10 @@ static const SDLTest_TestCaseReference stdlibTest_aligned_alloc = {
     stdlib_aligned_alloc, "stdlib_aligned_alloc", "Call to SDL_aligned_alloc", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest_memory_arena = {
+    stdlib_memory_arena, "stdlib_memory_arena", "Calls to SDL_MemoryArena functions", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference stdlibTestOverflow = {
     stdlib_overflow, "stdlib_overflow", "Overflow detection", TEST_ENABLED
 };
@@ -1502,6 +1578,7 @@ static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_getsetenv,
     &stdlibTest_sscanf,
     &stdlibTest_aligned_alloc,
+    &stdlibTest_memory_arena,
     &stdlibTestOverflow,
     &stdlibTest_iconv,
     &stdlibTest_strpbrk,
@@ -1527,6 +1527,99 @@ static int SDLCALL surface_testPremultiplyAlpha(void *arg)
 }
 
 
+/**
+ *  Tests that converting on multiple threads matches converting on one thread.
+ */
+static int SDLCALL surface_testThreadedConversion(void *arg)
+{
+    const struct
+    {
+        SDL_PixelFormat src_format;
+        SDL_Colorspace src_colorspace;
+        SDL_PixelFormat dst_format;
+        SDL_Colorspace dst_colorspace;
+    } conversions[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_RGB565, SDL_COLORSPACE_SRGB },
+        { SDL_PIXELFORMAT_INDEX8, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_ABGR8888, SDL_COLORSPACE_SRGB },
+        { SDL_PIXELFORMAT_RGBA128_FLOAT, SDL_COLORSPACE_SRGB_LINEAR, SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_HDR10 },
+    };
+    const int width = 509;
+    const int height = 383;
+    int i, x, y, ret;
+
+    for (i = 0; i < SDL_arraysize(conversions); ++i) {
+        SDL_Surface *src, *serial, *threaded;
+        SDL_Palette *palette;
+
+        src = SDL_CreateSurface(width, height, conversions[i].src_format);
+        SDLTest_AssertCheck(src != NULL, "SDL_CreateSurface(%s)", SDL_GetPixelFormatName(conversions[i].src_format));
+        if (!src) {
+            return TEST_ABORTED;
+        }
+        SDL_SetSurfaceColorspace(src, conversions[i].src_colorspace);
+        if (SDL_ISPIXELFORMAT_INDEXED(src->format)) {
+            palette = SDL_CreateSurfacePalette(src);
+            SDLTest_AssertCheck(palette != NULL, "SDL_CreateSurfacePalette()");
+            if (!palette) {
+                SDL_DestroySurface(src);
+                return TEST_ABORTED;
+            }
+            for (x = 0; x < palette->ncolors; ++x) {
+                palette->colors[x].r = (Uint8)SDLTest_RandomUint8();
+                palette->colors[x].g = (Uint8)SDLTest_RandomUint8();
+                palette->colors[x].b = (Uint8)SDLTest_RandomUint8();
+            }
+        }
+        if (SDL_ISPIXELFORMAT_FLOAT(src->format)) {
+            for (y = 0; y < height; ++y) {
+                float *pixels = (float *)((Uint8 *)src->pixels + y * src->pitch);
+                for (x = 0; x < width * 4; ++x) {
+                    pixels[x] = SDLTest_RandomUnitFloat() * 4.0f;
+                }
+            }
+        } else {
+            for (y = 0; y < height; ++y) {
+                Uint8 *pixels = (Uint8 *)src->pixels + y * src->pitch;
+                for (x = 0; x < src->pitch; ++x) {
+                    pixels[x] = SDLTest_RandomUint8();
+                }
+            }
+        }
+
+        SDL_SetHint(SDL_HINT_SURFACE_CONVERSION_THREADS, "1");
+        serial = SDL_ConvertSurfaceAndColorspace(src, conversions[i].dst_format, NULL, conversions[i].dst_colorspace, 0);
+        SDLTest_AssertCheck(serial != NULL, "SDL_ConvertSurfaceAndColorspace() on one thread");
+
+        SDL_SetHint(SDL_HINT_SURFACE_CONVERSION_THREADS, "4");
+        threaded = SDL_ConvertSurfaceAndColorspace(src, conversions[i].dst_format, NULL, conversions[i].dst_colorspace, 0);
+        SDLTest_AssertCheck(threaded != NULL, "SDL_ConvertSurfaceAndColorspace() on four threads");
+
+        if (serial && threaded) {
+            ret = SDL_memcmp(serial->pixels, threaded->pixels, (size_t)serial->h * serial->pitch);
+            SDLTest_AssertCheck(ret == 0, "Verify %s to %s conversion matches, expected: 0, got: %i",
+                                SDL_GetPixelFormatName(conversions[i].src_format), SDL_GetPixelFormatName(conversions[i].dst_format), ret);
+
+            /* SDL_ConvertPixelsAndColorspace() has no way to pass a palette */
+            if (!SDL_ISPIXELFORMAT_INDEXED(src->format)) {
+                SDL_memset(threaded->pixels, 0, (size_t)threaded->h * threaded->pitch);
+                ret = SDL_ConvertPixelsAndColorspace(width, height, src->format, conversions[i].src_colorspace, 0, src->pixels, src->pitch,
+                                                     threaded->format, conversions[i].dst_colorspace, 0, threaded->pixels, threaded->pitch);
+                SDLTest_AssertCheck(ret == true, "SDL_ConvertPixelsAndColorspace() on four threads");
+                ret = SDL_memcmp(serial->pixels, threaded->pixels, (size_t)serial->h * serial->pitch);
+                SDLTest_AssertCheck(ret == 0, "Verify %s to %s pixel conversion matches, expected: 0, got: %i",
+                                    SDL_GetPixelFormatName(conversions[i].src_format), SDL_GetPixelFormatName(conversions[i].dst_format), ret);
+            }
+        }
+        SDL_ResetHint(SDL_HINT_SURFACE_CONVERSION_THREADS);
+
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(serial);
+        SDL_DestroySurface(threaded);
+    }
+
+    return TEST_COMPLETED;
+}
+
 static int SDLCALL surface_testScale(void *arg)
 {
     SDL_PixelFormat formats[] = {
@@ -1690,6 +1783,10 @@ static const SDLTest_TestCaseReference surfaceTestPremultiplyAlpha = {
     surface_testPremultiplyAlpha, "surface_testPremultiplyAlpha", "Test alpha premultiply operations.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestThreadedConversion = {
+    surface_testThreadedConversion, "surface_testThreadedConversion", "Test converting surfaces on multiple threads.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestScale = {
     surface_testScale, "surface_testScale", "Test scaling operations.", TEST_ENABLED
 };
@@ -1722,6 +1819,7 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestClearSurface,
     &surfaceTestPremultiplyAlpha,
     &surfaceTestScale,
+    &surfaceTestThreadedConversion,
     NULL
 };
 
@@ -0,0 +1,194 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of several threads pushing events while the main thread reads them,
+   checking that no events are lost and that each thread's events stay in order */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+#include "testutils.h"
+
+#define DEFAULT_THREADS 4
+#define DEFAULT_EVENTS  100000
+#define MAX_THREADS     64
+
+typedef struct Producer_State
+{
+    int num_events;
+    int retries;
+} Producer_State;
+
+static Uint32 event_type;
+
+static bool SDLCALL ProducerThread(void *userdata, int index)
+{
+    Producer_State *state = (Producer_State *)userdata + index;
+    int i;
+
+    for (i = 0; i < state->num_events; ++i) {
+        SDL_Event event;
+
+        SDL_zero(event);
+        event.type = event_type;
+        event.user.code = index;
+        event.user.data1 = (void *)(uintptr_t)i;
+        while (!SDL_PushEvent(&event)) {
+            /* The queue is full, give the consumer a chance to catch up */
+            ++state->retries;
+            SDL_Delay(0);
+        }
+    }
+    return true;
+}
+
+static bool RunBenchmark(int num_threads, int num_events)
+{
+    Producer_State producers[MAX_THREADS];
+    int next_expected[MAX_THREADS];
+    const Sint64 total = (Sint64)num_threads * num_events;
+    TestThreads *threads;
+    Sint64 received = 0;
+    Uint64 start, elapsed = 0;
+    int retries = 0;
+    bool result = true;
+    int i;
+
+    SDL_zeroa(producers);
+    SDL_zeroa(next_expected);
+    for (i = 0; i < num_threads; ++i) {
+        producers[i].num_events = num_events;
+    }
+
+    threads = StartTestThreads(ProducerThread, producers, num_threads);
+    if (!threads) {
+        SDL_FlushEvent(event_type);
+        return false;
+    }
+    start = SDL_GetTicksNS();
+
+    while (received < total) {
+        SDL_Event events[64];
+        int count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, event_type, event_type);
+        if (count < 0) {
+            SDL_Log("SDL_PeepEvents() failed: %s", SDL_GetError());
+            result = false;
+            break;
+        }
+        for (i = 0; i < count; ++i) {
+            const int producer = events[i].user.code;
+            const int sequence = (int)(uintptr_t)events[i].user.data1;
+
+            if (producer < 0 || producer >= num_threads) {
+                SDL_Log("Got event from unknown producer %d", producer);
+                result = false;
+            } else if (sequence != next_expected[producer]) {
+                SDL_Log("Producer %d: expected event %d, got %d", producer, next_expected[producer], sequence);
+                result = false;
+                next_expected[producer] = sequence + 1;
+            } else {
+                ++next_expected[producer];
+            }
+        }
+        received += count;
+        if (count == 0) {
+            SDL_CPUPauseInstruction();
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    if (!WaitTestThreads(threads, NULL)) {
+        result = false;
+    }
+    for (i = 0; i < num_threads; ++i) {
+        retries += producers[i].retries;
+    }
+
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    SDL_Log("%2d producers: %" SDL_PRIs64 " events in %.2f ms, %.2f million events/sec, %d retries on a full queue",
+            num_threads, received, (double)elapsed / SDL_NS_PER_MS,
+            ((double)received * SDL_NS_PER_SECOND / elapsed) / 1000000.0, retries);
+
+    if (SDL_HasEvent(event_type)) {
+        SDL_Log("Extra events were left in the queue");
+        SDL_FlushEvent(event_type);
+        result = false;
+    }
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int max_threads = DEFAULT_THREADS;
+    int num_events = DEFAULT_EVENTS;
+    int num_threads;
+    int i;
+    bool result = true;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_THREADS);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--events") == 0 && argv[i + 1]) {
+                num_events = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--threads N]", "[--events N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(SDL_INIT_EVENTS)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    event_type = SDL_RegisterEvents(1);
+    if (!event_type) {
+        SDL_Log("Couldn't register event: %s", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+
+    SDL_Log("Pushing %d events per thread", num_events);
+    for (num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        if (!RunBenchmark(num_threads, num_events)) {
+            result = false;
+        }
+    }
+    if ((max_threads & (max_threads - 1)) != 0) {
+        if (!RunBenchmark(max_threads, num_events)) {
+            result = false;
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
@@ -0,0 +1,333 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks SDL's internal hash table against a simple reference, and with
+   --benchmark, times inserting, finding and removing 1k to 1M items */
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_internal.h"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+/* The hash table isn't exported from SDL, so build it in */
+#include "../src/SDL_hashtable.c"
+
+#define CHECK_KEYS       5000
+#define CHECK_OPERATIONS 200000
+#define BENCHMARK_PASSES 5
+
+static bool check_count;
+static int iterated_count;
+
+static bool SDLCALL CountItem(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    const Uint32 *values = (const Uint32 *)userdata;
+    const Uint32 id = (Uint32)(uintptr_t)key;
+
+    if (id == 0 || id > CHECK_KEYS || values[id - 1] != (Uint32)(uintptr_t)value) {
+        check_count = false;
+    }
+    ++iterated_count;
+    return true;
+}
+
+/* Random inserts, replaces, finds and removes, compared against an array.
+   The keys are IDs in a small range, so items are removed and re-added a lot,
+   which exercises the handling of deleted buckets. */
+static bool RunCheck(void)
+{
+    Uint32 *values = (Uint32 *)SDL_calloc(CHECK_KEYS, sizeof(Uint32));
+    SDL_HashTable *table = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    int count = 0;
+    bool result = true;
+    int i;
+
+    if (!values || !table) {
+        SDL_Log("Couldn't create hash table: %s", SDL_GetError());
+        SDL_free(values);
+        SDL_DestroyHashTable(table);
+        return false;
+    }
+
+    for (i = 0; i < CHECK_OPERATIONS && result; ++i) {
+        const Uint32 id = (Uint32)SDLTest_RandomIntegerInRange(1, (i < CHECK_OPERATIONS / 2) ? CHECK_KEYS : CHECK_KEYS / 10);
+        const void *key = (const void *)(uintptr_t)id;
+        const Uint32 value = (Uint32)i + 1;
+        const void *found = NULL;
+        const bool exists = (values[id - 1] != 0);
+
+        switch (SDLTest_RandomIntegerInRange(0, 3)) {
+        case 0:
+            if (SDL_InsertIntoHashTable(table, key, (const void *)(uintptr_t)value, false) == exists) {
+                SDL_Log("Insert of %" SDL_PRIu32 " returned the wrong result", id);
+                result = false;
+            }
+            if (!exists) {
+                values[id - 1] = value;
+                ++count;
+            }
+            break;
+        case 1:
+            if (!SDL_InsertIntoHashTable(table, key, (const void *)(uintptr_t)value, true)) {
+                SDL_Log("Replace of %" SDL_PRIu32 " failed: %s", id, SDL_GetError());
+                result = false;
+            }
+            if (!exists) {
+                ++count;
+            }
+            values[id - 1] = value;
+            break;
+        case 2:
+            if (SDL_FindInHashTable(table, key, &found) != exists ||
+                (exists && (Uint32)(uintptr_t)found != values[id - 1])) {
+                SDL_Log("Find of %" SDL_PRIu32 " returned the wrong result", id);
+                result = false;
+            }
+            break;
+        default:
+            if (SDL_RemoveFromHashTable(table, key) != exists) {
+                SDL_Log("Remove of %" SDL_PRIu32 " returned the wrong result", id);
+                result = false;
+            }
+            if (exists) {
+                values[id - 1] = 0;
+                --count;
+            }
+            break;
+        }
+    }
+
+    check_count = true;
+    iterated_count = 0;
+    SDL_IterateHashTable(table, CountItem, values);
+    if (!check_count || iterated_count != count) {
+        SDL_Log("Iterating found %d items, expected %d", iterated_count, count);
+        result = false;
+    }
+    if (SDL_HashTableEmpty(table) != (count == 0)) {
+        SDL_Log("SDL_HashTableEmpty() returned the wrong result");
+        result = false;
+    }
+
+    SDL_ClearHashTable(table);
+    if (!SDL_HashTableEmpty(table) || SDL_FindInHashTable(table, (const void *)(uintptr_t)1, NULL)) {
+        SDL_Log("SDL_ClearHashTable() left items behind");
+        result = false;
+    }
+
+    SDL_DestroyHashTable(table);
+    SDL_free(values);
+
+    SDL_Log("Check of %d random operations: %s", CHECK_OPERATIONS, result ? "passed" : "FAILED");
+    return result;
+}
+
+static double MillionsPerSecond(int count, Uint64 elapsed)
+{
+    if (elapsed == 0) {
+        elapsed = 1;
+    }
+    return ((double)count * SDL_NS_PER_SECOND / elapsed) / 1000000.0;
+}
+
+/* Times each operation on a table of num_items, keeping the fastest of several
+   passes to filter out scheduling noise */
+static bool RunBenchmark(int num_items, bool string_keys)
+{
+    char **strings = NULL;
+    const void **keys = (const void **)SDL_malloc(num_items * 2 * sizeof(*keys));
+    Uint64 best_insert = 0, best_find = 0, best_miss = 0, best_remove = 0;
+    bool result = true;
+    int pass, i;
+
+    if (!keys) {
+        return false;
+    }
+
+    /* The second half of the keys is never inserted, for finds that miss */
+    if (string_keys) {
+        strings = (char **)SDL_calloc(num_items * 2, sizeof(*strings));
+        if (!strings) {
+            SDL_free(keys);
+            return false;
+        }
+        for (i = 0; i < num_items * 2; ++i) {
+            if (SDL_asprintf(&strings[i], "SDL.benchmark.key.%d", i) < 0) {
+                result = false;
+                goto done;
+            }
+            keys[i] = strings[i];
+        }
+    } else {
+        for (i = 0; i < num_items * 2; ++i) {
+            keys[i] = (const void *)(uintptr_t)(i + 1);
+        }
+    }
+
+    for (pass = 0; pass < BENCHMARK_PASSES; ++pass) {
+        SDL_HashTable *table;
+        Uint64 start, insert, find, miss, remove;
+
+        if (string_keys) {
+            table = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, NULL, NULL);
+        } else {
+            table = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+        }
+        if (!table) {
+            SDL_Log("Couldn't create hash table: %s", SDL_GetError());
+            result = false;
+            goto done;
+        }
+
+        start = SDL_GetTicksNS();
+        for (i = 0; i < num_items; ++i) {
+            if (!SDL_InsertIntoHashTable(table, keys[i], keys[i], false)) {
+                result = false;
+            }
+        }
+        insert = SDL_GetTicksNS() - start;
+
+        start = SDL_GetTicksNS();
+        for (i = 0; i < num_items; ++i) {
+            const void *value = NULL;
+            if (!SDL_FindInHashTable(table, keys[i], &value) || value != keys[i]) {
+                result = false;
+            }
+        }
+        find = SDL_GetTicksNS() - start;
+
+        start = SDL_GetTicksNS();
+        for (i = num_items; i < num_items * 2; ++i) {
+            if (SDL_FindInHashTable(table, keys[i], NULL)) {
+                result = false;
+            }
+        }
+        miss = SDL_GetTicksNS() - start;
+
+        start = SDL_GetTicksNS();
+        for (i = 0; i < num_items; ++i) {
+            if (!SDL_RemoveFromHashTable(table, keys[i])) {
+                result = false;
+            }
+        }
+        remove = SDL_GetTicksNS() - start;
+
+        if (!SDL_HashTableEmpty(table)) {
+            result = false;
+        }
+        SDL_DestroyHashTable(table);
+
+        if (pass == 0 || insert < best_insert) {
+            best_insert = insert;
+        }
+        if (pass == 0 || find < best_find) {
+            best_find = find;
+        }
+        if (pass == 0 || miss < best_miss) {
+            best_miss = miss;
+        }
+        if (pass == 0 || remove < best_remove) {
+            best_remove = remove;
+        }
+    }
+
+    SDL_Log("%7d %s keys: insert %7.2f, find %7.2f, miss %7.2f, remove %7.2f million/sec%s",
+            num_items, string_keys ? "string" : "    ID",
+            MillionsPerSecond(num_items, best_insert), MillionsPerSecond(num_items, best_find),
+            MillionsPerSecond(num_items, best_miss), MillionsPerSecond(num_items, best_remove),
+            result ? "" : " (FAILED)");
+
+done:
+    if (strings) {
+        for (i = 0; i < num_items * 2; ++i) {
+            SDL_free(strings[i]);
+        }
+        SDL_free(strings);
+    }
+    SDL_free(keys);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    bool benchmark = false;
+    bool result = true;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                benchmark = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--benchmark]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    if (!RunCheck()) {
+        result = false;
+    }
+
+    if (benchmark) {
+        int num_items;
+
+        SDL_Log("Best of %d passes", BENCHMARK_PASSES);
+        for (num_items = 1000; num_items <= 1000000; num_items *= 10) {
+            if (!RunBenchmark(num_items, false) || !RunBenchmark(num_items, true)) {
+                result = false;
+            }
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Times log calls that are filtered out by their priority, from several
+   threads at once, while another thread keeps changing the priorities.
+   With --benchmark, also compares logging formatted text with capturing
+   deferred log records. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+#include "testutils.h"
+
+#define DEFAULT_THREADS  4
+#define DEFAULT_CALLS    100000
+#define BENCHMARK_CALLS  10000000
+#define BENCHMARK_PASSES 5
+#define MAX_THREADS      64
+#define CUSTOM_CATEGORY  (SDL_LOG_CATEGORY_CUSTOM + 1)
+#define WRITTEN_CATEGORY (SDL_LOG_CATEGORY_CUSTOM + 16)
+#define WRITTEN_BATCH    500
+#define WRITTEN_CALLS    200000
+
+typedef struct Logger_State
+{
+    int category;
+    int num_calls;
+} Logger_State;
+
+static SDL_AtomicInt messages_written;
+static SDL_AtomicInt stop_changing;
+
+static void SDLCALL CountLogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+    SDL_AddAtomicInt(&messages_written, 1);
+}
+
+static bool SDLCALL LoggerThread(void *userdata, int index)
+{
+    const Logger_State *state = (const Logger_State *)userdata;
+    int i;
+
+    for (i = 0; i < state->num_calls; ++i) {
+        SDL_LogTrace(state->category, "This is filtered out: %d", i);
+    }
+    return true;
+}
+
+/* Keeps setting a priority that nothing in the benchmark logs at,
+   so readers always see a new copy of the priorities */
+static int SDLCALL ChangerThread(void *data)
+{
+    int changes = 0;
+
+    while (!SDL_GetAtomicInt(&stop_changing)) {
+        SDL_SetLogPriority(CUSTOM_CATEGORY + 1 + (changes % 8), (changes & 1) ? SDL_LOG_PRIORITY_INFO : SDL_LOG_PRIORITY_WARN);
+        ++changes;
+        SDL_Delay(1);
+    }
+    return changes;
+}
+
+static void SDLCALL DiscardLogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+}
+
+static void SDLCALL DiscardLogRecord(void *userdata, const SDL_LogRecord *record)
+{
+    int *count = (int *)userdata;
+    ++*count;
+}
+
+/* Times log calls that are written, in batches small enough that deferred
+   records always fit in the thread's buffer. Only the log calls are timed,
+   not reading the records back. Returns the time taken, in nanoseconds. */
+static bool RunWrittenBenchmark(bool deferred, Uint64 *elapsed)
+{
+    Uint64 total = 0;
+    int records = 0;
+    int i, j;
+
+    SDL_SetLogOutputFunction(DiscardLogOutput, NULL);
+    SDL_SetLogDeferred(deferred);
+
+    for (i = 0; i < WRITTEN_CALLS; i += WRITTEN_BATCH) {
+        const Uint64 start = SDL_GetTicksNS();
+        for (j = i; j < i + WRITTEN_BATCH; ++j) {
+            SDL_LogInfo(WRITTEN_CATEGORY, "Frame %d took %.3f ms, %s", j, (double)j * 0.001, "on time");
+        }
+        total += SDL_GetTicksNS() - start;
+
+        if (deferred) {
+            SDL_ReadLogRecords(DiscardLogRecord, &records);
+        }
+    }
+
+    SDL_SetLogDeferred(false);
+    SDL_SetLogOutputFunction(CountLogOutput, NULL);
+
+    *elapsed = SDL_max(total, 1);
+    return !deferred || records == WRITTEN_CALLS;
+}
+
+int main(int argc, char *argv[])
+{
+    static const struct
+    {
+        int category;
+        const char *name;
+    } categories[] = {
+        { SDL_LOG_CATEGORY_APPLICATION, "built-in" },
+        { CUSTOM_CATEGORY, "  custom" }
+    };
+    SDLTest_CommonState *state;
+    SDL_Thread *changer;
+    int max_threads = DEFAULT_THREADS;
+    int num_calls = DEFAULT_CALLS;
+    int passes = 1;
+    int changes = 0;
+    int num_threads, c, i;
+    bool result = true;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_THREADS);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                num_calls = BENCHMARK_CALLS;
+                passes = BENCHMARK_PASSES;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--threads N]", "[--benchmark]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_SetLogPriority(CUSTOM_CATEGORY, SDL_LOG_PRIORITY_ERROR);
+    SDL_SetLogPriority(WRITTEN_CATEGORY, SDL_LOG_PRIORITY_INFO);
+    SDL_SetLogOutputFunction(CountLogOutput, NULL);
+
+    changer = SDL_CreateThread(ChangerThread, "PriorityChanger", NULL);
+    if (!changer) {
+        SDL_SetLogOutputFunction(SDL_GetDefaultLogOutputFunction(), NULL);
+        SDL_Log("Couldn't create thread: %s", SDL_GetError());
+        SDL_Quit();
+        return 1;
+    }
+
+    for (c = 0; c < (int)SDL_arraysize(categories); ++c) {
+        for (num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+            Logger_State logger;
+            Uint64 best;
+
+            logger.category = categories[c].category;
+            logger.num_calls = num_calls;
+            if (!RunTestThreads(LoggerThread, &logger, num_threads, passes, &best)) {
+                result = false;
+            }
+
+            SDL_SetLogOutputFunction(SDL_GetDefaultLogOutputFunction(), NULL);
+            SDL_Log("%s category, %2d thread(s): %6.2f ns per filtered log call, %7.2f million calls/sec in total",
+                    categories[c].name, num_threads, (double)best / num_calls,
+                    ((double)num_calls * num_threads * SDL_NS_PER_SECOND / best) / 1000000.0);
+            SDL_SetLogOutputFunction(CountLogOutput, NULL);
+        }
+    }
+
+    if (passes > 1) {
+        Uint64 best[2] = { 0, 0 };
+        int mode, pass;
+
+        for (mode = 0; mode < 2; ++mode) {
+            for (pass = 0; pass < passes; ++pass) {
+                Uint64 elapsed;
+
+                if (!RunWrittenBenchmark(mode == 1, &elapsed)) {
+                    SDL_SetLogOutputFunction(SDL_GetDefaultLogOutputFunction(), NULL);
+                    SDL_Log("FAIL: deferred log records were dropped");
+                    SDL_SetLogOutputFunction(CountLogOutput, NULL);
+                    result = false;
+                }
+                if (pass == 0 || elapsed < best[mode]) {
+                    best[mode] = elapsed;
+                }
+            }
+        }
+
+        SDL_SetLogOutputFunction(SDL_GetDefaultLogOutputFunction(), NULL);
+        SDL_Log("Written log calls: %6.2f ns formatted, %6.2f ns deferred",
+                (double)best[0] / WRITTEN_CALLS, (double)best[1] / WRITTEN_CALLS);
+        SDL_SetLogOutputFunction(CountLogOutput, NULL);
+    }
+
+    SDL_SetAtomicInt(&stop_changing, 1);
+    SDL_WaitThread(changer, &changes);
+
+    SDL_SetLogOutputFunction(SDL_GetDefaultLogOutputFunction(), NULL);
+    SDL_Log("Priorities were changed %d times while logging", changes);
+    if (SDL_GetAtomicInt(&messages_written) != 0) {
+        SDL_Log("FAIL: %d filtered messages were written", SDL_GetAtomicInt(&messages_written));
+        result = false;
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
@@ -0,0 +1,287 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks the thread caching memory functions with random allocations on
+   several threads, some freed on other threads than they were allocated on.
+   With --benchmark, also compares their throughput with the original memory
+   functions, for 1 to N threads. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+#include "testutils.h"
+
+#define DEFAULT_THREADS     4
+#define MAX_THREADS         64
+#define CHECK_SLOTS         256
+#define CHECK_OPERATIONS    200000
+#define EXCHANGE_SLOTS      16
+#define BENCHMARK_BLOCKS    64
+#define BENCHMARK_ROUNDS    20000
+#define BENCHMARK_PASSES    5
+
+typedef struct MemoryFunctions
+{
+    SDL_malloc_func malloc_func;
+    SDL_calloc_func calloc_func;
+    SDL_realloc_func realloc_func;
+    SDL_free_func free_func;
+} MemoryFunctions;
+
+/* Blocks passed between threads, to be freed by whoever takes them */
+typedef struct Exchanged_Block
+{
+    Uint8 *mem;
+    size_t size;
+    Uint8 tag;
+} Exchanged_Block;
+
+static void *exchange[EXCHANGE_SLOTS];
+
+static size_t RandomSize(Uint64 *seed)
+{
+    /* Mostly small blocks, which are cached, and a few large ones */
+    if (SDL_rand_r(seed, 16) == 0) {
+        return 1025 + (size_t)SDL_rand_r(seed, 8192);
+    }
+    return 1 + (size_t)SDL_rand_r(seed, 1024);
+}
+
+static bool CheckBlock(const Uint8 *mem, size_t size, Uint8 tag)
+{
+    size_t i;
+
+    for (i = 0; i < size; ++i) {
+        if (mem[i] != tag) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool SDLCALL CheckThread(void *userdata, int index)
+{
+    const MemoryFunctions *f = (const MemoryFunctions *)userdata;
+    Uint8 *mem[CHECK_SLOTS];
+    size_t size[CHECK_SLOTS];
+    Uint8 tag[CHECK_SLOTS];
+    Uint64 seed = (Uint64)index + 1;
+    bool failed = false;
+    int i;
+
+    SDL_zeroa(mem);
+
+    for (i = 0; i < CHECK_OPERATIONS && !failed; ++i) {
+        const int slot = SDL_rand_r(&seed, CHECK_SLOTS);
+
+        if (!mem[slot]) {
+            size[slot] = RandomSize(&seed);
+            tag[slot] = (Uint8)(i | 1);
+            if (SDL_rand_r(&seed, 4) == 0) {
+                mem[slot] = (Uint8 *)f->calloc_func(1, size[slot]);
+                if (mem[slot] && !CheckBlock(mem[slot], size[slot], 0)) {
+                    SDL_Log("calloc() returned memory that wasn't cleared");
+                    failed = true;
+                }
+            } else {
+                mem[slot] = (Uint8 *)f->malloc_func(size[slot]);
+            }
+            if (!mem[slot]) {
+                SDL_Log("Couldn't allocate %d bytes", (int)size[slot]);
+                failed = true;
+                break;
+            }
+            SDL_memset(mem[slot], tag[slot], size[slot]);
+            continue;
+        }
+
+        if (!CheckBlock(mem[slot], size[slot], tag[slot])) {
+            SDL_Log("A block of %d bytes was overwritten", (int)size[slot]);
+            failed = true;
+            break;
+        }
+
+        switch (SDL_rand_r(&seed, 3)) {
+        case 0: {
+            const size_t new_size = RandomSize(&seed);
+            Uint8 *new_mem = (Uint8 *)f->realloc_func(mem[slot], new_size);
+
+            if (!new_mem) {
+                SDL_Log("Couldn't reallocate %d bytes", (int)new_size);
+                failed = true;
+                break;
+            }
+            if (!CheckBlock(new_mem, SDL_min(size[slot], new_size), tag[slot])) {
+                SDL_Log("realloc() didn't keep the contents of a block");
+                failed = true;
+            }
+            mem[slot] = new_mem;
+            size[slot] = new_size;
+            SDL_memset(mem[slot], tag[slot], size[slot]);
+            break;
+        }
+        case 1: {
+            /* Swap the block with one from another thread, if there is one */
+            const int e = SDL_rand_r(&seed, EXCHANGE_SLOTS);
+            Exchanged_Block *block = (Exchanged_Block *)f->malloc_func(sizeof(*block));
+            Exchanged_Block *taken;
+
+            if (!block) {
+                failed = true;
+                break;
+            }
+            block->mem = mem[slot];
+            block->size = size[slot];
+            block->tag = tag[slot];
+            mem[slot] = NULL;
+
+            taken = (Exchanged_Block *)SDL_SetAtomicPointer(&exchange[e], block);
+            if (taken) {
+                if (!CheckBlock(taken->mem, taken->size, taken->tag)) {
+                    SDL_Log("A block from another thread was overwritten");
+                    failed = true;
+                }
+                f->free_func(taken->mem);
+                f->free_func(taken);
+            }
+            break;
+        }
+        default:
+            f->free_func(mem[slot]);
+            mem[slot] = NULL;
+            break;
+        }
+    }
+
+    for (i = 0; i < CHECK_SLOTS; ++i) {
+        f->free_func(mem[i]);
+    }
+    return !failed;
+}
+
+/* Allocates and frees batches of small blocks, like a thread building
+   and throwing away short lived objects */
+static bool SDLCALL BenchmarkThread(void *userdata, int index)
+{
+    const MemoryFunctions *f = (const MemoryFunctions *)userdata;
+    void *blocks[BENCHMARK_BLOCKS];
+    size_t sizes[BENCHMARK_BLOCKS];
+    Uint64 seed = (Uint64)index + 1;
+    bool failed = false;
+    int round, i;
+
+    for (i = 0; i < BENCHMARK_BLOCKS; ++i) {
+        sizes[i] = 8 + (size_t)SDL_rand_r(&seed, 248);
+    }
+
+    for (round = 0; round < BENCHMARK_ROUNDS; ++round) {
+        for (i = 0; i < BENCHMARK_BLOCKS; ++i) {
+            blocks[i] = f->malloc_func(sizes[(i + round) % BENCHMARK_BLOCKS]);
+            if (!blocks[i]) {
+                failed = true;
+            }
+        }
+        for (i = 0; i < BENCHMARK_BLOCKS; ++i) {
+            f->free_func(blocks[i]);
+        }
+    }
+    return !failed;
+}
+
+static void FreeExchangedBlocks(const MemoryFunctions *f)
+{
+    int i;
+
+    for (i = 0; i < EXCHANGE_SLOTS; ++i) {
+        Exchanged_Block *block = (Exchanged_Block *)SDL_SetAtomicPointer(&exchange[i], NULL);
+        if (block) {
+            f->free_func(block->mem);
+            f->free_func(block);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    MemoryFunctions functions[2];
+    static const char *names[2] = { "original", "  cached" };
+    int max_threads = DEFAULT_THREADS;
+    bool benchmark = false;
+    bool result = true;
+    int num_threads, i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_clamp(SDL_atoi(argv[i + 1]), 1, MAX_THREADS);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                benchmark = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--threads N]", "[--benchmark]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    SDL_GetOriginalMemoryFunctions(&functions[0].malloc_func, &functions[0].calloc_func, &functions[0].realloc_func, &functions[0].free_func);
+    SDL_GetThreadCacheMemoryFunctions(&functions[1].malloc_func, &functions[1].calloc_func, &functions[1].realloc_func, &functions[1].free_func);
+
+    if (!RunTestThreads(CheckThread, &functions[1], max_threads, 1, NULL)) {
+        result = false;
+    }
+    FreeExchangedBlocks(&functions[1]);
+    SDL_Log("Check of %d random operations on %d thread(s): %s", CHECK_OPERATIONS, max_threads, result ? "passed" : "FAILED");
+
+    if (benchmark) {
+        SDL_Log("Best of %d passes", BENCHMARK_PASSES);
+        for (num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+            int f;
+
+            for (f = 0; f < (int)SDL_arraysize(functions); ++f) {
+                const int operations = BENCHMARK_ROUNDS * BENCHMARK_BLOCKS;
+                Uint64 best;
+
+                if (!RunTestThreads(BenchmarkThread, &functions[f], num_threads, BENCHMARK_PASSES, &best)) {
+                    result = false;
+                }
+
+                SDL_Log("%s, %2d thread(s): %6.2f ns per malloc and free, %7.2f million pairs/sec in total",
+                        names[f], num_threads, (double)best / operations,
+                        ((double)operations * num_threads * SDL_NS_PER_SECOND / best) / 1000000.0);
+            }
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
@@ -0,0 +1,279 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks SDL's SIMD memory copy and set functions against a simple reference
+   for every size and alignment up to a few vectors, and with --benchmark,
+   compares their speed with SDL_memcpy() and SDL_memset() across sizes */
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_internal.h"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+/* The SIMD functions aren't exported from SDL, so build them in */
+#include "../src/stdlib/SDL_memcpy_simd.c"
+
+#define CHECK_MAX_SIZE       300
+#define CHECK_MAX_OFFSET     64
+#define CHECK_LARGE_SIZE     (SDL_STREAMING_MEMORY_THRESHOLD + 77)
+#define GUARD_SIZE           64
+#define BENCHMARK_MAX_SIZE   (32 * 1024 * 1024)
+#define BENCHMARK_BYTES      (256 * 1024 * 1024)
+#define BENCHMARK_PASSES     3
+
+typedef struct Implementation
+{
+    const char *name;
+    bool (SDLCALL *available)(void);
+    void (*copy)(void *dst, const void *src, size_t len, bool streaming);
+    void (*set)(void *dst, int c, size_t len, bool streaming);
+} Implementation;
+
+static const Implementation implementations[] = {
+#ifdef SDL_SSE2_INTRINSICS
+    { "SSE2", SDL_HasSSE2, SDL_memcpySSE2, SDL_memsetSSE2 },
+#endif
+#if defined(SDL_AVX2_INTRINSICS) && defined(SDL_SSE2_INTRINSICS)
+    { "AVX2", SDL_HasAVX2, SDL_memcpyAVX2, SDL_memsetAVX2 },
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    { "NEON", SDL_HasNEON, SDL_memcpyNEON, SDL_memsetNEON },
+#endif
+    { NULL, NULL, NULL, NULL }
+};
+
+static Uint8 *src_buf;
+static Uint8 *dst_buf;
+static Uint8 expected_buf[CHECK_LARGE_SIZE];
+static volatile Uint8 sink;
+
+/* Checks a copy or set of len bytes at dst_buf + GUARD_SIZE + offset, which
+   should match expected and leave everything around it alone */
+static bool CheckResult(const Uint8 *expected, size_t offset, size_t len)
+{
+    const Uint8 *dst = dst_buf + GUARD_SIZE + offset;
+    size_t i;
+
+    for (i = 0; i < GUARD_SIZE + offset; ++i) {
+        if (dst_buf[i] != 0xEE) {
+            return false;
+        }
+    }
+    if (SDL_memcmp(dst, expected, len) != 0) {
+        return false;
+    }
+    for (i = 0; i < GUARD_SIZE; ++i) {
+        if (dst[len + i] != 0xEE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool CheckOne(const Implementation *impl, size_t src_offset, size_t dst_offset, size_t len, bool streaming)
+{
+    Uint8 *dst = dst_buf + GUARD_SIZE + dst_offset;
+    const int value = (int)((len + dst_offset) & 0xFF) | 0x100;  /* only the low byte should be used */
+
+    SDL_memset(dst_buf, 0xEE, len + dst_offset + GUARD_SIZE * 2);
+    impl->copy(dst, src_buf + src_offset, len, streaming);
+    if (!CheckResult(src_buf + src_offset, dst_offset, len)) {
+        SDL_Log("FAIL: %s copy of %d bytes from offset %d to offset %d%s", impl->name, (int)len, (int)src_offset, (int)dst_offset, streaming ? ", streaming" : "");
+        return false;
+    }
+
+    SDL_memset(dst_buf, 0xEE, len + dst_offset + GUARD_SIZE * 2);
+    impl->set(dst, value, len, streaming);
+    SDL_memset(expected_buf, (Uint8)value, len);
+    if (!CheckResult(expected_buf, dst_offset, len)) {
+        SDL_Log("FAIL: %s set of %d bytes at offset %d%s", impl->name, (int)len, (int)dst_offset, streaming ? ", streaming" : "");
+        return false;
+    }
+    return true;
+}
+
+static bool RunCheck(const Implementation *impl)
+{
+    size_t len, src_offset, dst_offset;
+    int streaming;
+
+    for (streaming = 0; streaming < 2; ++streaming) {
+        for (len = 0; len <= CHECK_MAX_SIZE; ++len) {
+            for (dst_offset = 0; dst_offset < CHECK_MAX_OFFSET; ++dst_offset) {
+                src_offset = (len * 7 + dst_offset * 3) % CHECK_MAX_OFFSET;
+                if (!CheckOne(impl, src_offset, dst_offset, len, streaming != 0)) {
+                    return false;
+                }
+            }
+        }
+        for (dst_offset = 0; dst_offset < CHECK_MAX_OFFSET; dst_offset += 13) {
+            if (!CheckOne(impl, CHECK_MAX_OFFSET - 1 - dst_offset, dst_offset, CHECK_LARGE_SIZE, streaming != 0)) {
+                return false;
+            }
+        }
+    }
+    SDL_Log("%s: passed", impl->name);
+    return true;
+}
+
+static void CopyWithSDL(void *dst, const void *src, size_t len, bool streaming)
+{
+    SDL_memcpy(dst, src, len);
+}
+
+static void SetWithSDL(void *dst, int c, size_t len, bool streaming)
+{
+    SDL_memset(dst, c, len);
+}
+
+/* Returns the speed in GB/s, the fastest of several passes */
+static double Benchmark(const Implementation *impl, bool copy, size_t len, bool streaming)
+{
+    const size_t count = SDL_max(BENCHMARK_BYTES / len, 1);
+    Uint64 best = 0;
+    int pass;
+
+    for (pass = 0; pass < BENCHMARK_PASSES; ++pass) {
+        const Uint64 start = SDL_GetTicksNS();
+        Uint64 elapsed;
+        size_t i;
+
+        for (i = 0; i < count; ++i) {
+            if (copy) {
+                impl->copy(dst_buf, src_buf, len, streaming);
+            } else {
+                impl->set(dst_buf, (int)i, len, streaming);
+            }
+            sink = dst_buf[len - 1];
+        }
+        elapsed = SDL_GetTicksNS() - start;
+        if (pass == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return ((double)count * len / SDL_max(best, 1));
+}
+
+static void RunBenchmark(void)
+{
+    static const Implementation sdl = { "SDL", NULL, CopyWithSDL, SetWithSDL };
+    int op;
+
+    SDL_Log("GB/s, best of %d passes, streaming is used at %d bytes and up", BENCHMARK_PASSES, SDL_STREAMING_MEMORY_THRESHOLD);
+    for (op = 0; op < 2; ++op) {
+        const bool copy = (op == 0);
+        size_t len;
+
+        SDL_Log("%s", copy ? "memcpy" : "memset");
+        for (len = 64; len <= BENCHMARK_MAX_SIZE; len *= 4) {
+            char line[256];
+            int i;
+
+            (void)SDL_snprintf(line, sizeof(line), "%9d bytes: SDL %6.2f", (int)len, Benchmark(&sdl, copy, len, false));
+            for (i = 0; implementations[i].name; ++i) {
+                const Implementation *impl = &implementations[i];
+                if (impl->available()) {
+                    const size_t used = SDL_strlen(line);
+                    (void)SDL_snprintf(line + used, sizeof(line) - used, ", %s %6.2f, streaming %6.2f",
+                                       impl->name, Benchmark(impl, copy, len, false), Benchmark(impl, copy, len, true));
+                }
+            }
+            SDL_Log("%s", line);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    const size_t buffer_size = SDL_max(BENCHMARK_MAX_SIZE, CHECK_LARGE_SIZE + CHECK_MAX_OFFSET + GUARD_SIZE * 2);
+    bool benchmark = false;
+    bool result = true;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed == 0) {
+            consumed = -1;
+            if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                benchmark = true;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--benchmark]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!SDL_Init(0)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return 1;
+    }
+
+    src_buf = (Uint8 *)SDL_malloc(buffer_size);
+    dst_buf = (Uint8 *)SDL_malloc(buffer_size);
+    if (!src_buf || !dst_buf) {
+        result = false;
+        goto done;
+    }
+    for (i = 0; i < (int)buffer_size; ++i) {
+        src_buf[i] = (Uint8)(i * 7 + (i >> 8));
+    }
+
+    for (i = 0; implementations[i].name; ++i) {
+        if (!implementations[i].available()) {
+            SDL_Log("%s: not available", implementations[i].name);
+        } else if (!RunCheck(&implementations[i])) {
+            result = false;
+        }
+    }
+
+    if (benchmark) {
+        RunBenchmark();
+    }
+
+done:
+    SDL_free(src_buf);
+    SDL_free(dst_buf);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
@@ -0,0 +1,256 @@
+/*
+  Copyright (C) 1997-2025 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Uses a few subsystems with memory statistics enabled, checking that their
+   memory is counted under their own tags, and that SDL_Quit() frees it */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define APP_ALLOCATION_SIZE 10000
+#define PUSHED_EVENTS       100
+
+static const struct
+{
+    SDL_MemoryTag tag;
+    const char *name;
+} tags[] = {
+    { SDL_MEMORY_TAG_ALL, "all" },
+    { SDL_MEMORY_TAG_OTHER, "other" },
+    { SDL_MEMORY_TAG_AUDIO, "audio" },
+    { SDL_MEMORY_TAG_VIDEO, "video" },
+    { SDL_MEMORY_TAG_RENDER, "render" },
+    { SDL_MEMORY_TAG_EVENTS, "events" },
+    { SDL_MEMORY_TAG_GPU, "gpu" },
+    { SDL_MEMORY_TAG_JOYSTICK, "joystick" }
+};
+
+static void LogMemoryStats(const char *when)
+{
+    int i;
+
+    SDL_Log("Memory %s:", when);
+    for (i = 0; i < (int)SDL_arraysize(tags); ++i) {
+        SDL_MemoryStats stats;
+
+        if (SDL_GetMemoryStats(tags[i].tag, &stats)) {
+            SDL_Log("  %-8s %9" SDL_PRIu64 " bytes in %6" SDL_PRIu64 " allocations, peak %9" SDL_PRIu64 " bytes, %7" SDL_PRIu64 " allocations in total",
+                    tags[i].name, stats.live_bytes, stats.live_allocations, stats.peak_bytes, stats.total_allocations);
+        }
+    }
+}
+
+static Uint64 GetLiveBytes(SDL_MemoryTag tag)
+{
+    SDL_MemoryStats stats;
+
+    if (!SDL_GetMemoryStats(tag, &stats)) {
+        return 0;
+    }
+    return stats.live_bytes;
+}
+
+/* Every allocation is counted under exactly one tag, as well as under all */
+static bool CheckTotals(void)
+{
+    SDL_MemoryStats all, stats;
+    Uint64 bytes = 0, allocations = 0;
+    int tag;
+
+    SDL_GetMemoryStats(SDL_MEMORY_TAG_ALL, &all);
+    for (tag = SDL_MEMORY_TAG_ALL + 1; tag < SDL_MEMORY_TAG_COUNT; ++tag) {
+        SDL_GetMemoryStats((SDL_MemoryTag)tag, &stats);
+        bytes += stats.live_bytes;
+        allocations += stats.live_allocations;
+    }
+    if (bytes != all.live_bytes || allocations != all.live_allocations) {
+        SDL_Log("FAIL: the tags add up to %" SDL_PRIu64 " bytes in %" SDL_PRIu64 " allocations, expected %" SDL_PRIu64 " bytes in %" SDL_PRIu64 " allocations",
+                bytes, allocations, all.live_bytes, all.live_allocations);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckTagUsed(SDL_MemoryTag tag, const char *name)
+{
+    if (GetLiveBytes(tag) == 0) {
+        SDL_Log("FAIL: no memory was counted under the %s tag", name);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckAppAllocation(void)
+{
+    const Uint64 before = GetLiveBytes(SDL_MEMORY_TAG_OTHER);
+    void *mem = SDL_malloc(APP_ALLOCATION_SIZE);
+    bool result = true;
+
+    if (!mem) {
+        return false;
+    }
+    if (GetLiveBytes(SDL_MEMORY_TAG_OTHER) != before + APP_ALLOCATION_SIZE) {
+        SDL_Log("FAIL: SDL_malloc() wasn't counted under the other tag");
+        result = false;
+    }
+
+    mem = SDL_realloc(mem, APP_ALLOCATION_SIZE * 2);
+    if (!mem) {
+        return false;
+    }
+    if (GetLiveBytes(SDL_MEMORY_TAG_OTHER) != before + APP_ALLOCATION_SIZE * 2) {
+        SDL_Log("FAIL: SDL_realloc() wasn't counted under the other tag");
+        result = false;
+    }
+
+    SDL_free(mem);
+    if (GetLiveBytes(SDL_MEMORY_TAG_OTHER) != before) {
+        SDL_Log("FAIL: SDL_free() wasn't counted under the other tag");
+        result = false;
+    }
+    return result;
+}
+
+static bool UseSubsystems(void)
+{
+    SDL_Window *window = NULL;
+    SDL_Renderer *renderer = NULL;
+    SDL_Texture *texture = NULL;
+    SDL_AudioStream *stream = NULL;
+    SDL_AudioSpec spec;
+    SDL_Event event;
+    bool result = true;
+    int i;
+
+    if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
+        SDL_Log("Couldn't initialize SDL: %s", SDL_GetError());
+        return false;
+    }
+
+    if (!SDL_CreateWindowAndRenderer("testmemorystats", 320, 240, SDL_WINDOW_HIDDEN, &window, &renderer)) {
+        SDL_Log("Couldn't create window and renderer: %s", SDL_GetError());
+        result = false;
+        goto done;
+    }
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_STREAMING, 64, 64);
+    if (!texture) {
+        SDL_Log("Couldn't create texture: %s", SDL_GetError());
+        result = false;
+        goto done;
+    }
+
+    spec.format = SDL_AUDIO_S16;
+    spec.channels = 2;
+    spec.freq = 44100;
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, NULL, NULL);
+    if (!stream) {
+        SDL_Log("Couldn't open audio device: %s", SDL_GetError());
+        result = false;
+        goto done;
+    }
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    for (i = 0; i < PUSHED_EVENTS; ++i) {
+        SDL_PushEvent(&event);
+    }
+
+    LogMemoryStats("in use");
+    if (GetLiveBytes(SDL_MEMORY_TAG_OTHER) == GetLiveBytes(SDL_MEMORY_TAG_ALL)) {
+        SDL_Log("SDL was built without memory tags, everything is counted as other");
+    } else if (!CheckTagUsed(SDL_MEMORY_TAG_AUDIO, "audio") ||
+               !CheckTagUsed(SDL_MEMORY_TAG_VIDEO, "video") ||
+               !CheckTagUsed(SDL_MEMORY_TAG_RENDER, "render") ||
+               !CheckTagUsed(SDL_MEMORY_TAG_EVENTS, "events")) {
+        result = false;
+    }
+    if (!CheckTotals() || !CheckAppAllocation()) {
+        result = false;
+    }
+
+    while (SDL_PollEvent(&event)) {
+    }
+
+done:
+    SDL_DestroyAudioStream(stream);
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_MemoryStats stats;
+    bool result = true;
+    int tag, i;
+
+    /* This has to come first, before anything is allocated */
+    if (!SDL_EnableMemoryStats()) {
+        SDL_Log("Couldn't enable memory statistics: %s", SDL_GetError());
+        return 1;
+    }
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed <= 0) {
+            SDLTest_CommonLogUsage(state, argv[0], NULL);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    /* Enabling again is fine, since everything allocated so far has a header */
+    if (!SDL_EnableMemoryStats()) {
+        SDL_Log("FAIL: SDL_EnableMemoryStats() failed once enabled: %s", SDL_GetError());
+        result = false;
+    }
+
+    if (!UseSubsystems()) {
+        result = false;
+    }
+
+    /* Anything the subsystems still have allocated was leaked */
+    LogMemoryStats("after SDL_Quit()");
+    for (tag = SDL_MEMORY_TAG_AUDIO; tag < SDL_MEMORY_TAG_COUNT; ++tag) {
+        SDL_GetMemoryStats((SDL_MemoryTag)tag, &stats);
+        if (stats.live_allocations != 0) {
+            SDL_Log("FAIL: %" SDL_PRIu64 " allocations of the %s tag are still live", stats.live_allocations, tags[tag].name);
+            result = false;
+        }
+    }
+    if (!CheckTotals()) {
+        result = false;
+    }
+
+    SDL_ResetMemoryStats();
+    SDL_GetMemoryStats(SDL_MEMORY_TAG_ALL, &stats);
+    if (stats.peak_bytes != stats.live_bytes || stats.total_allocations != 0) {
+        SDL_Log("FAIL: SDL_ResetMemoryStats() didn't reset the peak and total allocations");
+        result = false;
+    }
+
+    /* Logging set SDL up again */
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result ? 0 : 1;
+}
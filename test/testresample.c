@@ -15,10 +15,253 @@
 #include <SDL3/SDL_test.h>
 
 static void log_usage(char *progname, SDLTest_CommonState *state) {
-    static const char *options[] = { "in.wav", "out.wav", "newfreq", "newchan", NULL };
+    static const char *options[] = { "[--benchmark [seconds]]", "[--compare-kernels]", "[--quality fast|medium|high]", "in.wav", "out.wav", "newfreq", "newchan", NULL };
     SDLTest_CommonLogUsage(state, progname, options);
 }
 
+/* Time float resampling through an audio stream for every channel count SDL supports.
+   Run with SDL_CPU_FEATURE_MASK=-avx512f, -avx2, -sse, etc. to compare the kernels. */
+#define BENCHMARK_PASSES 5
+
+static bool run_benchmark(int seconds, SDL_AudioResamplerQuality quality)
+{
+    static const struct
+    {
+        int src_freq;
+        int dst_freq;
+    } rates[] = {
+        { 44100, 48000 },
+        { 48000, 44100 },
+        { 22050, 48000 },
+        { 48000, 96000 },
+    };
+    SDL_AudioSpec src_spec, dst_spec;
+    float *src_buf = NULL;
+    float *dst_buf = NULL;
+    bool result = true;
+    int channels, r, i;
+
+    SDL_Log("Resampling %d second(s) of float audio per pass at quality %d, best of %d passes", seconds, (int)quality, BENCHMARK_PASSES);
+
+    for (r = 0; r < (int)SDL_arraysize(rates); ++r) {
+        const int src_frames = rates[r].src_freq * seconds;
+        const int dst_frames = (int)(((Sint64)src_frames * rates[r].dst_freq) / rates[r].src_freq) + 1024;
+
+        for (channels = 1; channels <= 8; ++channels) {
+            Uint64 elapsed;
+            int dst_bytes = 0;
+            int pass;
+
+            src_buf = (float *)SDL_malloc((size_t)src_frames * channels * sizeof(float));
+            dst_buf = (float *)SDL_malloc((size_t)dst_frames * channels * sizeof(float));
+            if (!src_buf || !dst_buf) {
+                result = false;
+                goto done;
+            }
+            for (i = 0; i < src_frames * channels; ++i) {
+                src_buf[i] = SDL_sinf((float)i * 0.01f) * 0.5f;
+            }
+
+            src_spec.format = SDL_AUDIO_F32;
+            src_spec.channels = channels;
+            src_spec.freq = rates[r].src_freq;
+            dst_spec = src_spec;
+            dst_spec.freq = rates[r].dst_freq;
+
+            /* Time the fastest pass; the first one also warms up the caches */
+            elapsed = 0;
+            for (pass = 0; pass < BENCHMARK_PASSES; ++pass) {
+                SDL_AudioStream *stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+                Uint64 start, pass_time;
+                int got;
+
+                if (!stream) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to create stream: %s", SDL_GetError());
+                    result = false;
+                    goto done;
+                }
+                SDL_SetAudioStreamResamplerQuality(stream, quality);
+
+                start = SDL_GetTicksNS();
+                SDL_PutAudioStreamData(stream, src_buf, src_frames * channels * (int)sizeof(float));
+                SDL_FlushAudioStream(stream);
+                dst_bytes = 0;
+                while ((got = SDL_GetAudioStreamData(stream, (Uint8 *)dst_buf + dst_bytes, dst_frames * channels * (int)sizeof(float) - dst_bytes)) > 0) {
+                    dst_bytes += got;
+                }
+                pass_time = SDL_GetTicksNS() - start;
+                SDL_DestroyAudioStream(stream);
+
+                if (pass == 0 || pass_time < elapsed) {
+                    elapsed = pass_time;
+                }
+            }
+
+            if (elapsed == 0) {
+                elapsed = 1;
+            }
+            SDL_Log("%5d Hz -> %5d Hz, %d channel(s): %8.2f ms, %7.2f million output frames/sec",
+                    rates[r].src_freq, rates[r].dst_freq, channels,
+                    (double)elapsed / SDL_NS_PER_MS,
+                    ((double)(dst_bytes / ((int)sizeof(float) * channels)) * SDL_NS_PER_SECOND / elapsed) / 1000000.0);
+
+            SDL_free(src_buf);
+            SDL_free(dst_buf);
+            src_buf = NULL;
+            dst_buf = NULL;
+        }
+    }
+
+done:
+    SDL_free(src_buf);
+    SDL_free(dst_buf);
+    return result;
+}
+
+/* Resample a different tone in every channel for each channel count, and log a checksum of the output.
+   Runs with different SDL_CPU_FEATURE_MASK settings should log the same checksums. */
+static bool log_checksums(SDL_AudioResamplerQuality quality)
+{
+    static const struct
+    {
+        int src_freq;
+        int dst_freq;
+    } rates[] = {
+        { 44100, 48000 },
+        { 48000, 44100 },
+    };
+    const int src_frames = 4096;
+    SDL_AudioSpec src_spec, dst_spec;
+    float *src_buf = NULL;
+    Uint8 *dst_buf = NULL;
+    bool result = true;
+    int channels, r, i;
+
+    src_buf = (float *)SDL_malloc((size_t)src_frames * 8 * sizeof(float));
+    if (!src_buf) {
+        return false;
+    }
+
+    for (r = 0; r < (int)SDL_arraysize(rates); ++r) {
+        for (channels = 1; channels <= 8; ++channels) {
+            SDL_AudioStream *stream;
+            int dst_len;
+
+            for (i = 0; i < src_frames * channels; ++i) {
+                src_buf[i] = SDL_sinf((float)(i / channels) * 0.01f * (float)(1 + i % channels)) * 0.5f;
+            }
+
+            src_spec.format = SDL_AUDIO_F32;
+            src_spec.channels = channels;
+            src_spec.freq = rates[r].src_freq;
+            dst_spec = src_spec;
+            dst_spec.freq = rates[r].dst_freq;
+
+            stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+            if (!stream ||
+                !SDL_SetAudioStreamResamplerQuality(stream, quality) ||
+                !SDL_PutAudioStreamData(stream, src_buf, src_frames * channels * (int)sizeof(float)) ||
+                !SDL_FlushAudioStream(stream)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to convert samples: %s", SDL_GetError());
+                SDL_DestroyAudioStream(stream);
+                result = false;
+                goto done;
+            }
+
+            dst_len = SDL_GetAudioStreamAvailable(stream);
+            dst_buf = (Uint8 *)SDL_malloc(dst_len);
+            if (!dst_buf || SDL_GetAudioStreamData(stream, dst_buf, dst_len) != dst_len) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to convert samples: %s", SDL_GetError());
+                SDL_DestroyAudioStream(stream);
+                result = false;
+                goto done;
+            }
+            SDL_DestroyAudioStream(stream);
+
+            SDL_Log("%5d Hz -> %5d Hz, %d channel(s): %08" SDL_PRIx32,
+                    rates[r].src_freq, rates[r].dst_freq, channels, SDL_crc32(0, dst_buf, dst_len));
+
+            SDL_free(dst_buf);
+            dst_buf = NULL;
+        }
+    }
+
+done:
+    SDL_free(src_buf);
+    SDL_free(dst_buf);
+    return result;
+}
+
+/* Run this program with --checksums under a CPU feature mask, and return what it logged */
+static char *run_checksums(const char *progname, const char *mask)
+{
+    const char *args[] = { progname, "--checksums", NULL };
+    SDL_Environment *env;
+    SDL_PropertiesID props;
+    SDL_Process *process;
+    char *output = NULL;
+    int exit_code = -1;
+
+    env = SDL_CreateEnvironment(true);
+    if (!env) {
+        return NULL;
+    }
+    SDL_SetEnvironmentVariable(env, "SDL_CPU_FEATURE_MASK", mask, true);
+
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_PROCESS_CREATE_ARGS_POINTER, (void *)args);
+    SDL_SetPointerProperty(props, SDL_PROP_PROCESS_CREATE_ENVIRONMENT_POINTER, env);
+    SDL_SetNumberProperty(props, SDL_PROP_PROCESS_CREATE_STDOUT_NUMBER, SDL_PROCESS_STDIO_APP);
+    SDL_SetBooleanProperty(props, SDL_PROP_PROCESS_CREATE_STDERR_TO_STDOUT_BOOLEAN, true);
+    process = SDL_CreateProcessWithProperties(props);
+    SDL_DestroyProperties(props);
+    SDL_DestroyEnvironment(env);
+
+    if (process) {
+        output = (char *)SDL_ReadProcess(process, NULL, &exit_code);
+        SDL_DestroyProcess(process);
+        if (output && exit_code != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s --checksums exited with %d:\n%s", progname, exit_code, output);
+            SDL_free(output);
+            output = NULL;
+        }
+    }
+    return output;
+}
+
+/* Check that the AVX-512 and AVX2 resampler kernels produce exactly the same output as the SSE ones.
+   Each set of kernels runs in its own process, since the kernels are picked once per process. */
+static int compare_kernels(const char *progname)
+{
+    static const char *masks[] = { "all", "-avx512f" };
+    char *expected;
+    int result = 0;
+    int i;
+
+    expected = run_checksums(progname, "-avx2");
+    if (!expected) {
+        SDL_Log("Couldn't get reference checksums from %s, skipping: %s", progname, SDL_GetError());
+        return 0;
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(masks); ++i) {
+        char *actual = run_checksums(progname, masks[i]);
+
+        if (!actual) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't run %s with SDL_CPU_FEATURE_MASK=%s: %s", progname, masks[i], SDL_GetError());
+            result = 8;
+        } else if (SDL_strcmp(expected, actual) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CPU_FEATURE_MASK=%s doesn't match the SSE kernels.\nExpected:\n%s\nGot:\n%s", masks[i], expected, actual);
+            result = 8;
+        } else {
+            SDL_Log("SDL_CPU_FEATURE_MASK=%s matches the SSE kernels", masks[i]);
+        }
+        SDL_free(actual);
+    }
+    SDL_free(expected);
+    return result;
+}
+
 int main(int argc, char **argv)
 {
     SDL_AudioSpec spec;
@@ -38,6 +281,10 @@ int main(int argc, char **argv)
     SDLTest_CommonState *state;
     char *file_in = NULL;
     char *file_out = NULL;
+    int benchmark_seconds = 0;
+    bool checksums = false;
+    bool compare = false;
+    SDL_AudioResamplerQuality quality = SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM;
 
     /* Initialize test framework */
     state = SDLTest_CommonCreateState(argv, 0);
@@ -53,7 +300,31 @@ int main(int argc, char **argv)
 
         consumed = SDLTest_CommonArg(state, i);
         if (!consumed) {
-            if (argpos == 0) {
+            if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                benchmark_seconds = 10;
+                consumed = 1;
+                if (argv[i + 1] && SDL_isdigit((unsigned char)argv[i + 1][0])) {
+                    benchmark_seconds = SDL_max(SDL_atoi(argv[i + 1]), 1);
+                    consumed = 2;
+                }
+            } else if (SDL_strcmp(argv[i], "--checksums") == 0) {
+                checksums = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--compare-kernels") == 0) {
+                compare = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--quality") == 0 && argv[i + 1]) {
+                consumed = 2;
+                if (SDL_strcmp(argv[i + 1], "fast") == 0) {
+                    quality = SDL_AUDIO_RESAMPLER_QUALITY_FAST;
+                } else if (SDL_strcmp(argv[i + 1], "medium") == 0) {
+                    quality = SDL_AUDIO_RESAMPLER_QUALITY_MEDIUM;
+                } else if (SDL_strcmp(argv[i + 1], "high") == 0) {
+                    quality = SDL_AUDIO_RESAMPLER_QUALITY_HIGH;
+                } else {
+                    consumed = -1;
+                }
+            } else if (argpos == 0) {
                 file_in = argv[i];
                 argpos++;
                 consumed = 1;
@@ -86,7 +357,7 @@ int main(int argc, char **argv)
         i += consumed;
     }
 
-    if (argpos != 4) {
+    if (argpos != 4 && !((benchmark_seconds || checksums || compare) && argpos == 0)) {
         log_usage(argv[0], state);
         ret = 1;
         goto end;
@@ -98,6 +369,21 @@ int main(int argc, char **argv)
         goto end;
     }
 
+    if (benchmark_seconds) {
+        ret = run_benchmark(benchmark_seconds, quality) ? 0 : 7;
+        goto end;
+    }
+
+    if (checksums) {
+        ret = log_checksums(quality) ? 0 : 7;
+        goto end;
+    }
+
+    if (compare) {
+        ret = compare_kernels(argv[0]);
+        goto end;
+    }
+
     if (!SDL_LoadWAV(file_in, &spec, &data, &len)) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to load %s: %s", file_in, SDL_GetError());
         ret = 3;
@@ -105,7 +391,19 @@ int main(int argc, char **argv)
     }
 
     cvtspec.format = spec.format;
-    if (!SDL_ConvertAudioSamples(&spec, data, len, &cvtspec, &dst_buf, &dst_len)) {
+    stream = SDL_CreateAudioStream(&spec, &cvtspec);
+    if (!stream ||
+        !SDL_SetAudioStreamResamplerQuality(stream, quality) ||
+        !SDL_PutAudioStreamData(stream, data, (int)len) ||
+        !SDL_FlushAudioStream(stream)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to convert samples: %s", SDL_GetError());
+        ret = 4;
+        goto end;
+    }
+
+    dst_len = SDL_GetAudioStreamAvailable(stream);
+    dst_buf = (Uint8 *)SDL_malloc(dst_len);
+    if (!dst_buf || SDL_GetAudioStreamData(stream, dst_buf, dst_len) != dst_len) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to convert samples: %s", SDL_GetError());
         ret = 4;
         goto end;
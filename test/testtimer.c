@@ -18,6 +18,7 @@
 #include <SDL3/SDL_test.h>
 
 #define DEFAULT_RESOLUTION 1
+#define DEFAULT_STRESS_TIMERS 100000
 
 static int test_sdl_delay_within_bounds(void) {
     const int testDelay = 100;
@@ -63,6 +64,178 @@ ticktockNS(void *param, SDL_TimerID timerID, Uint64 interval)
     return interval;
 }
 
+static SDL_AtomicInt stress_fired;
+static SDL_AtomicInt stress_canceled_fired;
+
+static Uint64 SDLCALL
+stress_oneshot(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    SDL_AddAtomicInt(&stress_fired, 1);
+    return 0;
+}
+
+static Uint64 SDLCALL
+stress_canceled(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    SDL_AddAtomicInt(&stress_canceled_fired, 1);
+    return 0;
+}
+
+static double
+stress_rate(int count, Uint64 elapsed)
+{
+    return ((double)count * SDL_NS_PER_SECOND / SDL_max(elapsed, 1)) / 1000000.0;
+}
+
+/* Add, remove and fire lots of short-lived timers, like per-object timeouts */
+static int test_timer_stress(int num_timers)
+{
+    SDL_TimerID *ids;
+    Uint64 start, elapsed;
+    int i;
+    int return_code = 0;
+
+    ids = (SDL_TimerID *)SDL_malloc(num_timers * sizeof(*ids));
+    if (!ids) {
+        return 1;
+    }
+
+    SDL_Log("Stress testing with %d timers", num_timers);
+
+    SDL_SetAtomicInt(&stress_fired, 0);
+    SDL_SetAtomicInt(&stress_canceled_fired, 0);
+
+    /* Timers that will be removed before they fire, spread over 10 seconds */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_timers; ++i) {
+        ids[i] = SDL_AddTimerNS(10 * SDL_NS_PER_SECOND + SDL_rand(SDL_NS_PER_SECOND), stress_canceled, NULL);
+        if (!ids[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create timer %d: %s", i, SDL_GetError());
+            return_code = 1;
+            break;
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    SDL_Log("Added %d timers in %.2f ms, %.2f million/sec", i, (double)elapsed / SDL_NS_PER_MS, stress_rate(i, elapsed));
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_timers && ids[i]; ++i) {
+        if (!SDL_RemoveTimer(ids[i])) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not remove timer %d: %s", i, SDL_GetError());
+            return_code = 1;
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    SDL_Log("Removed %d timers in %.2f ms, %.2f million/sec", i, (double)elapsed / SDL_NS_PER_MS, stress_rate(i, elapsed));
+
+    /* One-shot timers spread over the next 100 ms, with nanosecond intervals */
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_timers; ++i) {
+        if (!SDL_AddTimerNS(1 + SDL_rand(100 * SDL_NS_PER_MS), stress_oneshot, NULL)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create timer %d: %s", i, SDL_GetError());
+            return_code = 1;
+            break;
+        }
+    }
+    while (SDL_GetAtomicInt(&stress_fired) < i && (SDL_GetTicksNS() - start) < 10 * SDL_NS_PER_SECOND) {
+        SDL_Delay(1);
+    }
+    elapsed = SDL_GetTicksNS() - start;
+    SDL_Log("Added and fired %d one-shot timers in %.2f ms, %.2f million/sec", SDL_GetAtomicInt(&stress_fired), (double)elapsed / SDL_NS_PER_MS, stress_rate(SDL_GetAtomicInt(&stress_fired), elapsed));
+
+    if (SDL_GetAtomicInt(&stress_fired) != i) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of %d one-shot timers fired", SDL_GetAtomicInt(&stress_fired), i);
+        return_code = 1;
+    }
+    if (SDL_GetAtomicInt(&stress_canceled_fired) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d removed timers fired", SDL_GetAtomicInt(&stress_canceled_fired));
+        return_code = 1;
+    }
+
+    SDL_free(ids);
+    return return_code;
+}
+
+static SDL_AtomicInt slow_overlaps;
+
+static Uint64 SDLCALL
+dispatch_slow(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    SDL_AtomicInt *running = (SDL_AtomicInt *)param;
+
+    /* A timer should never run concurrently with itself */
+    if (SDL_AddAtomicInt(running, 1) != 0) {
+        SDL_AddAtomicInt(&slow_overlaps, 1);
+    }
+    SDL_DelayNS(10 * SDL_NS_PER_MS);
+    SDL_AddAtomicInt(running, -1);
+    return interval;
+}
+
+static Uint64 SDLCALL
+dispatch_fast(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    return interval;
+}
+
+/* Run fast timers next to slow ones, and report how late the callbacks ran */
+static int test_timer_dispatch(int num_threads)
+{
+    SDL_AtomicInt running[2];
+    SDL_TimerID ids[6];
+    SDL_TimerLatencyHistogram histogram;
+    char threads[32];
+    int i;
+    int return_code = 0;
+
+    (void)SDL_snprintf(threads, sizeof(threads), "%d", num_threads);
+    SDL_SetHint(SDL_HINT_TIMER_DISPATCH_THREADS, threads);
+
+    SDL_zeroa(running);
+    SDL_SetAtomicInt(&slow_overlaps, 0);
+
+    ids[0] = SDL_AddTimerNS(2 * SDL_NS_PER_MS, dispatch_slow, &running[0]);
+    ids[1] = SDL_AddTimerNS(2 * SDL_NS_PER_MS, dispatch_slow, &running[1]);
+    for (i = 2; i < SDL_arraysize(ids); ++i) {
+        ids[i] = SDL_AddTimerNS(SDL_NS_PER_MS, dispatch_fast, NULL);
+    }
+    SDL_GetTimerLatencyHistogram(&histogram, true);
+
+    SDL_Delay(500);
+
+    for (i = 0; i < SDL_arraysize(ids); ++i) {
+        SDL_RemoveTimer(ids[i]);
+    }
+    SDL_GetTimerLatencyHistogram(&histogram, true);
+
+    SDL_Log("%d dispatch threads: %" SDL_PRIu64 " callbacks, average latency %.3f ms, max latency %.3f ms",
+            num_threads, histogram.count,
+            histogram.count ? ((double)histogram.total_ns / histogram.count) / SDL_NS_PER_MS : 0.0,
+            (double)histogram.max_ns / SDL_NS_PER_MS);
+    for (i = 0; i < SDL_TIMER_LATENCY_BUCKETS; ++i) {
+        if (histogram.buckets[i]) {
+            if (i == 0) {
+                SDL_Log("    < 1 us: %" SDL_PRIu64, histogram.buckets[i]);
+            } else if (i == SDL_TIMER_LATENCY_BUCKETS - 1) {
+                SDL_Log("    >= %d us: %" SDL_PRIu64, 1 << (i - 1), histogram.buckets[i]);
+            } else {
+                SDL_Log("    %d-%d us: %" SDL_PRIu64, 1 << (i - 1), (1 << i) - 1, histogram.buckets[i]);
+            }
+        }
+    }
+
+    if (SDL_GetAtomicInt(&slow_overlaps) != 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "A timer callback ran concurrently with itself %d times", SDL_GetAtomicInt(&slow_overlaps));
+        return_code = 1;
+    }
+
+    /* The hint is read when the timer subsystem starts */
+    SDL_Quit();
+    SDL_ResetHint(SDL_HINT_TIMER_DISPATCH_THREADS);
+
+    return return_code;
+}
+
 static Uint32 SDLCALL
 callback(void *param, SDL_TimerID timerID, Uint32 interval)
 {
@@ -76,6 +249,7 @@ int main(int argc, char *argv[])
 {
     int i;
     int desired = -1;
+    int stress_timers = DEFAULT_STRESS_TIMERS;
     SDL_TimerID t1, t2, t3;
     Uint64 start, now;
     Uint64 start_perf, now_perf;
@@ -98,6 +272,9 @@ int main(int argc, char *argv[])
             if (SDL_strcmp(argv[i], "--no-interactive") == 0) {
                 run_interactive_tests = false;
                 consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--stress") == 0 && argv[i + 1]) {
+                stress_timers = SDL_atoi(argv[i + 1]);
+                consumed = 2;
             } else if (desired < 0) {
                 char *endptr;
 
@@ -108,7 +285,7 @@ int main(int argc, char *argv[])
             }
         }
         if (consumed <= 0) {
-            static const char *options[] = { "[--no-interactive]", "[interval]", NULL };
+            static const char *options[] = { "[--no-interactive]", "[--stress N]", "[interval]", NULL };
             SDLTest_CommonLogUsage(state, argv[0], options);
             return 1;
         }
@@ -122,6 +299,24 @@ int main(int argc, char *argv[])
         return 0;
     }
 
+    if (stress_timers > 0) {
+        return_code = test_timer_stress(stress_timers);
+        if (return_code) {
+            SDL_Quit();
+            return return_code;
+        }
+    }
+
+    SDL_Log("Testing timer dispatch threads...");
+    return_code = test_timer_dispatch(0);
+    if (!return_code) {
+        return_code = test_timer_dispatch(4);
+    }
+    if (return_code) {
+        SDL_Quit();
+        return return_code;
+    }
+
     /* Verify SDL_GetTicks* acts monotonically increasing, and not erratic. */
     SDL_Log("Sanity-checking GetTicks");
     for (i = 0; i < 1000; ++i) {
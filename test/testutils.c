@@ -128,3 +128,151 @@ SDL_Texture *LoadTexture(SDL_Renderer *renderer, const char *file, bool transpar
     }
     return texture;
 }
+
+typedef struct TestThread
+{
+    TestThreads *threads;
+    SDL_Thread *thread;
+    int index;
+    Uint64 elapsed;
+    bool result;
+} TestThread;
+
+struct TestThreads
+{
+    TestThreadFunction fn;
+    void *userdata;
+    SDL_AtomicInt ready;
+    SDL_AtomicInt start;
+    int num_threads;
+    TestThread *thread;
+};
+
+static int SDLCALL TestThreadMain(void *data)
+{
+    TestThread *thread = (TestThread *)data;
+    TestThreads *threads = thread->threads;
+    Uint64 start;
+
+    /* Spin rather than wait on a condition, so all threads start at once */
+    SDL_AddAtomicInt(&threads->ready, 1);
+    while (!SDL_GetAtomicInt(&threads->start)) {
+        SDL_CPUPauseInstruction();
+    }
+
+    start = SDL_GetTicksNS();
+    thread->result = threads->fn(threads->userdata, thread->index);
+    thread->elapsed = SDL_GetTicksNS() - start;
+    return 0;
+}
+
+/**
+ * Create num_threads threads that each call fn, and return once they are all
+ * running it. Pass the result to WaitTestThreads() to wait for them.
+ *
+ * Fails and returns NULL if the threads can't be created, after waiting for
+ * any that were.
+ */
+TestThreads *StartTestThreads(TestThreadFunction fn, void *userdata, int num_threads)
+{
+    TestThreads *threads;
+    int i;
+
+    threads = (TestThreads *)SDL_calloc(1, sizeof(*threads));
+    if (!threads) {
+        return NULL;
+    }
+    threads->thread = (TestThread *)SDL_calloc(num_threads, sizeof(*threads->thread));
+    if (!threads->thread) {
+        SDL_free(threads);
+        return NULL;
+    }
+    threads->fn = fn;
+    threads->userdata = userdata;
+
+    for (i = 0; i < num_threads; ++i) {
+        char name[64];
+
+        threads->thread[i].threads = threads;
+        threads->thread[i].index = i;
+        (void)SDL_snprintf(name, sizeof(name), "TestThread%d", i);
+        threads->thread[i].thread = SDL_CreateThread(TestThreadMain, name, &threads->thread[i]);
+        if (!threads->thread[i].thread) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s", SDL_GetError());
+            threads->num_threads = i;
+            SDL_SetAtomicInt(&threads->start, 1);
+            WaitTestThreads(threads, NULL);
+            return NULL;
+        }
+        ++threads->num_threads;
+    }
+
+    while (SDL_GetAtomicInt(&threads->ready) < num_threads) {
+        SDL_Delay(1);
+    }
+    SDL_SetAtomicInt(&threads->start, 1);
+    return threads;
+}
+
+/**
+ * Wait for the threads created by StartTestThreads() and free them.
+ *
+ * If elapsed isn't NULL, it is set to the time the slowest thread took, in
+ * nanoseconds. Returns false if fn failed on any of the threads.
+ */
+bool WaitTestThreads(TestThreads *threads, Uint64 *elapsed)
+{
+    Uint64 slowest = 0;
+    bool result = true;
+    int i;
+
+    for (i = 0; i < threads->num_threads; ++i) {
+        SDL_WaitThread(threads->thread[i].thread, NULL);
+        slowest = SDL_max(slowest, threads->thread[i].elapsed);
+        if (!threads->thread[i].result) {
+            result = false;
+        }
+    }
+    SDL_free(threads->thread);
+    SDL_free(threads);
+
+    if (elapsed) {
+        *elapsed = SDL_max(slowest, 1);
+    }
+    return result;
+}
+
+/**
+ * Run fn on num_threads threads at once, passes times over.
+ *
+ * If elapsed isn't NULL, it is set to the time the slowest thread took in the
+ * fastest pass, in nanoseconds; running several passes filters out scheduling
+ * noise. Returns false if the threads couldn't be created or fn failed.
+ */
+bool RunTestThreads(TestThreadFunction fn, void *userdata, int num_threads, int passes, Uint64 *elapsed)
+{
+    Uint64 best = 0;
+    bool result = true;
+    int pass;
+
+    for (pass = 0; pass < passes; ++pass) {
+        TestThreads *threads = StartTestThreads(fn, userdata, num_threads);
+        Uint64 pass_time;
+
+        if (!threads) {
+            result = false;
+            break;
+        }
+        if (!WaitTestThreads(threads, &pass_time)) {
+            result = false;
+        }
+        if (pass == 0 || pass_time < best) {
+            best = pass_time;
+        }
+    }
+
+    if (elapsed) {
+        *elapsed = SDL_max(best, 1);
+    }
+    return result;
+}
@@ -20,4 +20,13 @@ SDL_Texture *LoadTexture(SDL_Renderer *renderer, const char *file, bool transpar
 char *GetNearbyFilename(const char *file);
 char *GetResourceFilename(const char *user_specified, const char *def);
 
+/* The work done by each of the threads of a benchmark, with the thread's
+   index. Returns false if the work failed. */
+typedef bool (SDLCALL *TestThreadFunction)(void *userdata, int index);
+typedef struct TestThreads TestThreads;
+
+TestThreads *StartTestThreads(TestThreadFunction fn, void *userdata, int num_threads);
+bool WaitTestThreads(TestThreads *threads, Uint64 *elapsed);
+bool RunTestThreads(TestThreadFunction fn, void *userdata, int num_threads, int passes, Uint64 *elapsed);
+
 #endif
@@ -239,6 +239,107 @@ done:
     return result;
 }
 
+/* Fill a surface with noise, so every lane of the SIMD converters sees different input */
+static SDL_Surface *generate_noise_pattern(int pattern_size, SDL_PixelFormat format)
+{
+    SDL_Surface *pattern = SDL_CreateSurface(pattern_size, pattern_size, format);
+
+    if (pattern) {
+        int x, y;
+
+        SDL_srand(pattern_size);
+        for (y = 0; y < pattern->h; ++y) {
+            Uint32 *p = (Uint32 *)((Uint8 *)pattern->pixels + y * pattern->pitch);
+            for (x = 0; x < pattern->w; ++x) {
+                p[x] = SDL_rand_bits();
+            }
+        }
+    }
+    return pattern;
+}
+
+static bool convert_to_yuv(SDL_Surface *pattern, Uint32 format, SDL_Colorspace colorspace, Uint8 *yuv, int yuv_pitch, int yuv_len, const char *cpu_feature_mask)
+{
+    bool result;
+
+    /* The CPU feature mask is latched until SDL_Quit() */
+    SDL_Quit();
+    if (cpu_feature_mask) {
+        SDL_SetHintWithPriority(SDL_HINT_CPU_FEATURE_MASK, cpu_feature_mask, SDL_HINT_OVERRIDE);
+    }
+    SDL_memset(yuv, 0, yuv_len);
+    result = SDL_ConvertPixelsAndColorspace(pattern->w, pattern->h, pattern->format, SDL_COLORSPACE_SRGB, 0, pattern->pixels, pattern->pitch, format, colorspace, 0, yuv, yuv_pitch);
+    if (!result) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s", SDL_GetPixelFormatName(pattern->format), SDL_GetPixelFormatName(format), SDL_GetError());
+    }
+    SDL_Quit();
+    return result;
+}
+
+/* Verify that each tier of SIMD RGB to YUV converters matches the scalar converters exactly */
+static bool run_intrinsics_tests(int pattern_size, int extra_pitch)
+{
+    /* The best converters the CPU has (AVX2 or NEON), then SSE2 on x86 */
+    static const char *simd_masks[] = { NULL, "-avx2" };
+    const struct
+    {
+        Uint32 rgb_format;
+        Uint32 yuv_format;
+        SDL_Colorspace colorspace;
+    } tests[] = {
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_YV12, SDL_COLORSPACE_BT709_LIMITED },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_IYUV, SDL_COLORSPACE_BT709_FULL },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_NV12, SDL_COLORSPACE_JPEG },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_NV21, SDL_COLORSPACE_BT601_LIMITED },
+        { SDL_PIXELFORMAT_XBGR2101010, SDL_PIXELFORMAT_P010, SDL_COLORSPACE_BT2020_FULL },
+    };
+    const int yuv_len = MAX_YUV_SURFACE_SIZE(pattern_size, pattern_size, extra_pitch);
+    Uint8 *yuv1 = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *yuv2 = (Uint8 *)SDL_malloc(yuv_len);
+    SDL_Surface *pattern = NULL;
+    int i, j;
+    bool result = false;
+
+    if (!yuv1 || !yuv2) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't allocate test buffers");
+        goto done;
+    }
+
+    for (i = 0; i < SDL_arraysize(tests); ++i) {
+        /* The pitch needs to be Uint16 aligned for P010 pixels */
+        const int yuv_pitch = CalculateYUVPitch(tests[i].yuv_format, pattern_size) + ((extra_pitch + 1) & ~1);
+
+        pattern = generate_noise_pattern(pattern_size, tests[i].rgb_format);
+        if (!pattern) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't allocate test surface");
+            goto done;
+        }
+        if (!convert_to_yuv(pattern, tests[i].yuv_format, tests[i].colorspace, yuv2, yuv_pitch, yuv_len, "-all")) {
+            goto done;
+        }
+        for (j = 0; j < SDL_arraysize(simd_masks); ++j) {
+            if (!convert_to_yuv(pattern, tests[i].yuv_format, tests[i].colorspace, yuv1, yuv_pitch, yuv_len, simd_masks[j])) {
+                goto done;
+            }
+            if (SDL_memcmp(yuv1, yuv2, yuv_len) != 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SIMD conversion from %s to %s with CPU feature mask \"%s\" doesn't match scalar conversion",
+                             SDL_GetPixelFormatName(tests[i].rgb_format), SDL_GetPixelFormatName(tests[i].yuv_format), simd_masks[j] ? simd_masks[j] : "");
+                goto done;
+            }
+        }
+        SDL_DestroySurface(pattern);
+        pattern = NULL;
+    }
+
+    result = true;
+
+done:
+    SDL_free(yuv1);
+    SDL_free(yuv2);
+    SDL_DestroySurface(pattern);
+    return result;
+}
+
 static bool run_colorspace_test(void)
 {
     bool result = false;
@@ -537,6 +638,10 @@ int main(int argc, char **argv)
             if (!run_automated_tests(automated_test_params[i].pattern_size, automated_test_params[i].extra_pitch)) {
                 return 2;
             }
+            if (automated_test_params[i].enable_intrinsics &&
+                !run_intrinsics_tests(automated_test_params[i].pattern_size, automated_test_params[i].extra_pitch)) {
+                return 2;
+            }
         }
         return 0;
     }